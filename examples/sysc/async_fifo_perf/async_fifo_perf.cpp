@@ -0,0 +1,272 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  async_fifo_perf.cpp -- Benchmark of the sc_async_fifo channel.
+
+                         A number of host threads, standing in for packet
+                         capture stubs, write a sequence of numbers each,
+                         and a thread of the simulation reads and sums
+                         them. This is done twice: once through a channel
+                         that keeps the values in a queue guarded by an
+                         sc_host_mutex and calls async_request_update()
+                         for every value, and once through an
+                         sc_async_fifo.
+
+                         For both channels the value rate is displayed
+                         together with the number of async update requests
+                         the host threads made to wake the simulator.
+
+                         The number of host threads, the number of values
+                         each of them writes and the size of the
+                         sc_async_fifo can be set via command line
+                         arguments. By default, 2 threads write 500000
+                         values each to a fifo of 1024 values.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <deque>
+#include "sysc/communication/sc_host_mutex.h"
+
+#if !( defined(WIN32) || defined(_WIN32) )
+#  include <pthread.h>
+#  include <sys/time.h>
+#  define ASYNC_FIFO_PERF_THREADS 1
+#else
+#  define ASYNC_FIFO_PERF_THREADS 0
+#endif
+
+typedef sc_dt::uint64 value;
+
+// the channel host threads usually write to: a queue guarded by a host
+// mutex, and an async_request_update() for every value
+
+class locked_fifo
+: public sc_fifo_in_if<value>,
+  public sc_prim_channel
+{
+public:
+
+    explicit locked_fifo( const char* name_ )
+      : sc_prim_channel( name_ ), m_num_readable( 0 )
+      { async_attach_suspending(); }
+
+    bool write( const value& v )
+    {
+        {
+            sc_scoped_lock lock( m_mutex );
+            m_queue.push_back( v );
+        }
+        async_request_update();
+        return true;
+    }
+
+    virtual void read( value& v )
+    {
+        while ( !nb_read( v ) )
+            wait( m_data_written_event );
+    }
+
+    virtual value read()
+        { value v; read( v ); return v; }
+
+    virtual bool nb_read( value& v )
+    {
+        if ( m_num_readable == 0 )
+            return false;
+        sc_scoped_lock lock( m_mutex );
+        v = m_queue.front();
+        m_queue.pop_front();
+        --m_num_readable;
+        return true;
+    }
+
+    virtual int num_available() const
+        { return static_cast<int>( m_num_readable ); }
+
+    virtual const sc_event& data_written_event() const
+        { return m_data_written_event; }
+
+protected:
+
+    virtual void update()
+    {
+        sc_scoped_lock lock( m_mutex );
+        if ( m_queue.size() != m_num_readable )
+        {
+            m_num_readable = m_queue.size();
+            m_data_written_event.notify( SC_ZERO_TIME );
+        }
+    }
+
+    virtual void end_of_simulation()
+        { async_detach_suspending(); }
+
+private:
+    sc_host_mutex       m_mutex;
+    std::deque<value>   m_queue;
+    std::size_t         m_num_readable;
+    sc_event            m_data_written_event;
+};
+
+#if ASYNC_FIFO_PERF_THREADS
+
+static double
+wall_time()
+{
+    timeval tv;
+    gettimeofday( &tv, 0 );
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+// a host thread writing count numbers to a channel
+
+template <class F>
+struct producer
+{
+    F*        fifo;
+    value     count;
+    pthread_t thread;
+
+    static void* main( void* p )
+    {
+        producer* self = static_cast<producer*>( p );
+        for ( value i = 0; i < self->count; ++i )
+            self->fifo->write( i );
+        return 0;
+    }
+};
+
+template <class F>
+static double
+run( F& fifo, sc_fifo_in<value>& in, unsigned threads, value count,
+     value& sum, sc_dt::uint64& requests )
+{
+    requests = sc_get_async_update_stats().requests;
+    std::vector< producer<F> > producers( threads );
+    double start = wall_time();
+    for ( unsigned i = 0; i < threads; ++i )
+    {
+        producers[i].fifo = &fifo;
+        producers[i].count = count;
+        pthread_create( &producers[i].thread, 0, &producer<F>::main,
+                        &producers[i] );
+    }
+    sum = 0;
+    for ( value n = 0; n < threads * count; ++n )
+        sum += in.read();
+    for ( unsigned i = 0; i < threads; ++i )
+        pthread_join( producers[i].thread, 0 );
+    double secs = wall_time() - start;
+
+    // accept the last requests
+    wait( SC_ZERO_TIME );
+    requests = sc_get_async_update_stats().requests - requests;
+    return secs;
+}
+
+#endif // ASYNC_FIFO_PERF_THREADS
+
+SC_MODULE( consumer )
+{
+    sc_fifo_in<value> locked_in;
+    sc_fifo_in<value> async_in;
+
+    SC_HAS_PROCESS( consumer );
+    consumer( sc_module_name, locked_fifo& locked,
+              sc_async_fifo<value>& async, unsigned threads, value count )
+      : m_locked( locked ), m_async( async ), m_threads( threads ),
+        m_count( count ), m_ok( false )
+    {
+        SC_THREAD( main );
+    }
+
+    void main()
+    {
+#if ASYNC_FIFO_PERF_THREADS
+        value expected = m_threads * ( m_count * ( m_count - 1 ) / 2 );
+        value locked_sum, async_sum;
+        sc_dt::uint64 locked_requests, async_requests;
+        double locked_secs = run( m_locked, locked_in, m_threads, m_count,
+                                  locked_sum, locked_requests );
+        double async_secs = run( m_async, async_in, m_threads, m_count,
+                                 async_sum, async_requests );
+        m_async.close();
+        value values = m_threads * m_count;
+
+        cout << "values per channel: " << values << endl;
+        cout << "locked fifo:        " << values / locked_secs
+             << " values/sec., " << locked_requests
+             << " update requests" << endl;
+        cout << "sc_async_fifo:      " << values / async_secs
+             << " values/sec., " << async_requests
+             << " update requests" << endl;
+        m_ok = locked_sum == expected && async_sum == expected;
+#endif
+        sc_stop();
+    }
+
+    locked_fifo&          m_locked;
+    sc_async_fifo<value>& m_async;
+    unsigned              m_threads;
+    value                 m_count;
+    bool                  m_ok;
+};
+
+int sc_main (int argc , char *argv[])
+{
+    unsigned threads = 2;
+    value count = 500000;
+    int size = 1024;
+    if ( argc > 1 )
+        threads = atoi( argv[1] );
+    if ( argc > 2 )
+        count = atoi( argv[2] );
+    if ( argc > 3 )
+        size = atoi( argv[3] );
+
+    locked_fifo locked( "locked" );
+    sc_async_fifo<value> async( "async", size );
+    consumer c( "consumer", locked, async, threads, count );
+    c.locked_in( locked );
+    c.async_in( async );
+
+    sc_start();
+
+#if ASYNC_FIFO_PERF_THREADS
+    cout << ( c.m_ok ? "all values passed" : "values lost" ) << endl;
+    return c.m_ok ? 0 : 1;
+#else
+    cout << "host threads not supported on this host" << endl;
+    return 0;
+#endif
+}
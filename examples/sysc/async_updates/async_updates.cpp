@@ -0,0 +1,253 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  async_updates.cpp -- Regression test of the update requests from host
+                       threads (async_request_update).
+
+                       Several host threads each increment the counter of
+                       a channel of their own and request an update after
+                       every increment. A thread of the simulation waits
+                       until all increments have been taken over by the
+                       update phases. No increment may be lost, and the
+                       counters of sc_get_async_update_stats() must match
+                       the update() calls of the channels, first without
+                       and then with the latency measurement of
+                       sc_set_async_update_latency().
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <sstream>
+#include "sysc/communication/sc_host_mutex.h"
+
+#if !( defined(WIN32) || defined(_WIN32) )
+#  include <pthread.h>
+#  define ASYNC_UPDATES_THREADS 1
+#else
+#  define ASYNC_UPDATES_THREADS 0
+#endif
+
+const unsigned producers = 4;
+const unsigned increments = 5000;
+
+// a counter incremented by a host thread, which the update phase copies
+// to the simulation side
+
+class async_counter
+: public sc_prim_channel
+{
+public:
+
+    explicit async_counter( const char* name_ )
+      : sc_prim_channel( name_ ), m_pending( 0 ), m_value( 0 ),
+        m_updates( 0 )
+      { async_attach_suspending(); }
+
+    void increment()
+    {
+        {
+            sc_scoped_lock lock( m_mutex );
+            ++m_pending;
+        }
+        async_request_update();
+    }
+
+    unsigned value() const
+        { return m_value; }
+
+    unsigned updates() const
+        { return m_updates; }
+
+    const sc_event& changed_event() const
+        { return m_changed_event; }
+
+protected:
+
+    virtual void update()
+    {
+        ++m_updates;
+        sc_scoped_lock lock( m_mutex );
+        if ( m_pending != 0 )
+        {
+            m_value += m_pending;
+            m_pending = 0;
+            m_changed_event.notify( SC_ZERO_TIME );
+        }
+    }
+
+    virtual void end_of_simulation()
+        { async_detach_suspending(); }
+
+private:
+    sc_host_mutex m_mutex;
+    unsigned      m_pending;  // guarded by m_mutex.
+    unsigned      m_value;
+    unsigned      m_updates;
+    sc_event      m_changed_event;
+};
+
+#if ASYNC_UPDATES_THREADS
+
+// a host thread incrementing a counter
+
+struct producer
+{
+    async_counter* counter;
+    pthread_t      thread;
+
+    static void* main( void* p )
+    {
+        producer* self = static_cast<producer*>( p );
+        for ( unsigned i = 0; i < increments; ++i )
+            self->counter->increment();
+        return 0;
+    }
+};
+
+#endif // ASYNC_UPDATES_THREADS
+
+SC_MODULE( consumer )
+{
+    SC_CTOR( consumer )
+      : m_ok( true )
+    {
+        for ( unsigned i = 0; i < producers; ++i )
+        {
+            std::ostringstream name;
+            name << "counter_" << i;
+            m_counters[i] = new async_counter( name.str().c_str() );
+        }
+        SC_THREAD( main );
+    }
+
+    ~consumer()
+    {
+        for ( unsigned i = 0; i < producers; ++i )
+            delete m_counters[i];
+    }
+
+    void main()
+    {
+#if ASYNC_UPDATES_THREADS
+        run( false );
+        run( true );
+#endif
+        sc_stop();
+    }
+
+#if ASYNC_UPDATES_THREADS
+
+    // let the producers increment all counters by increments and check
+    // the counters of the accepted requests
+
+    void run( bool latency )
+    {
+        sc_set_async_update_latency( latency );
+        sc_async_update_stats before = sc_get_async_update_stats();
+        unsigned values[producers];
+        unsigned updates = 0;  // update() calls during the run.
+        for ( unsigned i = 0; i < producers; ++i )
+        {
+            values[i] = m_counters[i]->value();
+            updates -= m_counters[i]->updates();
+        }
+
+        producer threads[producers];
+        for ( unsigned i = 0; i < producers; ++i )
+        {
+            threads[i].counter = m_counters[i];
+            pthread_create( &threads[i].thread, 0, &producer::main,
+                            &threads[i] );
+        }
+        for ( unsigned i = 0; i < producers; ++i )
+        {
+            while ( m_counters[i]->value() != values[i] + increments )
+                wait( m_counters[i]->changed_event() );
+        }
+        for ( unsigned i = 0; i < producers; ++i )
+            pthread_join( threads[i].thread, 0 );
+
+        sc_async_update_stats after = sc_get_async_update_stats();
+        for ( unsigned i = 0; i < producers; ++i )
+            updates += m_counters[i]->updates();
+        sc_dt::uint64 requests = after.requests - before.requests;
+        sc_dt::uint64 batches = after.batches - before.batches;
+        double total_latency = after.total_latency - before.total_latency;
+
+        // every accepted request calls update() once, a batch holds at most
+        // one request per channel
+        bool counts_ok = requests == updates &&
+                         batches > 0 && batches <= requests &&
+                         after.max_batch >= 1 &&
+                         after.max_batch <= producers &&
+                         requests <= batches * after.max_batch;
+
+        // the latencies only grow while they are measured
+        bool latency_ok = latency
+            ? total_latency >= 0.0 && after.max_latency >= before.max_latency &&
+              total_latency <= requests * after.max_latency
+            : total_latency == 0.0 && after.max_latency == before.max_latency;
+
+        bool values_ok = true;
+        for ( unsigned i = 0; i < producers; ++i )
+            values_ok = values_ok &&
+                        m_counters[i]->value() == values[i] + increments;
+
+        cout << "latency measurement " << ( latency ? "on" : "off" ) << ": "
+             << ( values_ok ? "no increment lost" : "increments lost" )
+             << ", request counters "
+             << ( counts_ok ? "consistent" : "inconsistent" )
+             << ", latencies "
+             << ( latency_ok ? "consistent" : "inconsistent" ) << endl;
+        m_ok = m_ok && values_ok && counts_ok && latency_ok;
+    }
+
+#endif // ASYNC_UPDATES_THREADS
+
+    async_counter* m_counters[producers];
+    bool           m_ok;
+};
+
+int sc_main( int, char*[] )
+{
+    consumer c( "consumer" );
+    sc_start();
+
+#if ASYNC_UPDATES_THREADS
+    cout << "increments per host thread: " << increments << endl;
+    return c.m_ok ? 0 : 1;
+#else
+    cout << "host threads not supported on this host" << endl;
+    return 0;
+#endif
+}
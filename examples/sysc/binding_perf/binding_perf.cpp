@@ -0,0 +1,227 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  binding_perf.cpp -- Benchmark of the binding of hierarchical ports.
+
+                      A tree of modules passes a multiport down from the
+                      root to the leaves, each module binds the multiport
+                      of each of its children to its own. The multiport
+                      of the root is bound to a number of signals, so
+                      every port of the tree ends up bound to all of
+                      them. The time taken to complete the binding is
+                      displayed, once resolved by the simulator thread
+                      alone and once by host threads, if the parallel
+                      evaluation is available.
+
+                      The parent ports are resolved level by level of
+                      the tree, each port copying the interfaces of its
+                      already resolved parent once, and the ports of a
+                      level are distributed over the host threads.
+
+                      Each run elaborates the tree in a simulation
+                      context of its own, and both runs must bind every
+                      port of the tree to the same signals in the same
+                      order.
+
+                      The depth and fanout of the tree, the number of
+                      signals and the number of host threads can be set
+                      via command line arguments. By default, a tree of
+                      depth 4 and fanout 6 is bound to 16 signals, using
+                      4 host threads.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <ctime>
+#include <map>
+#include <vector>
+
+#if !( defined(WIN32) || defined(_WIN32) )
+#  include <sys/time.h>
+#  define BINDING_PERF_GETTIMEOFDAY 1
+#else
+#  define BINDING_PERF_GETTIMEOFDAY 0
+#endif
+
+typedef sc_port< sc_signal_in_if<int>, 0 > multi_in;
+
+class tree : public sc_module
+{
+public:
+
+    multi_in in;
+
+    tree( sc_module_name name, int depth, int fanout )
+      : sc_module( name ), in( "in" ), m_children( "child" )
+    {
+        if ( depth > 0 )
+        {
+            m_children.init( fanout, creator( depth - 1, fanout ) );
+            for ( int i = 0; i < fanout; i++ )
+                m_children[i].in( in );
+        }
+    }
+
+    // sum of the values read by the leaves
+    int sum() const
+    {
+        if ( m_children.size() == 0 )
+        {
+            int s = 0;
+            for ( int i = 0; i < in.size(); i++ )
+                s += in[i]->read();
+            return s;
+        }
+        int s = 0;
+        for ( unsigned i = 0; i < m_children.size(); i++ )
+            s += m_children[i].sum();
+        return s;
+    }
+
+    // append the interfaces of all ports of the tree, depth first
+    void interfaces( std::vector<const sc_interface*>& result ) const
+    {
+        for ( int i = 0; i < in.size(); i++ )
+            result.push_back( in[i] );
+        for ( unsigned i = 0; i < m_children.size(); i++ )
+            m_children[i].interfaces( result );
+    }
+
+private:
+
+    struct creator
+    {
+        creator( int depth, int fanout ) : m_depth( depth ), m_fanout( fanout )
+          {}
+        tree* operator()( const char* name, size_t ) const
+          { return new tree( name, m_depth, m_fanout ); }
+        int m_depth;
+        int m_fanout;
+    };
+
+    sc_vector<tree> m_children;
+};
+
+static double
+wall_time()
+{
+#if BINDING_PERF_GETTIMEOFDAY
+    timeval tv;
+    gettimeofday( &tv, 0 );
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+#else
+    return double( std::clock() ) / CLOCKS_PER_SEC;
+#endif
+}
+
+// elaborate the tree in a simulation context of its own, resolving the
+// ports with the given number of host threads, and return the time taken
+// to complete the binding and the signal indices bound to the ports
+
+static double
+run( int depth, int fanout, int n_signals, int threads, int& sum,
+     std::vector<int>& bound )
+{
+    sc_simcontext* simc = new sc_simcontext;
+    sc_simcontext* prev = sc_set_curr_simcontext( simc );
+    sc_set_parallel_evaluation( threads );
+
+    sc_vector< sc_signal<int> >* sig =
+        new sc_vector< sc_signal<int> >( "sig", n_signals );
+    tree* root = new tree( "root", depth, fanout );
+    std::map<const sc_interface*, int> index;
+    for ( int i = 0; i < n_signals; i++ )
+    {
+        (*sig)[i].write( i );
+        root->in( (*sig)[i] );
+        index[&(*sig)[i]] = i;
+    }
+
+    double start = wall_time();
+    sc_start( SC_ZERO_TIME );
+    double secs = wall_time() - start;
+
+    sum = root->sum();
+    std::vector<const sc_interface*> interfaces;
+    root->interfaces( interfaces );
+    bound.clear();
+    for ( std::size_t i = 0; i < interfaces.size(); i++ )
+        bound.push_back( index[interfaces[i]] );
+
+    delete root;
+    delete sig;
+    delete simc;
+    sc_set_curr_simcontext( prev );
+    return secs;
+}
+
+int sc_main (int argc , char *argv[])
+{
+    int depth = 4;
+    int fanout = 6;
+    int n_signals = 16;
+    int threads = 4;
+    if ( argc > 1 )
+        depth = atoi( argv[1] );
+    if ( argc > 2 )
+        fanout = atoi( argv[2] );
+    if ( argc > 3 )
+        n_signals = atoi( argv[3] );
+    if ( argc > 4 )
+        threads = atoi( argv[4] );
+
+    int ports = 1;
+    for ( int d = 0, n = 1; d < depth; d++ )
+        ports += ( n *= fanout );
+
+    int serial_sum = 0;
+    int parallel_sum = 0;
+    std::vector<int> serial_bound;
+    std::vector<int> parallel_bound;
+    double serial_secs =
+        run( depth, fanout, n_signals, 1, serial_sum, serial_bound );
+    double parallel_secs =
+        run( depth, fanout, n_signals, threads, parallel_sum, parallel_bound );
+    bool ok = parallel_sum == serial_sum && parallel_bound == serial_bound &&
+              serial_bound.size() == std::size_t( ports ) * n_signals;
+
+    cout << "ports:              " << ports << endl;
+    cout << "signals:            " << n_signals << endl;
+    cout << "binding time:       " << serial_secs << " s (1 thread)" << endl;
+    cout << "binding time:       " << parallel_secs << " s ("
+         << threads << " threads)" << endl;
+    cout << "sum at the leaves:  " << serial_sum << endl;
+    cout << ( ok ? "parallel binding agrees" : "parallel binding differs" )
+         << endl;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,193 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  checkpoint_restore.cpp -- Regression test of saving a checkpoint of a
+                            paused simulation and restoring it into a
+                            fresh instance of the same model.
+
+                            The values of the signals, of the buffer and
+                            the samples of the fifo are restored, and so
+                            is the timeout of a method process waiting on
+                            next_trigger(t), so the restored simulation
+                            continues like the original one. The signal of
+                            a type without an input operator, the thread
+                            process suspended within its function and the
+                            method process waiting on an event are
+                            reported.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+#include <cstdio>
+#include <sstream>
+
+static const char* const checkpoint_file = "checkpoint_restore.ckpt";
+
+// a value without an input operator, which cannot be checkpointed
+
+struct opaque
+{
+    opaque( int v = 0 ) : value( v ) {}
+
+    bool operator == ( const opaque& other ) const
+        { return value == other.value; }
+
+    int value;
+};
+
+inline ostream& operator << ( ostream& os, const opaque& o )
+{
+    return os << o.value;
+}
+
+SC_MODULE( top )
+{
+    sc_signal<int>           count;
+    sc_buffer<sc_uint<8> >   sum;
+    sc_signal<bool>          odd;
+    sc_signal<opaque>        tag;
+    sc_fifo<int>             squares;
+    sc_event                 never;
+
+    SC_CTOR( top )
+      : count( "count" ), sum( "sum" ), odd( "odd" ), tag( "tag" ),
+        squares( "squares", 4 ), never( "never" )
+    {
+        SC_METHOD( tick );
+        SC_THREAD( produce );
+        SC_METHOD( wait_never );
+    }
+
+    // every 7 ns, after next_trigger(t)
+    void tick()
+    {
+        int n = count.read() + 1;
+        count.write( n );
+        sum.write( sum.read() + n );
+        odd.write( n % 2 != 0 );
+        tag.write( opaque( n ) );
+        int oldest;
+        if ( squares.num_available() == 3 )
+            squares.nb_read( oldest );
+        squares.nb_write( n * n );
+        next_trigger( 7, SC_NS );
+    }
+
+    // suspended within its function whenever the simulation is paused
+    void produce()
+    {
+        for ( ;; )
+            wait( 10, SC_NS );
+    }
+
+    void wait_never()
+    {
+        next_trigger( never );
+    }
+
+    std::string state()
+    {
+        std::ostringstream fifo;
+        squares.print( fifo );
+        std::string samples = fifo.str();
+        for ( std::size_t i = 0; i < samples.size(); ++i )
+            if ( samples[i] == '\n' )
+                samples[i] = i + 1 < samples.size() ? ' ' : '.';
+
+        std::ostringstream os;
+        os << sc_time_stamp() << ": count " << count.read()
+           << ", sum " << sum.read() << ", odd " << odd.read()
+           << ", tag " << tag.read() << ", squares " << samples;
+        return os.str();
+    }
+};
+
+// print the warnings without the file and line of the report
+
+static void
+print_report( const sc_report& rep, const sc_actions& actions )
+{
+    if ( rep.get_severity() == SC_WARNING && ( actions & SC_DISPLAY ) )
+    {
+        cout << "Warning: " << rep.get_msg() << endl;
+        sc_report_handler::default_handler( rep, actions & ~SC_DISPLAY );
+    }
+    else
+        sc_report_handler::default_handler( rep, actions );
+}
+
+// run the model for 100 ns in a context of its own, saving a checkpoint
+// after 50 ns, or restoring one and running the remaining 50 ns
+
+static std::string
+run( bool restore )
+{
+    sc_simcontext* simc = new sc_simcontext;
+    sc_simcontext* prev = sc_set_curr_simcontext( simc );
+
+    top* t = new top( "top" );
+    if ( restore )
+    {
+        cout << "restore" << endl;
+        sc_restore_checkpoint( checkpoint_file );
+        sc_start( SC_ZERO_TIME );
+    }
+    else
+    {
+        sc_start( 50, SC_NS );
+        cout << "save" << endl;
+        sc_save_checkpoint( checkpoint_file );
+    }
+    cout << "  " << t->state() << endl;
+
+    sc_start( 50, SC_NS );
+    std::string result = t->state();
+    cout << "  " << result << endl;
+
+    delete t;
+    delete simc;
+    sc_set_curr_simcontext( prev );
+    return result;
+}
+
+int sc_main( int, char*[] )
+{
+    sc_report_handler::set_handler( print_report );
+
+    std::string saved = run( false );
+    std::string restored = run( true );
+    std::remove( checkpoint_file );
+
+    cout << "restored run " << ( restored == saved ? "agrees" : "differs" )
+         << endl;
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  clock_skip_ahead.cpp -- Regression test of the skip-ahead over idle
+                          clocks (SC_CLOCK_SKIP_AHEAD).
+
+                          A CPU thread waits for an interrupt from a timer
+                          while no process observes the clock, so the
+                          clock is parked. After the interrupt, the thread
+                          reads the clock value and waits for clock edges
+                          with wait(clk.posedge_event()). A second clock
+                          stays unobserved for the whole run, and its
+                          value is sampled by the timer. The model is run
+                          without and with the skip-ahead, and both runs
+                          must log the same times and values, while the
+                          second run has fewer delta cycles.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+#include <sstream>
+
+SC_MODULE( soc )
+{
+    sc_clock       clk;
+    sc_clock       idle_clk;  // never observed.
+    sc_event       irq;
+
+    SC_CTOR( soc )
+      : clk( "clk", 10, SC_NS ),
+        idle_clk( "idle_clk", 3, SC_NS )
+    {
+        SC_THREAD( timer );
+        SC_THREAD( cpu );
+    }
+
+    // raises the interrupt twice, reading the unobserved clock
+
+    void timer()
+    {
+        wait( 1003, SC_NS );
+        log << sc_time_stamp() << ": idle_clk " << idle_clk.read()
+            << ", irq" << endl;
+        irq.notify();
+
+        wait( 2000, SC_NS );
+        log << sc_time_stamp() << ": idle_clk " << idle_clk.read()
+            << ", irq" << endl;
+        irq.notify();
+    }
+
+    // a wait-for-interrupt loop, followed by a few clocked steps
+
+    void cpu()
+    {
+        for ( int i = 0; i < 2; ++i )
+        {
+            wait( irq );
+            log << sc_time_stamp() << ": clk " << clk.read()
+                << " after skipped edges" << endl;
+            for ( int step = 0; step < 3; ++step )
+            {
+                wait( clk.posedge_event() );
+                log << sc_time_stamp() << ": clk " << clk.read()
+                    << ", posedge" << endl;
+            }
+            wait( 7, SC_NS );
+            log << sc_time_stamp() << ": clk " << clk.read() << endl;
+        }
+    }
+
+    std::ostringstream log;
+};
+
+// run the model for 4 us in a context of its own
+
+static std::string
+run( bool skip_ahead, sc_dt::uint64& deltas )
+{
+    sc_simcontext* simc = new sc_simcontext;
+    sc_simcontext* prev = sc_set_curr_simcontext( simc );
+    sc_set_clock_skip_ahead( skip_ahead );
+
+    soc* s = new soc( "soc" );
+    sc_start( 4, SC_US );
+
+    std::string result = s->log.str();
+    deltas = sc_delta_count();
+    cout << ( skip_ahead ? "with" : "without" ) << " skip-ahead:" << endl
+         << result;
+
+    delete s;
+    delete simc;
+    sc_set_curr_simcontext( prev );
+    return result;
+}
+
+int sc_main( int, char*[] )
+{
+    sc_dt::uint64 all_deltas, skip_deltas;
+    std::string all = run( false, all_deltas );
+    std::string skip = run( true, skip_deltas );
+
+    bool ok = skip == all && skip_deltas < all_deltas;
+    cout << "skip-ahead run "
+         << ( skip == all ? "agrees" : "differs" ) << ", "
+         << ( skip_deltas < all_deltas ? "with" : "without" )
+         << " fewer delta cycles" << endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,170 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  concurrent_contexts.cpp -- Regression test of independent simulations
+                             running concurrently on several host threads.
+
+                             Each host thread creates a simulation context
+                             of its own and runs a model that keeps
+                             cancelling and renewing timed notifications,
+                             so the timed notification records are
+                             allocated and released on all threads at the
+                             same time. The results are printed after all
+                             threads are joined and do not depend on the
+                             interleaving of the threads. The threads
+                             start with the report handler settings of
+                             sc_main.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#if SC_CPLUSPLUS >= 201103L
+#  include <thread>
+#  define CONCURRENT_CONTEXTS_STD_THREADS 1
+#elif !( defined(WIN32) || defined(_WIN32) )
+#  include <pthread.h>
+#  define CONCURRENT_CONTEXTS_PTHREADS 1
+#endif
+
+// a method that renews a pseudo-random pick of its events with
+// pseudo-random delays each time it is triggered
+
+SC_MODULE( churn )
+{
+    enum { num_events = 16 };
+
+    SC_HAS_PROCESS( churn );
+
+    churn( sc_module_name, unsigned seed )
+      : m_state( seed ), m_triggers( 0 )
+    {
+        SC_METHOD( fire );
+        dont_initialize();
+        for ( int i = 0; i < num_events; ++i )
+        {
+            sensitive << m_events[i];
+            m_events[i].notify( i + 1, SC_NS );
+        }
+    }
+
+    unsigned next()
+    {
+        m_state = m_state * 1103515245u + 12345u;
+        return ( m_state >> 16 ) & 0x7fff;
+    }
+
+    void fire()
+    {
+        ++m_triggers;
+        sc_event& renewed = m_events[next() % num_events];
+        renewed.cancel();
+        renewed.notify( next() % 17 + 1, SC_NS );
+        m_events[next() % num_events].notify( next() % 23 + 1, SC_NS );
+    }
+
+    unsigned        m_state;
+    unsigned long   m_triggers;
+    sc_event        m_events[num_events];
+};
+
+struct simulation
+{
+    unsigned        seed;
+    unsigned long   triggers;
+    unsigned        state;
+    sc_time         end;
+    int             verbosity;
+
+    // the body of each host thread
+    void run()
+    {
+        verbosity = sc_report_handler::get_verbosity_level();
+        sc_simcontext* simc = new sc_simcontext;
+        sc_simcontext* prev = sc_set_curr_simcontext( simc );
+
+        churn* top = new churn( "top", seed );
+        sc_start( 200, SC_US );
+        triggers = top->m_triggers;
+        state = top->m_state;
+        end = sc_time_stamp();
+
+        delete top;
+        delete simc;
+        sc_set_curr_simcontext( prev );
+    }
+
+    static void* main( void* p )
+    {
+        static_cast<simulation*>( p )->run();
+        return 0;
+    }
+};
+
+int sc_main( int, char*[] )
+{
+    const int num_simulations = 4;
+    simulation sims[num_simulations];
+    for ( int i = 0; i < num_simulations; ++i )
+        sims[i].seed = 1 + i * 7919;
+    sc_report_handler::set_verbosity_level( SC_HIGH );
+
+#if defined(CONCURRENT_CONTEXTS_STD_THREADS)
+    std::thread threads[num_simulations];
+    for ( int i = 0; i < num_simulations; ++i )
+        threads[i] = std::thread( &simulation::run, &sims[i] );
+    for ( int i = 0; i < num_simulations; ++i )
+        threads[i].join();
+#elif defined(CONCURRENT_CONTEXTS_PTHREADS)
+    pthread_t threads[num_simulations];
+    for ( int i = 0; i < num_simulations; ++i )
+        pthread_create( &threads[i], 0, &simulation::main, &sims[i] );
+    for ( int i = 0; i < num_simulations; ++i )
+        pthread_join( threads[i], 0 );
+#else
+    for ( int i = 0; i < num_simulations; ++i )
+        sims[i].run();
+#endif
+
+    for ( int i = 0; i < num_simulations; ++i )
+        cout << "simulation " << i + 1 << ": " << sims[i].triggers
+             << " triggers, state " << sims[i].state << " at "
+             << sims[i].end << ", verbosity " << sims[i].verbosity << endl;
+
+    // the same simulation once more on this thread must agree
+    simulation check = sims[num_simulations - 1];
+    check.run();
+    cout << "rerun " << ( check.triggers == sims[num_simulations - 1].triggers
+                          && check.state == sims[num_simulations - 1].state
+                          ? "agrees" : "differs" ) << endl;
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  context_cleanup.cpp -- Regression test of deleting a simulation context
+                         with pending timed notifications.
+
+                         Each round creates a simulation context, runs it
+                         for a while and deletes it again, while a thread
+                         waits on a timeout, a method waits on a timed
+                         next_trigger() and an event has a pending timed
+                         notification. The processes cancel their
+                         notifications when the context deletes them,
+                         which must happen before the timed notification
+                         queue of the context is deleted.
+
+                         In the first round the module is deleted before
+                         the context, in the second round the context
+                         deletes the processes of the remaining module.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+SC_MODULE( ticker )
+{
+    SC_CTOR( ticker ) : m_ticks( 0 ), m_triggers( 0 )
+    {
+        SC_THREAD( tick );
+        SC_METHOD( trigger );
+        m_alarm.notify( 1, SC_US );
+    }
+
+    void tick()
+    {
+        for ( ;; )
+        {
+            wait( 100, SC_NS );
+            ++m_ticks;
+        }
+    }
+
+    void trigger()
+    {
+        ++m_triggers;
+        next_trigger( 30, SC_NS );
+    }
+
+    int      m_ticks;
+    int      m_triggers;
+    sc_event m_alarm;
+};
+
+int sc_main( int, char*[] )
+{
+    for ( int round = 1; round <= 2; ++round )
+    {
+        sc_simcontext* simc = new sc_simcontext;
+        sc_simcontext* prev = sc_set_curr_simcontext( simc );
+
+        ticker* top = new ticker( "top" );
+        sc_start( 250, SC_NS );
+        cout << "round " << round << ": " << top->m_ticks << " ticks, "
+             << top->m_triggers << " triggers at " << sc_time_stamp()
+             << endl;
+
+        if ( round == 1 )
+            delete top;
+        delete simc;
+        sc_set_curr_simcontext( prev );
+    }
+    cout << "contexts deleted" << endl;
+    return 0;
+}
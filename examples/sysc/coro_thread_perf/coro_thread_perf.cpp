@@ -0,0 +1,194 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  coro_thread_perf.cpp -- Benchmark of coroutine processes.
+
+                     A large number of worker processes are statically
+                     sensitive to a common tick event, which is notified
+                     every nanosecond.  Whenever a worker is triggered,
+                     it advances a pseudo-random sequence kept in a local
+                     variable and adds it to its result.  Every 16th
+                     activation, a worker waits for a short timeout
+                     instead of the next tick.
+
+                     The workload is simulated twice for the same amount
+                     of time, first with thread processes, which switch
+                     between their own stacks (sc_cor_qt by default),
+                     then with coroutine processes (see SC_CORO_THREAD),
+                     whose state is kept in a heap-allocated coroutine
+                     frame.  The number of activations and the host CPU
+                     time of both phases are displayed.  The coroutine
+                     phase is skipped unless the example is compiled
+                     with C++20 coroutine support.
+
+                     The number of workers and the simulated time per
+                     phase (in ns) can be set via command line arguments.
+                     By default, 10000 workers are simulated for 1000 ns.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <ctime>
+#include <vector>
+
+class workers : public sc_module
+{
+public:
+
+    enum kind { THREADS, COROUTINES };
+
+    SC_HAS_PROCESS(workers);
+
+    workers( sc_module_name name, kind k, int n )
+      : sc_module(name), m_tick(), m_results(n), m_activations(0)
+    {
+        for ( int i = 0; i < n; i++ )
+        {
+            sc_spawn_options opts;
+            opts.dont_initialize();
+            opts.set_sensitivity( &m_tick );
+#if defined(SC_HAS_COROUTINES_)
+            if ( k == COROUTINES )
+            {
+                sc_spawn( [this, i]() { return coro_work( i ); }, 0, &opts );
+                continue;
+            }
+#endif
+            sc_spawn( sc_bind( &workers::thread_work, this, i ), 0, &opts );
+        }
+    }
+
+    sc_event& tick() { return m_tick; }
+
+    unsigned long activations() const { return m_activations; }
+
+protected:
+
+    void thread_work( int i )
+    {
+        unsigned s = 12345u + 7919u * i;
+        for ( unsigned count = 1;; count++ )
+        {
+            s = s * 1103515245u + 12345u;
+            m_results[i] += s >> 16;
+            m_activations++;
+            if ( count % 16 == 0 )
+                wait( sc_time( 500, SC_PS ) );
+            else
+                wait();
+        }
+    }
+
+#if defined(SC_HAS_COROUTINES_)
+    sc_coro_thread coro_work( int i )
+    {
+        unsigned s = 12345u + 7919u * i;
+        for ( unsigned count = 1;; count++ )
+        {
+            s = s * 1103515245u + 12345u;
+            m_results[i] += s >> 16;
+            m_activations++;
+            if ( count % 16 == 0 )
+                co_await sc_co_wait( sc_time( 500, SC_PS ) );
+            else
+                co_await sc_co_wait();
+        }
+    }
+#endif
+
+    sc_event               m_tick;
+    std::vector<unsigned>  m_results;
+    unsigned long          m_activations;
+};
+
+SC_MODULE(ticker)
+{
+    SC_CTOR(ticker)
+      : m_target(0)
+    {
+        SC_METHOD(tick);
+    }
+
+    void tick()
+    {
+        if ( m_target )
+            m_target->notify( SC_ZERO_TIME );
+        next_trigger( 1, SC_NS );
+    }
+
+    sc_event* m_target;
+};
+
+int sc_main (int argc , char *argv[])
+{
+    int n = 10000;
+    int ns = 1000;
+    if ( argc > 1 )
+        n = atoi( argv[1] );
+    if ( argc > 2 )
+        ns = atoi( argv[2] );
+
+    ticker  clk( "clk" );
+    workers threads( "threads", workers::THREADS, n );
+#if defined(SC_HAS_COROUTINES_)
+    workers coroutines( "coroutines", workers::COROUTINES, n );
+    workers* phases[] = { &threads, &coroutines };
+#else
+    workers* phases[] = { &threads, 0 };
+#endif
+    const char* names[] = { "threads", "coroutines" };
+
+    for ( int phase = 0; phase < 2; phase++ )
+    {
+        if ( !phases[phase] )
+        {
+            cout << names[phase] << ": not supported" << endl;
+            continue;
+        }
+        clk.m_target = &phases[phase]->tick();
+
+        std::clock_t start = std::clock();
+        sc_start( ns, SC_NS );
+        double secs = double( std::clock() - start ) / CLOCKS_PER_SEC;
+
+        unsigned long activations = phases[phase]->activations();
+        cout << names[phase] << ": " << activations << " activations in "
+             << secs << " s";
+        if ( activations )
+            cout << " (" << secs * 1e9 / activations << " ns per activation)";
+        cout << endl;
+    }
+    clk.m_target = 0;
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  delta_event_perf.cpp -- Benchmark of the delta notification phase.
+
+                     A large number of method processes are statically
+                     sensitive to a few pseudo-randomly chosen events
+                     each, so that the processes of an event are
+                     scattered over the heap.  Whenever a process is
+                     triggered, it notifies a pseudo-randomly chosen
+                     event for the next delta cycle, so that most events
+                     are notified in each delta cycle.
+
+                     The model is simulated for a number of delta cycles.
+                     The number of triggered processes and the host CPU
+                     time are displayed.  The time per process is
+                     dominated by the accesses to the sensitivity of the
+                     events and to the processes, i.e. by cache misses
+                     (compare e.g. with "perf stat -e cache-misses").
+
+                     The number of processes and of delta cycles can be
+                     set via command line arguments.  By default, 50000
+                     processes are simulated for 200 delta cycles.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <ctime>
+#include <vector>
+
+static const int fanin = 4; // events per process.
+
+class notifiers : public sc_module
+{
+public:
+
+    SC_HAS_PROCESS(notifiers);
+
+    notifiers( sc_module_name name, int n )
+      : sc_module(name), m_events(new sc_event[n]), m_seeds(n),
+        m_triggered(0)
+    {
+        unsigned s = 4711u;
+        for ( int i = 0; i < n; i++ )
+        {
+            m_seeds[i] = 12345u + 7919u * i;
+            sc_spawn_options opts;
+            opts.spawn_method();
+            opts.dont_initialize();
+            for ( int j = 0; j < fanin; j++ )
+            {
+                s = s * 1103515245u + 12345u;
+                opts.set_sensitivity( &m_events[( s >> 8 ) % n] );
+            }
+            sc_spawn( sc_bind( &notifiers::fire, this, i ), 0, &opts );
+        }
+    }
+
+    ~notifiers()
+    {
+        delete [] m_events;
+    }
+
+    void start_of_simulation()
+    {
+        for ( size_t i = 0; i < m_seeds.size(); i += 2 )
+            m_events[i].notify( SC_ZERO_TIME );
+    }
+
+    unsigned long triggered() const { return m_triggered; }
+
+protected:
+
+    void fire( int i )
+    {
+        unsigned& s = m_seeds[i];
+        s = s * 1103515245u + 12345u;
+        m_triggered++;
+        m_events[( s >> 8 ) % m_seeds.size()].notify( SC_ZERO_TIME );
+    }
+
+    sc_event*              m_events;
+    std::vector<unsigned>  m_seeds;
+    unsigned long          m_triggered;
+};
+
+int sc_main (int argc , char *argv[])
+{
+    int n = 50000;
+    int deltas = 200;
+    if ( argc > 1 )
+        n = atoi( argv[1] );
+    if ( argc > 2 )
+        deltas = atoi( argv[2] );
+
+    notifiers top( "top", n );
+    sc_start( SC_ZERO_TIME );
+
+    unsigned long triggered = top.triggered();
+    std::clock_t start = std::clock();
+    for ( int i = 0; i < deltas; i++ )
+        sc_start( SC_ZERO_TIME );
+    double secs = double( std::clock() - start ) / CLOCKS_PER_SEC;
+
+    triggered = top.triggered() - triggered;
+    cout << deltas << " delta cycles: " << triggered
+         << " processes triggered in " << secs << " s";
+    if ( triggered )
+        cout << " (" << secs * 1e9 / triggered << " ns per process)";
+    cout << endl;
+
+    return 0;
+}
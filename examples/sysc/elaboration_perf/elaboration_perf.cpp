@@ -0,0 +1,133 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  elaboration_perf.cpp -- Benchmark of the elaboration of large vectors.
+
+                          A number of node modules each create a vector
+                          of input ports with sc_vector, and bind it to a
+                          vector of signals. A monitor binds a multiport
+                          to every signal. The times taken to construct
+                          the hierarchy and to complete the elaboration
+                          (the binding of all ports) are displayed.
+
+                          The elements of the vectors are named without
+                          calling sc_gen_unique_name for each of them,
+                          and duplicate bindings of the multiport are
+                          checked once at the end of elaboration, so the
+                          time per port does not grow with the size of
+                          the vectors.
+
+                          The number of nodes, the number of ports per
+                          node and the number of signals can be set via
+                          command line arguments. By default, 50 nodes
+                          with 2000 ports each are bound to 20000
+                          signals.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <ctime>
+
+SC_MODULE( node )
+{
+    sc_vector< sc_in<int> > in;
+
+    SC_CTOR( node ) : in( "in" ) {}
+};
+
+SC_MODULE( monitor )
+{
+    sc_port< sc_signal_in_if<int>, 0 > in;
+
+    SC_CTOR( monitor ) : in( "in" ) {}
+};
+
+SC_MODULE( top )
+{
+    sc_vector< sc_signal<int> > sig;
+    sc_vector< node >           nodes;
+    monitor                     mon;
+
+    top( sc_module_name name, int n_nodes, int n_ports, int n_signals )
+      : sc_module( name ), sig( "sig", n_signals ), nodes( "node", n_nodes ),
+        mon( "mon" )
+    {
+        for ( int i = 0; i < n_nodes; i++ )
+        {
+            nodes[i].in.init( n_ports );
+            nodes[i].in.bind( sig );
+        }
+        for ( int i = 0; i < n_signals; i++ )
+            mon.in( sig[i] );
+    }
+};
+
+static double
+seconds_since( std::clock_t start )
+{
+    return double( std::clock() - start ) / CLOCKS_PER_SEC;
+}
+
+int sc_main (int argc , char *argv[])
+{
+    int n_nodes = 50;
+    int n_ports = 2000;
+    int n_signals = 20000;
+    if ( argc > 1 )
+        n_nodes = atoi( argv[1] );
+    if ( argc > 2 )
+        n_ports = atoi( argv[2] );
+    if ( argc > 3 )
+        n_signals = atoi( argv[3] );
+    if ( n_ports > n_signals )
+        n_ports = n_signals;
+
+    std::clock_t start = std::clock();
+    top t( "top", n_nodes, n_ports, n_signals );
+    double construction_secs = seconds_since( start );
+
+    start = std::clock();
+    sc_start( SC_ZERO_TIME );
+    double binding_secs = seconds_since( start );
+
+    cout << "ports:              " << n_nodes * n_ports + 1 << endl;
+    cout << "signals:            " << n_signals << endl;
+    cout << "construction time:  " << construction_secs << " s" << endl;
+    cout << "binding time:       " << binding_secs << " s" << endl;
+    cout << "last port:          "
+         << ( n_nodes > 0 && n_ports > 0
+              ? t.nodes[n_nodes - 1].in[n_ports - 1].name() : "none" )
+         << endl;
+    cout << "monitor binds:      " << t.mon.in.size() << endl;
+
+    return 0;
+}
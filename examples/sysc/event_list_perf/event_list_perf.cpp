@@ -0,0 +1,191 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  event_list_perf.cpp -- Benchmark of waiting on event lists.
+
+                         A number of requester threads each wait on the
+                         OR list of their response and abort events, in
+                         the style of a protocol model, and a responder
+                         method answers each request after a delay. A
+                         method process does the same with next_trigger
+                         on an AND list of two events. The rate of waits
+                         is displayed together with the number of heap
+                         allocations made per wait.
+
+                         The event lists built by event expressions keep
+                         up to four events in the list itself, and the
+                         temporary lists are reused by the process that
+                         waited on them, so that waiting on an event
+                         expression does not allocate.
+
+                         The number of requesters and the number of
+                         requests per requester can be set via command
+                         line arguments. By default, 10 requesters make
+                         200000 requests each.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <cstdlib>
+#include <ctime>
+#include <new>
+
+// count the heap allocations made by the simulation
+
+static unsigned long allocations = 0;
+
+#if SC_CPLUSPLUS >= 201103L
+#  define EVENT_LIST_PERF_THROW_BAD_ALLOC
+#  define EVENT_LIST_PERF_NOTHROW noexcept
+#else
+#  define EVENT_LIST_PERF_THROW_BAD_ALLOC throw( std::bad_alloc )
+#  define EVENT_LIST_PERF_NOTHROW throw()
+#endif
+
+void* operator new( std::size_t size ) EVENT_LIST_PERF_THROW_BAD_ALLOC
+{
+    ++allocations;
+    void* p = std::malloc( size ? size : 1 );
+    if ( !p )
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete( void* p ) EVENT_LIST_PERF_NOTHROW
+{
+    std::free( p );
+}
+
+// the array and sized forms, which C++14 may call instead
+
+void* operator new[]( std::size_t size ) EVENT_LIST_PERF_THROW_BAD_ALLOC
+{
+    return operator new( size );
+}
+
+void operator delete[]( void* p ) EVENT_LIST_PERF_NOTHROW
+{
+    operator delete( p );
+}
+
+void operator delete( void* p, std::size_t ) EVENT_LIST_PERF_NOTHROW
+{
+    operator delete( p );
+}
+
+void operator delete[]( void* p, std::size_t ) EVENT_LIST_PERF_NOTHROW
+{
+    operator delete( p );
+}
+
+SC_MODULE( requester )
+{
+    sc_event request;
+    sc_event response;
+    sc_event abort;
+    sc_event ack_a;
+    sc_event ack_b;
+
+    SC_CTOR( requester ) : m_count( 0 ), m_waits( 0 ), m_joins( 0 )
+    {
+        SC_THREAD( run );
+        SC_METHOD( respond );
+        sensitive << request;
+        dont_initialize();
+        SC_METHOD( join );
+    }
+
+    int           m_count;
+    unsigned long m_waits;
+    unsigned long m_joins;
+
+    // wait for the response or an abort, which never comes
+    void run()
+    {
+        for ( int i = 0; i < m_count; i++ )
+        {
+            request.notify( SC_ZERO_TIME );
+            wait( response | abort );
+            ++m_waits;
+        }
+    }
+
+    void respond()
+    {
+        response.notify( 1, SC_NS );
+        ack_a.notify( 1, SC_NS );
+        ack_b.notify( 2, SC_NS );
+    }
+
+    // wait for both acknowledgements of a request
+    void join()
+    {
+        if ( m_joins < (unsigned long)m_count )
+        {
+            next_trigger( ack_a & ack_b );
+            ++m_joins;
+        }
+    }
+};
+
+int sc_main (int argc , char *argv[])
+{
+    int n = 10;
+    int count = 200000;
+    if ( argc > 1 )
+        n = atoi( argv[1] );
+    if ( argc > 2 )
+        count = atoi( argv[2] );
+
+    sc_vector<requester> r( "r", n );
+    for ( int i = 0; i < n; i++ )
+        r[i].m_count = count;
+
+    sc_start( SC_ZERO_TIME );
+    unsigned long start_allocations = allocations;
+    std::clock_t start = std::clock();
+    sc_start();
+    double secs = double( std::clock() - start ) / CLOCKS_PER_SEC;
+    unsigned long run_allocations = allocations - start_allocations;
+
+    unsigned long waits = 0;
+    for ( int i = 0; i < n; i++ )
+        waits += r[i].m_waits + r[i].m_joins;
+
+    cout << "waits on lists:     " << waits << endl;
+    cout << "simulated time:     " << sc_time_stamp() << endl;
+    cout << "waits per sec.:     " << ( secs > 0 ? waits / secs : 0 ) << endl;
+    cout << "allocations/wait:   "
+         << ( waits ? double( run_allocations ) / waits : 0 ) << endl;
+
+    return 0;
+}
@@ -0,0 +1,209 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  fifo_burst_perf.cpp -- Benchmark of the bulk access to sc_fifo.
+
+                         A producer thread streams a sequence of numbers
+                         through an sc_fifo to a consumer thread, which
+                         sums them. This is done three times: value by
+                         value with write() and read(), in bursts with
+                         write(src, n) and read(dst, n), and in place
+                         with reserve_contiguous()/commit_write() and
+                         peek_contiguous()/commit_read(). The value rate
+                         of each way is displayed.
+
+                         The number of values, the burst size and the
+                         size of the fifo can be set via command line
+                         arguments. By default, 10000000 values are
+                         streamed in bursts of 256 through a fifo of
+                         1024 values.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <ctime>
+#include <iomanip>
+#include <vector>
+
+enum transfer { VALUES, BURSTS, IN_PLACE };
+
+// a producer and a consumer thread streaming count values through a fifo,
+// the first stream starts right away, the others when the previous one is
+// done
+
+SC_MODULE( stream )
+{
+    sc_fifo_out<int> out;
+    sc_fifo_in<int>  in;
+
+    SC_HAS_PROCESS( stream );
+    stream( sc_module_name, transfer mode, int count, int burst, int size )
+      : m_fifo( "fifo", size ), m_mode( mode ), m_count( count ),
+        m_burst( burst ), m_sum( 0 ), m_secs( 0 ), m_next_p( 0 )
+    {
+        out( m_fifo );
+        in( m_fifo );
+        SC_THREAD( produce );
+        SC_THREAD( consume );
+    }
+
+    void produce()
+    {
+        if ( m_mode != VALUES )
+            wait( m_start );
+        m_start_time = std::clock();
+        std::vector<int> buf( m_burst );
+        int i = 0;
+        while ( i < m_count )
+        {
+            int n = std::min( m_burst, m_count - i );
+            switch ( m_mode )
+            {
+            case VALUES:
+                for ( int k = 0; k < n; ++k )
+                    out.write( i++ );
+                break;
+            case BURSTS:
+                for ( int k = 0; k < n; ++k )
+                    buf[k] = i++;
+                out.write( &buf[0], n );
+                break;
+            case IN_PLACE:
+                {
+                    int free;
+                    int* span = out.reserve_contiguous( free );
+                    if ( free == 0 )
+                    {
+                        wait( out.data_read_event() );
+                        break;
+                    }
+                    n = std::min( n, free );
+                    for ( int k = 0; k < n; ++k )
+                        span[k] = i++;
+                    out.commit_write( n );
+                }
+                break;
+            }
+        }
+    }
+
+    void consume()
+    {
+        if ( m_mode != VALUES )
+            wait( m_start );
+        std::vector<int> buf( m_burst );
+        int i = 0;
+        while ( i < m_count )
+        {
+            int n = std::min( m_burst, m_count - i );
+            switch ( m_mode )
+            {
+            case VALUES:
+                for ( int k = 0; k < n; ++k )
+                    m_sum += in.read();
+                break;
+            case BURSTS:
+                in.read( &buf[0], n );
+                for ( int k = 0; k < n; ++k )
+                    m_sum += buf[k];
+                break;
+            case IN_PLACE:
+                {
+                    int available;
+                    const int* span = in.peek_contiguous( available );
+                    if ( available == 0 )
+                    {
+                        wait( in.data_written_event() );
+                        n = 0;
+                        break;
+                    }
+                    n = std::min( n, available );
+                    for ( int k = 0; k < n; ++k )
+                        m_sum += span[k];
+                    in.commit_read( n );
+                }
+                break;
+            }
+            i += n;
+        }
+        m_secs = double( std::clock() - m_start_time ) / CLOCKS_PER_SEC;
+        if ( m_next_p )
+            m_next_p->m_start.notify( SC_ZERO_TIME );
+    }
+
+    sc_fifo<int>  m_fifo;
+    transfer      m_mode;
+    int           m_count;
+    int           m_burst;
+    sc_dt::uint64 m_sum;
+    double        m_secs;
+    std::clock_t  m_start_time;
+    stream*       m_next_p;
+    sc_event      m_start;
+};
+
+int sc_main (int argc , char *argv[])
+{
+    int count = 10000000;
+    int burst = 256;
+    int size = 1024;
+    if ( argc > 1 )
+        count = atoi( argv[1] );
+    if ( argc > 2 )
+        burst = atoi( argv[2] );
+    if ( argc > 3 )
+        size = atoi( argv[3] );
+
+    stream values( "values", VALUES, count, burst, size );
+    stream bursts( "bursts", BURSTS, count, burst, size );
+    stream in_place( "in_place", IN_PLACE, count, burst, size );
+    values.m_next_p = &bursts;
+    bursts.m_next_p = &in_place;
+
+    sc_start();
+
+    sc_dt::uint64 expected = sc_dt::uint64( count ) * ( count - 1 ) / 2;
+    stream* streams[] = { &values, &bursts, &in_place };
+    const char* labels[] = { "values:", "bursts:", "in place:" };
+    bool ok = true;
+    cout << "values per stream:  " << count << endl;
+    for ( int i = 0; i < 3; ++i )
+    {
+        cout << std::left << std::setw( 20 ) << labels[i]
+             << ( streams[i]->m_secs > 0 ? count / streams[i]->m_secs : 0 )
+             << " values/sec." << endl;
+        ok = ok && streams[i]->m_sum == expected;
+    }
+    cout << ( ok ? "all values passed" : "values lost" ) << endl;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,234 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  kernel_profile.cpp -- Regression test of the kernel profiler
+                        (sc_set_kernel_profile).
+
+                        A clocked method and a thread waiting for a fixed
+                        time are simulated until the thread stops the
+                        simulation, once with a CSV and once with a JSON
+                        profile. The files are read back and checked for
+                        their columns, the activations and context switches
+                        of both processes, and the number of delta cycle
+                        samples. These include the delta cycle calling
+                        sc_stop(), which sc_delta_count() leaves out.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+SC_MODULE( top )
+{
+    sc_in<bool> clk;
+
+    SC_CTOR( top )
+      : ticks( 0 )
+    {
+        SC_METHOD( tick );
+        sensitive << clk.pos();
+        dont_initialize();
+
+        SC_THREAD( worker );
+    }
+
+    void tick() { ++ticks; }
+
+    // 10 timed waits, stopping the simulation at 95 ns
+    void worker()
+    {
+        wait( 5, SC_NS );
+        for ( int i = 0; i < 9; ++i )
+            wait( 10, SC_NS );
+        sc_stop();
+    }
+
+    int ticks;
+};
+
+// the activations, context switches and delta count of a profile
+
+struct profile
+{
+    std::string columns;
+    std::string delta_columns;
+    std::string tick;      // activations,switches
+    std::string worker;
+    unsigned    samples;
+    unsigned    deltas;    // summary of the JSON profile.
+};
+
+// the value of a "key": entry of a JSON line, up to the next , or }
+
+static std::string
+json_value( const std::string& line, const std::string& key )
+{
+    std::string::size_type pos = line.find( "\"" + key + "\": " );
+    if ( pos == std::string::npos )
+        return "";
+    pos += key.size() + 4;
+    return line.substr( pos, line.find_first_of( ",}", pos ) - pos );
+}
+
+static void
+read_csv( const char* name, const char* deltas_name, profile& p )
+{
+    std::ifstream in( name );
+    std::getline( in, p.columns );
+    std::string line;
+    while ( std::getline( in, line ) )
+    {
+        // name,kind,activations,switches,host_time
+        std::string::size_type kind = line.find( ',' );
+        std::string::size_type counts = line.find( ',', kind + 1 ) + 1;
+        std::string value =
+            line.substr( counts, line.rfind( ',' ) - counts );
+        if ( line.compare( 0, kind, "top.tick" ) == 0 )
+            p.tick = value;
+        else if ( line.compare( 0, kind, "top.worker" ) == 0 )
+            p.worker = value;
+    }
+
+    std::ifstream deltas_in( deltas_name );
+    std::getline( deltas_in, p.delta_columns );
+    while ( std::getline( deltas_in, line ) )
+        ++p.samples;
+}
+
+static void
+read_json( const char* name, profile& p )
+{
+    std::ifstream in( name );
+    std::string line;
+    bool in_deltas = false;
+    while ( std::getline( in, line ) )
+    {
+        if ( line.find( "\"deltas\": [" ) != std::string::npos )
+            in_deltas = true;
+        else if ( in_deltas && line.find( "{ \"time\": " ) != std::string::npos )
+            ++p.samples;
+        else if ( line.find( "\"deltas\": " ) != std::string::npos )
+            p.deltas = std::atoi( json_value( line, "deltas" ).c_str() );
+        else if ( line.find( "{ \"name\": " ) != std::string::npos )
+        {
+            std::string value = json_value( line, "activations" ) + "," +
+                                json_value( line, "switches" );
+            if ( json_value( line, "name" ) == "\"top.tick\"" )
+                p.tick = value;
+            else if ( json_value( line, "name" ) == "\"top.worker\"" )
+                p.worker = value;
+            if ( p.columns.empty() )
+            {
+                // the keys of the first process entry
+                std::istringstream keys( line );
+                std::string word;
+                while ( keys >> word )
+                    if ( word[0] == '"' && word[word.size() - 1] == ':' )
+                        p.columns += ( p.columns.empty() ? "" : "," ) +
+                                     word.substr( 1, word.size() - 3 );
+            }
+        }
+    }
+}
+
+// simulate the model with the given profile file and read it back
+
+static bool
+run( const char* name )
+{
+    sc_simcontext* simc = new sc_simcontext;
+    sc_simcontext* prev = sc_set_curr_simcontext( simc );
+    sc_set_kernel_profile( name );
+
+    sc_clock* clk = new sc_clock( "clk", 10, SC_NS );
+    top*      t = new top( "top" );
+    t->clk( *clk );
+    sc_start();
+    sc_dt::uint64 deltas = sc_delta_count() + 1;  // including the last one
+    int ticks = t->ticks;
+
+    delete t;
+    delete clk;
+    delete simc;
+    sc_set_curr_simcontext( prev );
+    sc_set_kernel_profile( 0 );
+
+    profile p;
+    p.samples = 0;
+    p.deltas = 0;
+    bool json = std::string( name ).find( ".json" ) != std::string::npos;
+    if ( json )
+    {
+        read_json( name, p );
+        std::remove( name );
+    }
+    else
+    {
+        read_csv( name, "kernel_profile_deltas.csv", p );
+        std::remove( name );
+        std::remove( "kernel_profile_deltas.csv" );
+    }
+
+    std::ostringstream expected_tick;
+    expected_tick << ticks << ",0";
+
+    cout << name << ":" << endl
+         << "  columns:        " << p.columns << endl;
+    if ( !json )
+        cout << "  delta columns:  " << p.delta_columns << endl;
+    cout << "  top.tick:       " << p.tick << endl
+         << "  top.worker:     " << p.worker << endl
+         << "  delta samples:  " << p.samples << endl;
+    if ( json )
+        cout << "  summary deltas: " << p.deltas << endl;
+
+    // the thread runs once initially and after each of its 9 + 1 waits
+    return p.columns == "name,kind,activations,switches,host_time" &&
+           ( json || p.delta_columns == "time,delta,runnable_methods,"
+                                        "runnable_threads,updates,"
+                                        "timed_notifications" ) &&
+           p.tick == expected_tick.str() && p.worker == "11,11" &&
+           p.samples == deltas && ( !json || p.deltas == deltas );
+}
+
+int sc_main( int, char*[] )
+{
+    bool ok = run( "kernel_profile.csv" );
+    ok = run( "kernel_profile.json" ) && ok;
+
+    cout << ( ok ? "profiles agree with the model" : "profiles differ" )
+         << endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,182 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  levelized_methods.cpp -- Regression test of the levelized execution of
+                           method processes (SC_LEVELIZED_METHODS).
+
+                           A two-stage pipeline of clocked methods in one
+                           module, which read their sc_out ports, feeds a
+                           chain of combinational adders. The model is run
+                           with dynamic scheduling and levelized, and both
+                           runs must sample the same values, while the
+                           levelized run settles the adders in fewer delta
+                           cycles.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+#include <sstream>
+
+// two clocked stages, the second one declared first and reading the
+// output port of the first one, so it must see the previous value
+
+SC_MODULE( pipeline )
+{
+    sc_in<bool> clk;
+    sc_out<int> q;
+    sc_out<int> r;
+
+    SC_CTOR( pipeline )
+      : n( 0 )
+    {
+        SC_METHOD( stage2 );
+        sensitive << clk.pos();
+        dont_initialize();
+
+        SC_METHOD( stage1 );
+        sensitive << clk.pos();
+        dont_initialize();
+    }
+
+    void stage1() { q.write( ++n ); }
+    void stage2() { r.write( q.read() ); }
+
+    int n;
+};
+
+// a combinational stage of the adder chain
+
+SC_MODULE( adder )
+{
+    sc_in<int>  in;
+    sc_out<int> out;
+
+    SC_CTOR( adder )
+    {
+        SC_METHOD( add );
+        sensitive << in;
+    }
+
+    void add() { out.write( in.read() + 10 ); }
+};
+
+// samples the pipeline and the end of the chain at the falling edges,
+// the output q of the first stage is only read by the second one
+
+SC_MODULE( monitor )
+{
+    sc_in<bool> clk;
+    sc_in<int>  r;
+    sc_in<int>  sum;
+
+    SC_CTOR( monitor )
+    {
+        SC_METHOD( sample );
+        sensitive << clk.neg();
+        dont_initialize();
+    }
+
+    void sample()
+    {
+        log << sc_time_stamp() << ": r " << r.read() << ", sum " << sum.read()
+            << endl;
+    }
+
+    std::ostringstream log;
+};
+
+// the clock is created outside, its edge methods would otherwise belong
+// to the testbench, which would then not count as combinational
+
+SC_MODULE( testbench )
+{
+    sc_in<bool>     clk;
+    sc_signal<int>  q, r, c1, c2, sum;
+    pipeline        pipe;
+    adder           add1, add2, add3;
+    monitor         mon;
+
+    SC_CTOR( testbench )
+      : clk( "clk" ),
+        q( "q" ), r( "r" ), c1( "c1" ), c2( "c2" ), sum( "sum" ),
+        pipe( "pipe" ), add1( "add1" ), add2( "add2" ), add3( "add3" ),
+        mon( "mon" )
+    {
+        pipe.clk( clk );
+        pipe.q( q );
+        pipe.r( r );
+        add1.in( q );
+        add1.out( c1 );
+        add2.in( c1 );
+        add2.out( c2 );
+        add3.in( c2 );
+        add3.out( sum );
+        mon.clk( clk );
+        mon.r( r );
+        mon.sum( sum );
+    }
+};
+
+// run the model for 50 ns in a context of its own
+
+static std::string
+run( bool levelized )
+{
+    sc_simcontext* simc = new sc_simcontext;
+    sc_simcontext* prev = sc_set_curr_simcontext( simc );
+    sc_set_levelized_methods( levelized );
+
+    sc_clock*  clk = new sc_clock( "clk", 10, SC_NS );
+    testbench* tb = new testbench( "tb" );
+    tb->clk( *clk );
+    sc_start( 50, SC_NS );
+
+    std::string result = tb->mon.log.str();
+    cout << ( levelized ? "levelized" : "dynamic" ) << " scheduling, "
+         << sc_delta_count() << " delta cycles" << endl << result;
+
+    delete tb;
+    delete clk;
+    delete simc;
+    sc_set_curr_simcontext( prev );
+    return result;
+}
+
+int sc_main( int, char*[] )
+{
+    std::string dynamic = run( false );
+    std::string levelized = run( true );
+
+    cout << "levelized run " << ( levelized == dynamic ? "agrees" : "differs" )
+         << endl;
+    return levelized == dynamic ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  object_lookup_perf.cpp -- Benchmark of the object hierarchy lookup.
+
+                            A hierarchy of modules is elaborated, each
+                            containing a number of signals and ports, and
+                            every object of the hierarchy is then looked
+                            up by its full name with sc_find_object().
+                            Finally the hierarchy is deleted again.
+
+                            The times taken for elaboration, lookup and
+                            deletion are displayed. With the hashed
+                            instance table of the object manager, the
+                            lookup time per object does not grow with the
+                            size of the hierarchy.
+
+                            The number of modules and the number of
+                            signals per module can be set via command
+                            line arguments. By default, 2000 modules with
+                            50 signals each are elaborated.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <vector>
+
+SC_MODULE( leaf )
+{
+    sc_in<int>  in;
+    sc_out<int> out;
+
+    SC_CTOR( leaf ) {}
+};
+
+class cluster : public sc_module
+{
+public:
+
+    cluster( sc_module_name name, int n )
+      : sc_module( name ), m_signals( n ), m_leaf( "leaf" )
+    {
+        char signal_name[32];
+        for ( int i = 0; i < n; i++ )
+        {
+            std::sprintf( signal_name, "sig_%d", i );
+            m_signals[i] = new sc_signal<int>( signal_name );
+        }
+        m_leaf.in( *m_signals[0] );
+        m_leaf.out( *m_signals[n - 1] );
+    }
+
+    ~cluster()
+    {
+        for ( size_t i = 0; i < m_signals.size(); i++ )
+            delete m_signals[i];
+    }
+
+private:
+
+    std::vector<sc_signal<int>*> m_signals;
+    leaf                         m_leaf;
+};
+
+// collect the names of object_p and its descendants
+
+static void
+collect_names( const sc_object* object_p, std::vector<std::string>& names )
+{
+    names.push_back( object_p->name() );
+    const std::vector<sc_object*>& children = object_p->get_child_objects();
+    for ( size_t i = 0; i < children.size(); i++ )
+        collect_names( children[i], names );
+}
+
+static double
+seconds_since( std::clock_t start )
+{
+    return double( std::clock() - start ) / CLOCKS_PER_SEC;
+}
+
+int sc_main (int argc , char *argv[])
+{
+    int modules = 2000;
+    int signals = 50;
+    if ( argc > 1 )
+        modules = atoi( argv[1] );
+    if ( argc > 2 )
+        signals = atoi( argv[2] );
+    if ( signals < 1 )
+        signals = 1;
+
+    std::clock_t start = std::clock();
+    std::vector<cluster*> clusters( modules );
+    char module_name[32];
+    for ( int i = 0; i < modules; i++ )
+    {
+        std::sprintf( module_name, "cluster_%d", i );
+        clusters[i] = new cluster( module_name, signals );
+    }
+    double elaboration_secs = seconds_since( start );
+
+    std::vector<std::string> names;
+    for ( int i = 0; i < modules; i++ )
+        collect_names( clusters[i], names );
+
+    start = std::clock();
+    size_t found = 0;
+    for ( int pass = 0; pass < 10; pass++ )
+        for ( size_t i = 0; i < names.size(); i++ )
+            if ( sc_find_object( names[i].c_str() ) )
+                found++;
+    double lookup_secs = seconds_since( start );
+
+    start = std::clock();
+    for ( int i = 0; i < modules; i++ )
+        delete clusters[i];
+    double deletion_secs = seconds_since( start );
+
+    size_t lookups = 10 * names.size();
+    cout << "objects:            " << names.size() << endl;
+    cout << "elaboration time:   " << elaboration_secs << " s" << endl;
+    cout << "lookup time:        " << lookup_secs << " s" << endl;
+    cout << "lookups per sec.:   "
+         << ( lookup_secs > 0 ? lookups / lookup_secs : 0 ) << endl;
+    cout << "deletion time:      " << deletion_secs << " s" << endl;
+    cout << ( found == lookups ? "all objects found" : "objects missing" )
+         << endl;
+    cout << ( sc_get_top_level_objects().empty()
+              ? "hierarchy deleted" : "objects left" ) << endl;
+
+    return 0;
+}
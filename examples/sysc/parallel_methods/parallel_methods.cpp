@@ -0,0 +1,223 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  parallel_methods.cpp -- Regression test of the parallel evaluation of
+                          method processes (SC_PARALLEL_EVALUATION).
+
+                          Four lanes of clocked and combinational methods
+                          share a clock and a step signal, which they only
+                          read through sc_in ports, so each lane becomes a
+                          partition of its own. A checker reads all lanes
+                          and the stimulus is placed in a declared
+                          partition. The model is run sequentially and with
+                          four host threads, and both runs must sample the
+                          same values.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+#include <sstream>
+
+const int lanes = 4;
+
+// changes the step of all lanes at every falling edge
+
+SC_MODULE( stimulus )
+{
+    sc_in<bool> clk;
+    sc_out<int> step;
+
+    SC_CTOR( stimulus )
+      : n( 0 )
+    {
+        SC_METHOD( drive );
+        sensitive << clk.neg();
+        set_partition( 7 );
+    }
+
+    void drive() { step.write( ++n % 3 + 1 ); }
+
+    int n;
+};
+
+// a counter, which accumulates its own output through an sc_inout port,
+// and a combinational stage scaling the count
+
+SC_MODULE( lane )
+{
+    sc_in<bool>   clk;
+    sc_in<int>    step;
+    sc_inout<int> count;
+    sc_out<int>   scaled;
+
+    SC_CTOR( lane )
+      : factor( 1 )
+    {
+        SC_METHOD( tick );
+        sensitive << clk.pos();
+        dont_initialize();
+
+        SC_METHOD( scale );
+        sensitive << count;
+    }
+
+    void tick()  { count.write( count.read() + step.read() ); }
+    void scale() { scaled.write( count.read() * factor ); }
+
+    int factor;
+};
+
+// sums up the scaled counts of all lanes
+
+SC_MODULE( checker )
+{
+    sc_in<int>  scaled[lanes];
+    sc_out<int> total;
+
+    SC_CTOR( checker )
+    {
+        SC_METHOD( sum );
+        for ( int i = 0; i < lanes; ++i )
+            sensitive << scaled[i];
+    }
+
+    void sum()
+    {
+        int s = 0;
+        for ( int i = 0; i < lanes; ++i )
+            s += scaled[i].read();
+        total.write( s );
+    }
+};
+
+SC_MODULE( monitor )
+{
+    sc_in<bool> clk;
+    sc_in<int>  scaled[lanes];
+    sc_in<int>  total;
+
+    SC_CTOR( monitor )
+    {
+        SC_METHOD( sample );
+        sensitive << clk.neg();
+        dont_initialize();
+    }
+
+    void sample()
+    {
+        log << sc_time_stamp() << ":";
+        for ( int i = 0; i < lanes; ++i )
+            log << " " << scaled[i].read();
+        log << ", total " << total.read() << endl;
+    }
+
+    std::ostringstream log;
+};
+
+// the clock is created outside, its edge methods would otherwise join
+// the partition of the testbench
+
+SC_MODULE( testbench )
+{
+    sc_in<bool>     clk;
+    sc_signal<int>  step, total;
+    sc_signal<int>  count[lanes], scaled[lanes];
+    stimulus        stim;
+    lane*           lane_p[lanes];
+    checker         check;
+    monitor         mon;
+
+    SC_CTOR( testbench )
+      : clk( "clk" ), step( "step" ), total( "total" ),
+        stim( "stim" ), check( "check" ), mon( "mon" )
+    {
+        stim.clk( clk );
+        stim.step( step );
+        for ( int i = 0; i < lanes; ++i )
+        {
+            std::ostringstream name;
+            name << "lane_" << i;
+            lane_p[i] = new lane( name.str().c_str() );
+            lane_p[i]->factor = i + 1;
+            lane_p[i]->clk( clk );
+            lane_p[i]->step( step );
+            lane_p[i]->count( count[i] );
+            lane_p[i]->scaled( scaled[i] );
+            check.scaled[i]( scaled[i] );
+            mon.scaled[i]( scaled[i] );
+        }
+        check.total( total );
+        mon.clk( clk );
+        mon.total( total );
+    }
+
+    ~testbench()
+    {
+        for ( int i = 0; i < lanes; ++i )
+            delete lane_p[i];
+    }
+};
+
+// run the model for 60 ns in a context of its own
+
+static std::string
+run( unsigned workers )
+{
+    sc_simcontext* simc = new sc_simcontext;
+    sc_simcontext* prev = sc_set_curr_simcontext( simc );
+    sc_set_parallel_evaluation( workers );
+
+    sc_clock*  clk = new sc_clock( "clk", 10, SC_NS );
+    testbench* tb = new testbench( "tb" );
+    tb->clk( *clk );
+    sc_start( 60, SC_NS );
+
+    std::string result = tb->mon.log.str();
+    cout << ( workers > 1 ? "parallel" : "sequential" ) << " evaluation, "
+         << sc_delta_count() << " delta cycles" << endl << result;
+
+    delete tb;
+    delete clk;
+    delete simc;
+    sc_set_curr_simcontext( prev );
+    return result;
+}
+
+int sc_main( int, char*[] )
+{
+    std::string sequential = run( 1 );
+    std::string parallel = run( 4 );
+
+    cout << "parallel run "
+         << ( parallel == sequential ? "agrees" : "differs" ) << endl;
+    return parallel == sequential ? 0 : 1;
+}
@@ -0,0 +1,260 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  pdes_perf.cpp -- Benchmark of a distributed simulation.
+
+                   The model consists of two subsystems, each with a
+                   number of clocked method processes doing some
+                   arithmetic.  Every 10 ns each subsystem sends a
+                   digest of its state to the other one over a
+                   cross-partition channel with a lookahead of 5 ns, and
+                   the received digests feed back into the arithmetic.
+
+                   The model is simulated twice, in separate host
+                   processes: once as a single partition containing both
+                   subsystems, and once as two partitions with one
+                   subsystem each, connected by Unix-domain sockets.
+                   The checksums of the subsystems, which depend on the
+                   exact times the digests are received, must be the
+                   same in both runs.  The wall clock times of the runs
+                   are displayed; on a host with at least two cores the
+                   distributed run should be up to twice as fast.
+
+                   The number of processes per subsystem, the work per
+                   process and the simulated time (in ns) can be set
+                   via command line arguments.  By default, 32 processes
+                   do 500 iterations per clock edge for 2000 ns.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <cstdio>
+#include <ctime>
+#include <vector>
+
+#if !( defined(WIN32) || defined(_WIN32) )
+#  include <sys/time.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+#  define PDES_PERF_FORK 1
+#else
+#  define PDES_PERF_FORK 0
+#endif
+
+class subsystem : public sc_module
+{
+public:
+
+    sc_fifo_out<unsigned> out;
+    sc_fifo_in<unsigned>  in;
+
+    SC_HAS_PROCESS(subsystem);
+
+    subsystem( sc_module_name name, unsigned seed, int n, int work )
+      : sc_module(name), m_clk("clk", 1, SC_NS), m_state(n),
+        m_work(work), m_received(0)
+    {
+        for ( int i = 0; i < n; i++ )
+        {
+            m_state[i] = seed + 7919u * i;
+            sc_spawn_options opts;
+            opts.spawn_method();
+            opts.dont_initialize();
+            opts.set_sensitivity( &m_clk.posedge_event() );
+            sc_spawn( sc_bind( &subsystem::compute, this, i ), 0, &opts );
+        }
+        SC_THREAD(send);
+        SC_THREAD(receive);
+    }
+
+    unsigned checksum() const
+    {
+        unsigned sum = m_received;
+        for ( size_t i = 0; i < m_state.size(); i++ )
+            sum = sum * 31u + m_state[i];
+        return sum;
+    }
+
+protected:
+
+    void compute( int i )
+    {
+        unsigned s = m_state[i] ^ m_received;
+        for ( int k = 0; k < m_work; k++ )
+            s = s * 1103515245u + 12345u;
+        m_state[i] = s;
+    }
+
+    void send()
+    {
+        for ( ;; )
+        {
+            out.write( checksum() );
+            wait( 10, SC_NS );
+        }
+    }
+
+    void receive()
+    {
+        for ( ;; )
+            m_received = m_received * 31u + in.read();
+    }
+
+    sc_clock               m_clk;
+    std::vector<unsigned>  m_state;
+    int                    m_work;
+    unsigned               m_received;
+};
+
+// Simulate the subsystems of partition rank of size partitions and return
+// their checksums (0 for a subsystem of another partition).
+
+static void
+run_partition( int rank, int size, int n, int work, int duration,
+               unsigned checksums[2] )
+{
+    sc_time lookahead( 5, SC_NS );
+    int peer = size - 1 - rank;
+    subsystem* a = 0;
+    subsystem* b = 0;
+    if ( rank == 0 )
+    {
+        a = new subsystem( "a", 12345u, n, work );
+        a->out( *new sc_pdes_outbox<unsigned>( "a_to_b", peer, lookahead ) );
+        a->in( *new sc_pdes_inbox<unsigned>( "a_in", peer, "b_to_a" ) );
+    }
+    if ( rank == size - 1 )
+    {
+        b = new subsystem( "b", 54321u, n, work );
+        b->out( *new sc_pdes_outbox<unsigned>( "b_to_a", 0, lookahead ) );
+        b->in( *new sc_pdes_inbox<unsigned>( "b_in", 0, "a_to_b" ) );
+    }
+    sc_start( duration, SC_NS );
+    checksums[0] = a ? a->checksum() : 0;
+    checksums[1] = b ? b->checksum() : 0;
+}
+
+#if PDES_PERF_FORK
+
+static double
+wall_time()
+{
+    timeval tv;
+    gettimeofday( &tv, 0 );
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+// Run the partitions in child processes, collect their checksums through
+// a pipe and return the elapsed time.
+
+static double
+run_distributed( int size, int n, int work, int duration,
+                 unsigned checksums[2] )
+{
+    char address[64];
+    std::sprintf( address, "/tmp/pdes_perf.%d", int( getpid() ) );
+    int fds[2];
+    if ( pipe( fds ) != 0 )
+        return -1;
+
+    double start = wall_time();
+    for ( int rank = 0; rank < size; rank++ )
+    {
+        if ( fork() == 0 )
+        {
+            close( fds[0] );
+            sc_set_pdes_partition( rank, size, address );
+            unsigned sums[2];
+            run_partition( rank, size, n, work, duration, sums );
+            if ( write( fds[1], sums, sizeof(sums) ) != sizeof(sums) )
+                _exit( 1 );
+            _exit( 0 );
+        }
+    }
+    close( fds[1] );
+
+    checksums[0] = checksums[1] = 0;
+    unsigned sums[2];
+    while ( read( fds[0], sums, sizeof(sums) ) == sizeof(sums) )
+    {
+        checksums[0] |= sums[0];
+        checksums[1] |= sums[1];
+    }
+    close( fds[0] );
+    while ( waitpid( -1, 0, 0 ) > 0 )
+        ;
+    return wall_time() - start;
+}
+
+#endif // PDES_PERF_FORK
+
+int sc_main (int argc , char *argv[])
+{
+    int n = 32;
+    int work = 500;
+    int duration = 2000;
+    if ( argc > 1 )
+        n = atoi( argv[1] );
+    if ( argc > 2 )
+        work = atoi( argv[2] );
+    if ( argc > 3 )
+        duration = atoi( argv[3] );
+
+    unsigned single[2] = { 0, 0 };
+    unsigned distributed[2] = { 0, 0 };
+#if PDES_PERF_FORK
+    double single_secs = run_distributed( 1, n, work, duration, single );
+    double distributed_secs =
+      run_distributed( 2, n, work, duration, distributed );
+#else
+    std::clock_t start = std::clock();
+    run_partition( 0, 1, n, work, duration, single );
+    double single_secs = double( std::clock() - start ) / CLOCKS_PER_SEC;
+    double distributed_secs = 0;
+    distributed[0] = single[0];
+    distributed[1] = single[1];
+    cout << "distributed simulation not supported on this host" << endl;
+#endif
+
+    cout << "1 partition:  " << single_secs << " s" << endl;
+    cout << "2 partitions: " << distributed_secs << " s" << endl;
+    if ( single[0] == distributed[0] && single[1] == distributed[1] )
+        cout << "checksums match: " << hex << single[0] << " " << single[1]
+             << dec << endl;
+    else
+        cout << "checksums differ: " << hex << single[0] << " " << single[1]
+             << " vs. " << distributed[0] << " " << distributed[1]
+             << dec << endl;
+
+    return 0;
+}
@@ -0,0 +1,197 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  shm_perf.cpp -- Benchmark of the shared memory channels.
+
+                  A producer process, standing in for an emulator, writes
+                  a sequence of numbers to a shared memory ring. A thread
+                  of the simulation reads them from an sc_shm_inbox,
+                  doubles them and writes them to an sc_shm_outbox, and a
+                  consumer process reads and sums them. All three
+                  processes run concurrently, the simulation suspends
+                  while it waits for the producer or the consumer, and
+                  ends when the producer closed its ring.
+
+                  The message rate is displayed together with the number
+                  of doorbell wakeups, which are the only system calls
+                  made to pass the messages.
+
+                  The number of messages and the capacity of the rings
+                  can be set via command line arguments. By default,
+                  1000000 messages are passed through rings of 1024
+                  slots.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <cstdio>
+
+#if !( defined(WIN32) || defined(_WIN32) )
+#  include <sys/time.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+#  define SHM_PERF_FORK 1
+#else
+#  define SHM_PERF_FORK 0
+#endif
+
+typedef sc_dt::uint64 message;
+
+SC_MODULE( relay )
+{
+    sc_fifo_in<message>  in;
+    sc_fifo_out<message> out;
+
+    SC_CTOR( relay ) : m_count( 0 )
+    {
+        SC_THREAD( main );
+    }
+
+    message m_count;
+
+    // runs until the producer closed the ring, then the simulation
+    // stops by starvation
+    void main()
+    {
+        for ( ;; )
+        {
+            out.write( 2 * in.read() );
+            if ( ++m_count % 1000 == 0 )
+                wait( 1, SC_NS );
+        }
+    }
+};
+
+#if SHM_PERF_FORK
+
+static double
+wall_time()
+{
+    timeval tv;
+    gettimeofday( &tv, 0 );
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+// the producer process: write count numbers, then close the ring
+
+static int
+produce( const char* name, message count )
+{
+    sc_shm_ring ring;
+    if ( !ring.open( name, 10000 ) )
+        return 1;
+    for ( message i = 0; i < count; ++i )
+        if ( !ring.write( &i, sizeof(i) ) )
+            return 1;
+    ring.close_write();
+    return 0;
+}
+
+// the consumer process: read and sum the numbers until the ring is
+// closed, and check the sum
+
+static int
+consume( const char* name, message count )
+{
+    sc_shm_ring ring;
+    if ( !ring.open( name, 10000 ) )
+        return 1;
+    message sum = 0;
+    message n = 0;
+    message value;
+    std::size_t size = sizeof(value);
+    while ( ring.read( &value, size ) )
+    {
+        sum += value;
+        ++n;
+        size = sizeof(value);
+    }
+    ring.close_read();
+    return n == count && sum == count * ( count - 1 ) ? 0 : 2;
+}
+
+#endif // SHM_PERF_FORK
+
+int sc_main (int argc , char *argv[])
+{
+    message count = 1000000;
+    unsigned capacity = 1024;
+    if ( argc > 1 )
+        count = atoi( argv[1] );
+    if ( argc > 2 )
+        capacity = atoi( argv[2] );
+
+#if SHM_PERF_FORK
+    char in_name[64];
+    char out_name[64];
+    std::sprintf( in_name, "/shm_perf.%d.in", int( getpid() ) );
+    std::sprintf( out_name, "/shm_perf.%d.out", int( getpid() ) );
+
+    sc_shm_inbox<message>  inbox( "inbox", in_name, capacity );
+    sc_shm_outbox<message> outbox( "outbox", out_name, capacity );
+    relay r( "relay" );
+    r.in( inbox );
+    r.out( outbox );
+
+    pid_t producer = fork();
+    if ( producer == 0 )
+        _exit( produce( in_name, count ) );
+    pid_t consumer = fork();
+    if ( consumer == 0 )
+        _exit( consume( out_name, count ) );
+
+    double start = wall_time();
+    sc_start();
+    outbox.close();
+    int producer_status = 0;
+    int consumer_status = 0;
+    waitpid( producer, &producer_status, 0 );
+    waitpid( consumer, &consumer_status, 0 );
+    double secs = wall_time() - start;
+
+    cout << "messages:           " << r.m_count << endl;
+    cout << "simulated time:     " << sc_time_stamp() << endl;
+    cout << "wall clock time:    " << secs << " s" << endl;
+    cout << "messages per sec.:  " << ( secs > 0 ? r.m_count / secs : 0 )
+         << endl;
+    cout << "wakeups by sim.:    "
+         << inbox.ring().wakeups() + outbox.ring().wakeups() << endl;
+    bool ok = WIFEXITED( producer_status ) && !WEXITSTATUS( producer_status )
+           && WIFEXITED( consumer_status ) && !WEXITSTATUS( consumer_status )
+           && r.m_count == count;
+    cout << ( ok ? "all messages passed" : "messages lost" ) << endl;
+    return ok ? 0 : 1;
+#else
+    cout << "shared memory channels not supported on this host" << endl;
+    return 0;
+#endif
+}
@@ -0,0 +1,200 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  signal_bank_perf.cpp -- Benchmark of sc_signal_bank.
+
+                          A wide bus is modelled twice: as a vector of
+                          sc_signal<bool> and as an sc_signal_bank<bool>.
+                          A thread inverts all bits of the bus in each
+                          delta cycle, bit by bit for the vector and with
+                          one vector write for the bank, while a few
+                          methods follow single bits through sc_in<bool>
+                          ports. The construction time and the cycle rate
+                          of each model are displayed.
+
+                          The number of bits and the number of delta
+                          cycles can be set via command line arguments.
+                          By default, a bus of 4096 bits is inverted in
+                          10000 delta cycles.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <ctime>
+#include <iomanip>
+
+enum { TAPS = 4 };
+
+// a method following a single bit of the bus
+
+SC_MODULE( tap )
+{
+    sc_in<bool> in;
+
+    SC_CTOR( tap ) : m_changes( 0 )
+    {
+        SC_METHOD( follow );
+        sensitive << in;
+        dont_initialize();
+    }
+
+    void follow()
+        { ++m_changes; }
+
+    int m_changes;
+};
+
+// the bus, modelled as a vector of signals or as a signal bank, and a
+// thread inverting it in each delta cycle
+
+template <class Bus>
+struct bus_model;
+
+template <>
+struct bus_model< sc_vector< sc_signal<bool> > >
+{
+    static void write( sc_vector< sc_signal<bool> >& bus,
+                       const sc_bv_base&, bool value )
+    {
+        for ( size_t i = 0; i < bus.size(); ++i )
+            bus[i].write( value );
+    }
+
+    static sc_signal_inout_if<bool>& bit( sc_vector< sc_signal<bool> >& bus,
+                                          int i )
+        { return bus[i]; }
+
+    static bool read( sc_vector< sc_signal<bool> >& bus, int i )
+        { return bus[i].read(); }
+};
+
+template <>
+struct bus_model< sc_signal_bank<bool> >
+{
+    static void write( sc_signal_bank<bool>& bus,
+                       const sc_bv_base& value, bool )
+        { bus.write( value ); }
+
+    static sc_signal_inout_if<bool>& bit( sc_signal_bank<bool>& bus, int i )
+        { return bus.bit( i ); }
+
+    static bool read( sc_signal_bank<bool>& bus, int i )
+        { return bus.read( i ); }
+};
+
+template <class Bus>
+SC_MODULE( bench )
+{
+    typedef bus_model<Bus> model;
+
+    Bus             bus;
+    sc_vector<tap>  taps;
+
+    SC_HAS_PROCESS( bench );
+    bench( sc_module_name, int width, int cycles )
+      : bus( "bus", width ), taps( "taps", TAPS )
+      , m_width( width ), m_cycles( cycles ), m_ok( true ), m_secs( 0 )
+      , m_next_p( 0 )
+    {
+        for ( int i = 0; i < TAPS; ++i )
+            taps[i].in( model::bit( bus, i * width / TAPS ) );
+        SC_THREAD( main );
+    }
+
+    void main()
+    {
+        if ( m_next_p == 0 )
+            wait( m_start );
+        sc_bv_base ones( m_width ), zeros( m_width );
+        ones = ~zeros;
+        std::clock_t start = std::clock();
+        for ( int cycle = 0; cycle < m_cycles; ++cycle )
+        {
+            bool value = ( cycle & 1 ) == 0;
+            model::write( bus, value ? ones : zeros, value );
+            wait( SC_ZERO_TIME );
+        }
+        m_secs = double( std::clock() - start ) / CLOCKS_PER_SEC;
+        bool last = ( ( m_cycles - 1 ) & 1 ) == 0;
+        for ( int i = 0; i < m_width; ++i )
+            m_ok = m_ok && model::read( bus, i ) == last;
+        for ( int i = 0; i < TAPS; ++i )
+            m_ok = m_ok && taps[i].m_changes == m_cycles;
+        if ( m_next_p )
+            m_next_p->notify( SC_ZERO_TIME );
+    }
+
+    int       m_width;
+    int       m_cycles;
+    bool      m_ok;
+    double    m_secs;
+    sc_event* m_next_p;
+    sc_event  m_start;
+};
+
+int sc_main (int argc , char *argv[])
+{
+    int width = 4096;
+    int cycles = 10000;
+    if ( argc > 1 )
+        width = atoi( argv[1] );
+    if ( argc > 2 )
+        cycles = atoi( argv[2] );
+
+    std::clock_t start = std::clock();
+    bench< sc_vector< sc_signal<bool> > > signals( "signals", width, cycles );
+    double signals_secs = double( std::clock() - start ) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    bench< sc_signal_bank<bool> > bank( "bank", width, cycles );
+    double bank_secs = double( std::clock() - start ) / CLOCKS_PER_SEC;
+
+    signals.m_next_p = &bank.m_start;
+
+    sc_start();
+
+    cout << "bits:               " << width << endl;
+    cout << std::left << std::setw( 20 ) << "construct signals:"
+         << signals_secs * 1000 << " msec." << endl;
+    cout << std::left << std::setw( 20 ) << "construct bank:"
+         << bank_secs * 1000 << " msec." << endl;
+    cout << std::left << std::setw( 20 ) << "signals:"
+         << ( signals.m_secs > 0 ? cycles / signals.m_secs : 0 )
+         << " cycles/sec." << endl;
+    cout << std::left << std::setw( 20 ) << "bank:"
+         << ( bank.m_secs > 0 ? cycles / bank.m_secs : 0 )
+         << " cycles/sec." << endl;
+    bool ok = signals.m_ok && bank.m_ok;
+    cout << ( ok ? "all bits updated" : "bits lost" ) << endl;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,222 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  signal_footprint_perf.cpp -- Benchmark of the memory footprint and the
+                               update cost of sc_signal<bool>.
+
+                               Three vectors of sc_signal<bool> are built:
+                               one is not watched by any process, one is
+                               watched for value changes, and one is
+                               watched for positive edges. The heap bytes
+                               taken per signal are displayed for each,
+                               including the events created for the
+                               watching process. Then a thread toggles all
+                               signals of each vector in each delta cycle,
+                               and the update rate is displayed.
+
+                               The events of a signal are only created
+                               when requested, and the edge events and the
+                               reset of a bool signal share one record,
+                               which is only allocated when one of them is
+                               requested. Signals without events skip the
+                               notification in their update.
+
+                               The number of signals and the number of
+                               delta cycles can be set via command line
+                               arguments. By default, 20000 signals are
+                               toggled in 40 delta cycles.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <new>
+
+// count the heap bytes in use, each block keeps its size in a header
+
+static std::size_t heap_bytes = 0;
+
+enum { HEADER = 16 };
+
+#if SC_CPLUSPLUS >= 201103L
+#  define SIGNAL_FOOTPRINT_PERF_THROW_BAD_ALLOC
+#  define SIGNAL_FOOTPRINT_PERF_NOTHROW noexcept
+#else
+#  define SIGNAL_FOOTPRINT_PERF_THROW_BAD_ALLOC throw( std::bad_alloc )
+#  define SIGNAL_FOOTPRINT_PERF_NOTHROW throw()
+#endif
+
+void* operator new( std::size_t size ) SIGNAL_FOOTPRINT_PERF_THROW_BAD_ALLOC
+{
+    char* p = static_cast<char*>( std::malloc( size + HEADER ) );
+    if ( !p )
+        throw std::bad_alloc();
+    *reinterpret_cast<std::size_t*>( p ) = size;
+    heap_bytes += size;
+    return p + HEADER;
+}
+
+void operator delete( void* p ) SIGNAL_FOOTPRINT_PERF_NOTHROW
+{
+    if ( !p )
+        return;
+    char* block = static_cast<char*>( p ) - HEADER;
+    heap_bytes -= *reinterpret_cast<std::size_t*>( block );
+    std::free( block );
+}
+
+// the array and sized forms, which C++14 may call instead
+
+void* operator new[]( std::size_t size )
+  SIGNAL_FOOTPRINT_PERF_THROW_BAD_ALLOC
+{
+    return operator new( size );
+}
+
+void operator delete[]( void* p ) SIGNAL_FOOTPRINT_PERF_NOTHROW
+{
+    operator delete( p );
+}
+
+void operator delete( void* p, std::size_t ) SIGNAL_FOOTPRINT_PERF_NOTHROW
+{
+    operator delete( p );
+}
+
+void operator delete[]( void* p, std::size_t ) SIGNAL_FOOTPRINT_PERF_NOTHROW
+{
+    operator delete( p );
+}
+
+enum watch { NONE, VALUE, EDGE };
+
+// a vector of signals, a method watching them, and a thread toggling them,
+// the first vector is toggled right away, the others when the previous one
+// is done
+
+SC_MODULE( bus )
+{
+    sc_vector< sc_signal<bool> > signals;
+
+    SC_HAS_PROCESS( bus );
+    bus( sc_module_name, watch mode, int count, int cycles )
+      : signals( "signals", count )
+      , m_mode( mode ), m_cycles( cycles ), m_triggers( 0 )
+      , m_secs( 0 ), m_next_p( 0 )
+    {
+        if ( mode != NONE )
+        {
+            SC_METHOD( follow );
+            for ( int i = 0; i < count; ++i )
+            {
+                if ( mode == VALUE )
+                    sensitive << signals[i];
+                else
+                    sensitive << signals[i].posedge_event();
+            }
+            dont_initialize();
+        }
+        SC_THREAD( toggle );
+    }
+
+    void follow()
+        { ++m_triggers; }
+
+    void toggle()
+    {
+        if ( m_mode != NONE )
+            wait( m_start );
+        int count = static_cast<int>( signals.size() );
+        std::clock_t start = std::clock();
+        for ( int cycle = 0; cycle < m_cycles; ++cycle )
+        {
+            for ( int i = 0; i < count; ++i )
+                signals[i].write( ( cycle & 1 ) == 0 );
+            wait( SC_ZERO_TIME );
+        }
+        m_secs = double( std::clock() - start ) / CLOCKS_PER_SEC;
+        if ( m_next_p )
+            m_next_p->m_start.notify( SC_ZERO_TIME );
+    }
+
+    watch    m_mode;
+    int      m_cycles;
+    int      m_triggers;
+    double   m_secs;
+    bus*     m_next_p;
+    sc_event m_start;
+};
+
+int sc_main (int argc , char *argv[])
+{
+    int count = 20000;
+    int cycles = 40;
+    if ( argc > 1 )
+        count = atoi( argv[1] );
+    if ( argc > 2 )
+        cycles = atoi( argv[2] );
+
+    const char* names[] = { "unwatched", "value", "edge" };
+    bus* buses[3];
+    std::size_t bytes[3];
+    for ( int i = 0; i < 3; ++i )
+    {
+        std::size_t before = heap_bytes;
+        buses[i] = new bus( names[i], watch( i ), count, cycles );
+        bytes[i] = heap_bytes - before;
+    }
+    buses[0]->m_next_p = buses[1];
+    buses[1]->m_next_p = buses[2];
+
+    sc_start();
+
+    const char* labels[] = { "unwatched:", "value watched:", "edge watched:" };
+    double updates = double( count ) * cycles;
+    bool ok = buses[0]->m_triggers == 0 &&
+              buses[1]->m_triggers == cycles &&
+              buses[2]->m_triggers == ( cycles + 1 ) / 2;
+    cout << "signals per kind:   " << count << endl;
+    cout << "sizeof(signal):     " << sizeof( sc_signal<bool> ) << endl;
+    for ( int i = 0; i < 3; ++i )
+        cout << std::left << std::setw( 20 ) << labels[i]
+             << double( bytes[i] ) / count << " bytes/signal, "
+             << ( buses[i]->m_secs > 0 ? updates / buses[i]->m_secs : 0 )
+             << " updates/sec." << endl;
+    cout << ( ok ? "all edges seen" : "edges lost" ) << endl;
+
+    for ( int i = 0; i < 3; ++i )
+        delete buses[i];
+
+    return ok ? 0 : 1;
+}
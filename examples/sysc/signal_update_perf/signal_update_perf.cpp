@@ -0,0 +1,143 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  signal_update_perf.cpp -- Benchmark of the update phase of sc_signal.
+
+                            A thread writes a new value to each signal of a
+                            vector and waits for the next delta cycle,
+                            where all signals are updated. This is done
+                            with signals of type int and bool, once with
+                            sc_signal<T>, which is updated in batches, and
+                            once with a class derived from sc_signal<T>,
+                            which is updated through the update list of
+                            the simulator. The update rate of each is
+                            displayed.
+
+                            The number of signals and the number of delta
+                            cycles can be set via command line arguments.
+                            By default, 100000 signals are written in 100
+                            delta cycles.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <ctime>
+#include <iomanip>
+
+// a signal derived from sc_signal<T>, which is not updated in batches
+
+template <class T>
+class listed_signal : public sc_signal<T>
+{
+public:
+    explicit listed_signal( const char* name_ ) : sc_signal<T>( name_ ) {}
+};
+
+inline int next_value( int*, int i, int cycle ) { return cycle + i; }
+inline bool next_value( bool*, int i, int cycle ) { return ( cycle + i ) & 1; }
+
+SC_MODULE( writer )
+{
+    sc_vector< sc_signal<int> >      batched_ints;
+    sc_vector< listed_signal<int> >  listed_ints;
+    sc_vector< sc_signal<bool> >     batched_bools;
+    sc_vector< listed_signal<bool> > listed_bools;
+
+    SC_HAS_PROCESS( writer );
+    writer( sc_module_name, int count, int cycles )
+      : batched_ints( "batched_ints", count )
+      , listed_ints( "listed_ints", count )
+      , batched_bools( "batched_bools", count )
+      , listed_bools( "listed_bools", count )
+      , m_cycles( cycles ), m_ok( true )
+    {
+        SC_THREAD( main );
+    }
+
+    // write all signals in each delta cycle, returns the seconds taken
+
+    template <class T, class S>
+    double run( sc_vector<S>& signals )
+    {
+        int count = static_cast<int>( signals.size() );
+        std::clock_t start = std::clock();
+        for ( int cycle = 0; cycle < m_cycles; ++cycle )
+        {
+            for ( int i = 0; i < count; ++i )
+                signals[i].write( next_value( (T*)0, i, cycle ) );
+            wait( SC_ZERO_TIME );
+        }
+        double secs = double( std::clock() - start ) / CLOCKS_PER_SEC;
+        for ( int i = 0; i < count; ++i )
+            m_ok = m_ok && signals[i].read() ==
+                           next_value( (T*)0, i, m_cycles - 1 );
+        return secs;
+    }
+
+    void main()
+    {
+        m_secs[0] = run<int>( batched_ints );
+        m_secs[1] = run<int>( listed_ints );
+        m_secs[2] = run<bool>( batched_bools );
+        m_secs[3] = run<bool>( listed_bools );
+    }
+
+    int    m_cycles;
+    bool   m_ok;
+    double m_secs[4];
+};
+
+int sc_main (int argc , char *argv[])
+{
+    int count = 100000;
+    int cycles = 100;
+    if ( argc > 1 )
+        count = atoi( argv[1] );
+    if ( argc > 2 )
+        cycles = atoi( argv[2] );
+
+    writer w( "writer", count, cycles );
+
+    sc_start();
+
+    double updates = double( count ) * cycles;
+    const char* labels[] = { "batched int:", "listed int:",
+                             "batched bool:", "listed bool:" };
+    cout << "updates per kind:   " << updates << endl;
+    for ( int i = 0; i < 4; ++i )
+        cout << std::left << std::setw( 20 ) << labels[i]
+             << ( w.m_secs[i] > 0 ? updates / w.m_secs[i] : 0 )
+             << " updates/sec." << endl;
+    cout << ( w.m_ok ? "all values updated" : "values lost" ) << endl;
+
+    return w.m_ok ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  stack_pool.cpp -- Regression test of the pool of thread stacks
+                    (sc_get_stack_pool_stats, sc_set_stack_pool_limit).
+
+                    Groups of thread processes are spawned and terminate.
+                    The stacks of the first group are pooled and reused by
+                    the second group. A thread with a larger stack, set
+                    via sc_spawn_options::set_stack_size, gets a size
+                    class of its own. Lowering the limit of the pool frees
+                    the larger stack first, and a limit of 0 frees all of
+                    them. The stacks are only pooled by the QuickThreads
+                    coroutine package.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <iomanip>
+#include "sysc/kernel/sc_stack_pool.h"
+
+const int group = 4;
+
+static void
+worker()
+{
+    wait( 1, SC_NS );
+}
+
+// the change of the statistics since the last call
+
+static sc_stack_pool_stats
+delta( sc_stack_pool_stats& last )
+{
+    sc_stack_pool_stats now = sc_get_stack_pool_stats();
+    sc_stack_pool_stats d = now;
+    d.allocations -= last.allocations;
+    d.reuses -= last.reuses;
+    d.releases -= last.releases;
+    d.frees -= last.frees;
+    last = now;
+    return d;
+}
+
+static void
+print_stats( const char* step, const sc_stack_pool_stats& d )
+{
+    cout << std::left << std::setw( 24 ) << step
+         << "allocations " << d.allocations << ", reuses " << d.reuses
+         << ", releases " << d.releases << ", frees " << d.frees
+         << ", pooled " << d.pooled << endl;
+}
+
+SC_MODULE( top )
+{
+    SC_CTOR( top )
+      : ok( false )
+    {
+        SC_THREAD( main );
+    }
+
+    // spawn n threads with the given stack size (0: default), wait until
+    // they have terminated and been deleted
+    void spawn( int n, int stack_size )
+    {
+        sc_spawn_options opt;
+        if ( stack_size )
+            opt.set_stack_size( stack_size );
+        for ( int i = 0; i < n; ++i )
+            sc_spawn( &worker, 0, &opt );
+        wait( 2, SC_NS );
+    }
+
+    void main()
+    {
+        sc_stack_pool_stats last = sc_get_stack_pool_stats();
+
+        spawn( group, 0 );
+        sc_stack_pool_stats first = delta( last );
+        print_stats( "first group:", first );
+
+        spawn( group, 0 );
+        sc_stack_pool_stats second = delta( last );
+        print_stats( "second group:", second );
+        std::size_t small_bytes = last.pooled_bytes;
+
+        spawn( 1, 1024 * 1024 );
+        sc_stack_pool_stats large = delta( last );
+        print_stats( "larger stack:", large );
+        std::size_t large_bytes = last.pooled_bytes - small_bytes;
+
+        sc_set_stack_pool_limit( small_bytes );
+        sc_stack_pool_stats trimmed = delta( last );
+        print_stats( "limit without it:", trimmed );
+        bool trimmed_ok = last.pooled_bytes == small_bytes;
+
+        sc_set_stack_pool_limit( 0 );
+        sc_stack_pool_stats emptied = delta( last );
+        print_stats( "limit 0:", emptied );
+        bool emptied_ok = last.pooled_bytes == 0;
+
+        ok = first.allocations == group && first.releases == group &&
+             second.allocations == 0 && second.reuses == group &&
+             second.releases == group &&
+             large.allocations == 1 && large.reuses == 0 &&
+             large.releases == 1 && large_bytes > small_bytes / group &&
+             trimmed.frees == 1 && trimmed_ok &&
+             emptied.frees == group && emptied.pooled == 0 && emptied_ok;
+    }
+
+    bool ok;
+};
+
+int sc_main( int, char*[] )
+{
+    sc_set_stack_pool_limit( 64 * 1024 * 1024 );
+    top t( "top" );
+    sc_start();
+
+    cout << ( t.ok ? "stack pool statistics agree" : "stack pool differs" )
+         << endl;
+    return t.ok ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+
+/*****************************************************************************
+
+  stack_profile.cpp -- Regression test of the stack profiles
+                       (sc_set_stack_profile, sc_set_stack_sizes).
+
+                       A thread using about 32 KiB of a 256 KiB stack and
+                       a thread using little of the default stack are run
+                       once writing a stack profile. A second run reloads
+                       the profile with sc_set_stack_sizes and writes a
+                       profile again, which must show the stack sizes
+                       derived from the measured peak usage (1.25 times
+                       the usage plus 16 KiB), large enough for the new
+                       peak usage. The peak usage is only measured with
+                       the QuickThreads coroutine package.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+
+// stack size and peak usage of a thread process
+
+struct stack_entry
+{
+    unsigned long size;
+    unsigned long usage;
+};
+
+typedef std::map<std::string, stack_entry> stack_map;
+
+// fills a buffer on the stack, which the compiler may not remove
+
+static int
+use_stack( int depth )
+{
+    volatile char buffer[4096];
+    for ( std::size_t i = 0; i < sizeof( buffer ); ++i )
+        buffer[i] = static_cast<char>( i + depth );
+    return depth == 0 ? buffer[depth]
+                      : use_stack( depth - 1 ) + buffer[depth];
+}
+
+SC_MODULE( top )
+{
+    SC_CTOR( top )
+    {
+        SC_THREAD( deep );
+        set_stack_size( 256 * 1024 );
+        SC_THREAD( shallow );
+    }
+
+    void deep()
+    {
+        wait( 1, SC_NS );
+        sum = use_stack( 7 );
+    }
+
+    void shallow()
+    {
+        wait( 2, SC_NS );
+        sc_stop();
+    }
+
+    int sum;
+};
+
+// the file holds a header line and a line "name,stack_size,peak_usage"
+// per thread process
+
+static stack_map
+read_profile( const char* name )
+{
+    stack_map result;
+    std::ifstream in( name );
+    std::string line;
+    std::getline( in, line );
+    while ( std::getline( in, line ) )
+    {
+        std::string::size_type usage_pos = line.rfind( ',' );
+        std::string::size_type size_pos = line.rfind( ',', usage_pos - 1 );
+        stack_entry& entry = result[line.substr( 0, size_pos )];
+        entry.size = std::strtoul( line.c_str() + size_pos + 1, 0, 10 );
+        entry.usage = std::strtoul( line.c_str() + usage_pos + 1, 0, 10 );
+    }
+    return result;
+}
+
+// simulate the model with the given stack profile settings
+
+static stack_map
+run( const char* profile, const char* sizes )
+{
+    sc_simcontext* simc = new sc_simcontext;
+    sc_simcontext* prev = sc_set_curr_simcontext( simc );
+    sc_set_stack_profile( profile );
+    sc_set_stack_sizes( sizes );
+
+    top* t = new top( "top" );
+    sc_start();
+
+    delete t;
+    delete simc;
+    sc_set_curr_simcontext( prev );
+    sc_set_stack_profile( 0 );
+    sc_set_stack_sizes( 0 );
+
+    return read_profile( profile );
+}
+
+int sc_main( int, char*[] )
+{
+    stack_map measured = run( "stack_profile.csv", 0 );
+    stack_map sized = run( "stack_profile_sized.csv", "stack_profile.csv" );
+    std::remove( "stack_profile.csv" );
+    std::remove( "stack_profile_sized.csv" );
+
+    const char* names[] = { "top.deep", "top.shallow" };
+    bool ok = true;
+    for ( int i = 0; i < 2; ++i )
+    {
+        stack_entry before = measured[names[i]];
+        stack_entry after = sized[names[i]];
+        unsigned long expected = before.usage + before.usage / 4 + 16384;
+
+        bool measured_ok = before.usage > 0 && before.usage <= before.size;
+        bool sized_ok = after.size == expected && after.usage > 0 &&
+                        after.usage <= after.size;
+        cout << names[i] << ": peak usage "
+             << ( measured_ok ? "measured" : "not measured" )
+             << ", stack "
+             << ( sized_ok ? "sized from it" : "not sized from it" ) << endl;
+        ok = ok && measured_ok && sized_ok;
+    }
+
+    // the buffers of use_stack take 32 KiB of the 256 KiB stack
+    stack_entry deep = sized["top.deep"];
+    bool deep_ok = measured["top.deep"].usage >= 32 * 1024 &&
+                   deep.size < measured["top.deep"].size;
+    cout << "top.deep: stack "
+         << ( deep_ok ? "shrunk" : "not shrunk" ) << endl;
+
+    ok = ok && deep_ok;
+    cout << ( ok ? "stack sizes agree with the profile"
+                 : "stack sizes differ" ) << endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  timed_event_perf.cpp -- Benchmark of the timed notification queue.
+
+                     A large number of method processes keep one timed
+                     notification each pending.  Each process re-notifies
+                     its event with a pseudo-random delay whenever it is
+                     triggered.  For nine out of ten processes, the
+                     delays are in the range of 1 to 1000 ns.  The
+                     remaining processes use delays in the range of
+                     1 to 10 ms, i.e. their notifications end up in the
+                     far tail of the queue.
+
+                     The model is simulated twice for the same amount of
+                     time, first with the timed notifications kept in a
+                     binary heap, then with the near-future notifications
+                     kept in a timing wheel (see sc_set_timing_wheel).
+                     The number of triggered processes and the host CPU
+                     time of both phases are displayed.
+
+                     The number of processes and the simulated time per
+                     phase (in us) can be set via command line arguments.
+                     By default, 20000 processes are simulated for 50 us.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+#include <systemc.h>
+
+#include <ctime>
+#include <vector>
+
+class notifiers : public sc_module
+{
+public:
+
+    SC_HAS_PROCESS(notifiers);
+
+    notifiers( sc_module_name name, int n )
+      : sc_module(name), m_events(new sc_event[n]), m_seeds(n), m_triggered(0)
+    {
+        for ( int i = 0; i < n; i++ )
+        {
+            m_seeds[i] = 12345u + 7919u * i;
+            sc_spawn_options opts;
+            opts.spawn_method();
+            opts.dont_initialize();
+            opts.set_sensitivity( &m_events[i] );
+            sc_spawn( sc_bind( &notifiers::fire, this, i ), 0, &opts );
+        }
+    }
+
+    ~notifiers()
+    {
+        delete [] m_events;
+    }
+
+    void start_of_simulation()
+    {
+        for ( size_t i = 0; i < m_seeds.size(); i++ )
+            m_events[i].notify( next_delay( i ) );
+    }
+
+    unsigned long triggered() const { return m_triggered; }
+
+protected:
+
+    void fire( int i )
+    {
+        m_triggered++;
+        m_events[i].notify( next_delay( i ) );
+    }
+
+    sc_time next_delay( size_t i )
+    {
+        unsigned& s = m_seeds[i];
+        s = s * 1103515245u + 12345u;
+        unsigned r = ( s >> 8 ) & 0xffff;
+        if ( i % 10 == 0 )
+            return sc_time( 1 + r % 10000, SC_US );
+        return sc_time( 1 + r % 1000, SC_NS );
+    }
+
+    sc_event*              m_events;
+    std::vector<unsigned>  m_seeds;
+    unsigned long          m_triggered;
+};
+
+int sc_main (int argc , char *argv[])
+{
+    int n = 20000;
+    int us = 50;
+    if ( argc > 1 )
+        n = atoi( argv[1] );
+    if ( argc > 2 )
+        us = atoi( argv[2] );
+
+    notifiers top( "top", n );
+
+    const char* phases[] = { "heap", "timing wheel" };
+    for ( int phase = 0; phase < 2; phase++ )
+    {
+        sc_set_timing_wheel( phase != 0 );
+
+        unsigned long triggered = top.triggered();
+        std::clock_t start = std::clock();
+        sc_start( us, SC_US );
+        double secs = double( std::clock() - start ) / CLOCKS_PER_SEC;
+
+        triggered = top.triggered() - triggered;
+        cout << phases[phase] << ": " << triggered << " triggers in "
+             << secs << " s";
+        if ( triggered )
+            cout << " (" << secs * 1e9 / triggered << " ns per trigger)";
+        cout << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  timed_wait_perf.cpp -- Benchmark of timed waits.
+
+                         A number of loosely timed initiator threads
+                         annotate each transaction with a delay and call
+                         wait(delay), a number of method processes call
+                         next_trigger(delay), and a number of watchdog
+                         threads wait for a response event with a
+                         timeout, wait(timeout, response), where the
+                         response usually comes first and the timeout is
+                         cancelled. The rate of timed waits is displayed.
+
+                         Each process re-arms the timer slot of its
+                         timeout instead of inserting a new notification
+                         whenever the slot is idle or its cancelled
+                         timeout is not later than the new one.
+
+                         The number of processes of each kind and the
+                         simulated time (in us) can be set via command
+                         line arguments. By default, 100 processes of
+                         each kind are simulated for 100 us.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+
+#include <systemc.h>
+
+#include <ctime>
+
+SC_MODULE( initiator )
+{
+    SC_CTOR( initiator ) : m_waits( 0 ), m_triggers( 0 ), m_timeouts( 0 ),
+                           m_seed( 1 )
+    {
+        SC_THREAD( run );
+        SC_METHOD( tick );
+        SC_THREAD( watch );
+        SC_THREAD( respond );
+    }
+
+    unsigned long m_waits;
+    unsigned long m_triggers;
+    unsigned long m_timeouts;
+
+private:
+
+    unsigned delay()
+    {
+        m_seed = m_seed * 1103515245u + 12345u;
+        return 1 + ( m_seed >> 16 ) % 20;
+    }
+
+    // transactions annotated with a delay
+    void run()
+    {
+        for ( ;; )
+        {
+            wait( delay(), SC_NS );
+            ++m_waits;
+        }
+    }
+
+    void tick()
+    {
+        next_trigger( delay(), SC_NS );
+        ++m_triggers;
+    }
+
+    // a request with a watchdog, the response comes within 5 ns
+    void watch()
+    {
+        for ( ;; )
+        {
+            m_request.notify( SC_ZERO_TIME );
+            wait( sc_time( 100, SC_NS ), m_response );
+            if ( !m_response.triggered() )
+                ++m_timeouts;
+            ++m_waits;
+        }
+    }
+
+    void respond()
+    {
+        for ( ;; )
+        {
+            wait( m_request );
+            m_response.notify( 1 + delay() % 5, SC_NS );
+        }
+    }
+
+    sc_event m_request;
+    sc_event m_response;
+    unsigned m_seed;
+};
+
+int sc_main (int argc , char *argv[])
+{
+    int n = 100;
+    int duration = 100;
+    if ( argc > 1 )
+        n = atoi( argv[1] );
+    if ( argc > 2 )
+        duration = atoi( argv[2] );
+
+    sc_vector<initiator> initiators( "initiator", n );
+
+    std::clock_t start = std::clock();
+    sc_start( duration, SC_US );
+    double secs = double( std::clock() - start ) / CLOCKS_PER_SEC;
+
+    unsigned long waits = 0;
+    unsigned long timeouts = 0;
+    for ( int i = 0; i < n; i++ )
+    {
+        waits += initiators[i].m_waits + initiators[i].m_triggers;
+        timeouts += initiators[i].m_timeouts;
+    }
+
+    cout << "timed waits:        " << waits << endl;
+    cout << "watchdog timeouts:  " << timeouts << endl;
+    cout << "simulated time:     " << sc_time_stamp() << endl;
+    cout << "CPU time:           " << secs << " s" << endl;
+    cout << "timed waits/sec.:   " << ( secs > 0 ? waits / secs : 0 ) << endl;
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_async_atomic.h -- Minimal atomic variable shared with host threads.
+
+  Used by the list of pending external updates and by the channels that
+  host threads access directly, e.g. sc_async_fifo<T>.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_ASYNC_ATOMIC_H_INCLUDED_
+#define SC_ASYNC_ATOMIC_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h" // SC_CPLUSPLUS
+
+#if SC_CPLUSPLUS >= 201103L
+#  include <atomic>
+#elif !defined(__GNUC__)
+#  include "sysc/communication/sc_host_mutex.h"
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS TEMPLATE : sc_async_atomic<T>
+//
+//  Minimal atomic variable for data shared with host threads.
+//  Uses C++11 atomics or the GCC builtins, if available, and falls back to
+//  a host mutex otherwise. All operations are sequentially consistent.
+//  FOR INTERNAL USE ONLY!
+// ----------------------------------------------------------------------------
+
+template< typename T >
+class sc_async_atomic
+{
+public:
+    sc_async_atomic() : m_value() {}
+    explicit sc_async_atomic( T v ) : m_value( v ) {}
+
+#if SC_CPLUSPLUS >= 201103L
+
+    T load() const          { return m_value.load(); }
+    void store( T v )       { m_value.store( v ); }
+    T exchange( T v )       { return m_value.exchange( v ); }
+    T fetch_add( T v )      { return m_value.fetch_add( v ); }
+    bool compare_exchange( T& expected, T desired )
+        { return m_value.compare_exchange_weak( expected, desired ); }
+
+private:
+    std::atomic<T> m_value;
+
+#elif defined(__GNUC__)
+
+    T load() const          { return __atomic_load_n( &m_value, __ATOMIC_SEQ_CST ); }
+    void store( T v )       { __atomic_store_n( &m_value, v, __ATOMIC_SEQ_CST ); }
+    T exchange( T v )
+        { return __atomic_exchange_n( &m_value, v, __ATOMIC_SEQ_CST ); }
+    T fetch_add( T v )
+        { return __atomic_fetch_add( &m_value, v, __ATOMIC_SEQ_CST ); }
+    bool compare_exchange( T& expected, T desired )
+        { return __atomic_compare_exchange_n( &m_value, &expected, desired,
+                   true, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ); }
+
+private:
+    T m_value;
+
+#else // not lock-free
+
+    T load() const
+        { sc_scoped_lock lock( m_mutex ); return m_value; }
+    void store( T v )
+        { sc_scoped_lock lock( m_mutex ); m_value = v; }
+    T exchange( T v )
+        { sc_scoped_lock lock( m_mutex ); T old = m_value; m_value = v; return old; }
+    T fetch_add( T v )
+        { sc_scoped_lock lock( m_mutex ); T old = m_value; m_value += v; return old; }
+    bool compare_exchange( T& expected, T desired )
+    {
+        sc_scoped_lock lock( m_mutex );
+        if( m_value != expected ) {
+            expected = m_value;
+            return false;
+        }
+        m_value = desired;
+        return true;
+    }
+
+private:
+    mutable sc_host_mutex m_mutex;
+    T                     m_value;
+
+#endif // SC_CPLUSPLUS
+
+private:
+    // disabled
+    sc_async_atomic( const sc_async_atomic& );
+    sc_async_atomic& operator = ( const sc_async_atomic& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_ASYNC_ATOMIC_H_INCLUDED_
+// Taf!
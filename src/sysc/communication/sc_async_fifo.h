@@ -0,0 +1,508 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_async_fifo.h -- The sc_async_fifo<T> primitive channel class.
+
+  A fifo written by host threads and read by the processes of the
+  simulation. The values are kept in a lock-free ring: each slot has
+  a sequence number that tells whether it is free or holds a value, so
+  any number of host threads can write without a lock, while the
+  simulator is the only reader.
+
+  A writer wakes the simulator with async_request_update() only if no
+  update of the fifo is pending yet, so a burst of writes costs a single
+  wakeup. In the update phase the fifo takes all values written so far
+  and notifies data_written_event() in the next delta cycle, like
+  sc_fifo<T>. While a process waits for the fifo, the simulator suspends
+  instead of stopping at starvation, until the fifo is closed.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_ASYNC_FIFO_H_INCLUDED_
+#define SC_ASYNC_FIFO_H_INCLUDED_
+
+#include "sysc/communication/sc_async_atomic.h"
+#include "sysc/communication/sc_communication_ids.h"
+#include "sysc/communication/sc_fifo_ifs.h"
+#include "sysc/communication/sc_host_semaphore.h"
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+#include <algorithm>
+#include <typeinfo>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_async_fifo<T>
+//
+//  The sc_async_fifo<T> primitive channel class.
+// ----------------------------------------------------------------------------
+
+template <class T>
+class sc_async_fifo
+: public sc_fifo_in_if<T>,
+  public sc_prim_channel
+{
+public:
+
+    // constructors, the size is rounded up to a power of two
+
+    explicit sc_async_fifo( int size_ = 1024 )
+      : sc_prim_channel( sc_gen_unique_name( "async_fifo" ) ),
+        m_data_written_event( sc_event::kernel_event, "write_event" )
+      { init( size_ ); }
+
+    explicit sc_async_fifo( const char* name_, int size_ = 1024 )
+      : sc_prim_channel( name_ ),
+        m_data_written_event( sc_event::kernel_event, "write_event" )
+      { init( size_ ); }
+
+
+    // destructor
+
+    virtual ~sc_async_fifo()
+	{ delete [] m_seqs; delete [] m_values; }
+
+
+    // interface methods
+
+    virtual void register_port( sc_port_base&, const char* );
+
+
+    // blocking read
+    virtual void read( T& );
+    virtual T read();
+    virtual void read( T*, int );
+
+    // non-blocking read
+    virtual bool nb_read( T& );
+    virtual int nb_read( T*, int );
+
+    // in-place read
+    virtual const T* peek_contiguous( int& );
+    virtual void commit_read( int );
+
+
+    // get the number of available samples
+
+    virtual int num_available() const
+	{ return static_cast<int>( m_num_readable ); }
+
+
+    // get the data written event, the simulator suspends while it waits
+    // for the fifo
+
+    virtual const sc_event& data_written_event() const;
+
+
+    // host thread side, safe to call from any thread
+
+    // non-blocking write, false if the fifo is full or closed
+    bool nb_write( const T& );
+
+    // blocking write, waits while the fifo is full; false if the fifo is
+    // closed. Must not be called by a process of the simulation.
+    bool write( const T& );
+
+    // no more values will be written, the simulator no longer suspends
+    // for the fifo
+    void close();
+
+    bool is_closed() const
+	{ return m_closed.load() != 0; }
+
+
+    // other methods
+
+    // number of update phases that took new values from the host threads
+    sc_dt::uint64 wakeups() const
+	{ return m_wakeups; }
+
+    virtual const char* kind() const
+        { return "sc_async_fifo"; }
+
+protected:
+
+    virtual void update();
+    virtual void end_of_simulation();
+
+    // support methods
+
+    void init( int );
+    void wake_writers();
+
+protected:
+
+    // the sequence number of a slot is the position of the write (or
+    // read + 1) it is ready for, the values are stored contiguously for
+    // peek_contiguous
+    sc_async_atomic<sc_dt::uint64>* m_seqs;
+    T*                              m_values;
+    sc_dt::uint64                   m_mask;    // number of slots - 1
+
+    // written by the host threads
+    sc_async_atomic<sc_dt::uint64> m_wi;       // position of next write
+    sc_async_atomic<int>           m_update_requested;
+    sc_async_atomic<int>           m_blocked_writers;
+    sc_async_atomic<int>           m_closed;
+    sc_host_semaphore              m_writable;
+
+    // simulator only
+    sc_dt::uint64 m_ri;            // position of next read
+    sc_dt::uint64 m_num_readable;  // #samples taken in the update phase
+    sc_dt::uint64 m_wakeups;
+    mutable bool  m_suspending;    // attached as async suspending
+
+    sc_port_base* m_reader;        // used for static design rule checking
+
+    sc_event m_data_written_event;
+
+private:
+
+    // disabled
+    sc_async_fifo( const sc_async_fifo<T>& );
+    sc_async_fifo& operator = ( const sc_async_fifo<T>& );
+};
+
+
+// IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::register_port( sc_port_base& port_,
+				  const char* if_typename_ )
+{
+    std::string nm( if_typename_ );
+    if( nm == typeid( sc_fifo_in_if<T> ).name() ||
+        nm == typeid( sc_fifo_blocking_in_if<T> ).name()
+    ) {
+        // only one reader can be connected
+        if( m_reader != 0 ) {
+            SC_REPORT_ERROR( SC_ID_MORE_THAN_ONE_FIFO_READER_, 0 );
+            // may continue, if suppressed
+        }
+        m_reader = &port_;
+    }
+    else
+    {
+        SC_REPORT_ERROR( SC_ID_BIND_IF_TO_PORT_,
+                         "sc_async_fifo<T> port not recognized" );
+        // may continue, if suppressed
+    }
+}
+
+
+// blocking read
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::read( T& val_ )
+{
+    while( num_available() == 0 ) {
+	sc_core::wait( data_written_event() );
+    }
+    bool read_success = sc_async_fifo<T>::nb_read( val_ );
+    sc_assert( read_success );
+}
+
+template <class T>
+inline
+T
+sc_async_fifo<T>::read()
+{
+    T tmp;
+    read( tmp );
+    return tmp;
+}
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::read( T* dst_, int n_ )
+{
+    while( n_ > 0 ) {
+	while( num_available() == 0 ) {
+	    sc_core::wait( data_written_event() );
+	}
+	int num_read = sc_async_fifo<T>::nb_read( dst_, n_ );
+	dst_ += num_read;
+	n_ -= num_read;
+    }
+}
+
+// non-blocking read, hands the slot back to the writers
+
+template <class T>
+inline
+bool
+sc_async_fifo<T>::nb_read( T& val_ )
+{
+    if( m_num_readable == 0 ) {
+	return false;
+    }
+    sc_dt::uint64 i = m_ri & m_mask;
+    val_ = m_values[i];
+    m_values[i] = T(); // clear entry for boost::shared_ptr, et al.
+    m_seqs[i].store( m_ri + m_mask + 1 );
+    ++ m_ri;
+    -- m_num_readable;
+    if( m_blocked_writers.load() != 0 ) {
+	wake_writers();
+    }
+    return true;
+}
+
+template <class T>
+inline
+int
+sc_async_fifo<T>::nb_read( T* dst_, int n_ )
+{
+    int num_read = 0;
+    while( num_read < n_ ) {
+	int run;
+	const T* values = peek_contiguous( run );
+	if( run == 0 ) {
+	    break;
+	}
+	run = std::min( run, n_ - num_read );
+	for( int i = 0; i < run; ++ i ) {
+	    dst_[num_read + i] = values[i];
+	}
+	commit_read( run );
+	num_read += run;
+    }
+    return num_read;
+}
+
+// in-place read, the values up to the end of the ring
+
+template <class T>
+inline
+const T*
+sc_async_fifo<T>::peek_contiguous( int& n_ )
+{
+    sc_dt::uint64 run = std::min( m_num_readable,
+                                  m_mask + 1 - ( m_ri & m_mask ) );
+    n_ = static_cast<int>( run );
+    return n_ > 0 ? m_values + ( m_ri & m_mask ) : 0;
+}
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::commit_read( int n_ )
+{
+    int available;
+    peek_contiguous( available );
+    if( n_ < 0 || n_ > available ) {
+	SC_REPORT_ERROR( SC_ID_INVALID_FIFO_COMMIT_, "commit_read" );
+	return;
+    }
+    for( int i = 0; i < n_; ++ i, ++ m_ri ) {
+	m_values[m_ri & m_mask] = T(); // clear entry for boost::shared_ptr
+	m_seqs[m_ri & m_mask].store( m_ri + m_mask + 1 );
+    }
+    m_num_readable -= n_;
+    if( n_ > 0 && m_blocked_writers.load() != 0 ) {
+	wake_writers();
+    }
+}
+
+template <class T>
+inline
+const sc_event&
+sc_async_fifo<T>::data_written_event() const
+{
+    if( !m_suspending && !is_closed() ) {
+	m_suspending = const_cast<sc_async_fifo<T>*>( this )
+	                 ->async_attach_suspending();
+    }
+    return m_data_written_event;
+}
+
+
+// non-blocking write: claim the slot of the next write position, copy
+// the value and publish it by advancing the sequence number of the slot
+
+template <class T>
+inline
+bool
+sc_async_fifo<T>::nb_write( const T& val_ )
+{
+    if( is_closed() ) {
+	return false;
+    }
+    sc_dt::uint64 pos = m_wi.load();
+    for( ;; ) {
+	sc_dt::uint64 seq = m_seqs[pos & m_mask].load();
+	if( seq == pos ) {
+	    if( m_wi.compare_exchange( pos, pos + 1 ) ) {
+		break;
+	    }
+	} else if( seq < pos ) {
+	    return false; // full, the slot was not read yet
+	} else {
+	    pos = m_wi.load();
+	}
+    }
+    m_values[pos & m_mask] = val_;
+    m_seqs[pos & m_mask].store( pos + 1 );
+
+    // coalesce the wakeups of the simulator
+    if( m_update_requested.load() == 0 &&
+        m_update_requested.exchange( 1 ) == 0 ) {
+	async_request_update();
+    }
+    return true;
+}
+
+// blocking write, the simulator wakes the blocked writers after a read
+
+template <class T>
+inline
+bool
+sc_async_fifo<T>::write( const T& val_ )
+{
+    while( !nb_write( val_ ) ) {
+	m_blocked_writers.fetch_add( 1 );
+	if( nb_write( val_ ) ) {
+	    break; // the wakeup, if any, is consumed by a later wait
+	}
+	if( is_closed() ) {
+	    return false;
+	}
+	m_writable.wait();
+    }
+    return true;
+}
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::close()
+{
+    m_closed.store( 1 );
+    wake_writers();
+    if( m_update_requested.exchange( 1 ) == 0 ) {
+	async_request_update();
+    }
+}
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::wake_writers()
+{
+    for( int n = m_blocked_writers.exchange( 0 ); n > 0; -- n ) {
+	m_writable.post();
+    }
+}
+
+
+// take the values published since the last update, up to the first slot
+// a writer has claimed but not yet filled
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::update()
+{
+    m_update_requested.store( 0 );
+
+    sc_dt::uint64 end = m_ri + m_num_readable;
+    while( end - m_ri <= m_mask &&
+           m_seqs[end & m_mask].load() == end + 1 ) {
+	++ end;
+    }
+    if( end != m_ri + m_num_readable ) {
+	m_num_readable = end - m_ri;
+	m_data_written_event.notify( SC_ZERO_TIME );
+	++ m_wakeups;
+    }
+
+    if( m_suspending && is_closed() ) {
+	async_detach_suspending();
+	m_suspending = false;
+    }
+}
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::end_of_simulation()
+{
+    if( m_suspending ) {
+	async_detach_suspending();
+	m_suspending = false;
+    }
+}
+
+
+// support methods
+
+template <class T>
+inline
+void
+sc_async_fifo<T>::init( int size_ )
+{
+    if( size_ <= 0 ) {
+        SC_REPORT_ERROR( SC_ID_INVALID_FIFO_SIZE_, 0 );
+        size_ = 1;
+    }
+    sc_dt::uint64 size = 1;
+    while( size < static_cast<sc_dt::uint64>( size_ ) ) {
+	size <<= 1;
+    }
+    m_seqs = new sc_async_atomic<sc_dt::uint64>[size];
+    m_values = new T[size];
+    for( sc_dt::uint64 i = 0; i < size; ++ i ) {
+	m_seqs[i].store( i );
+    }
+    m_mask = size - 1;
+    m_wi.store( 0 );
+    m_update_requested.store( 0 );
+    m_blocked_writers.store( 0 );
+    m_closed.store( 0 );
+
+    m_ri = 0;
+    m_num_readable = 0;
+    m_wakeups = 0;
+    m_suspending = false;
+    m_reader = 0;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_ASYNC_FIFO_H_INCLUDED_
+// Taf!
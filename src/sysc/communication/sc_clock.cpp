@@ -49,6 +49,7 @@
 #include "sysc/kernel/sc_spawn.h"
 #include "sysc/utils/sc_utils_ids.h"
 
+#include <algorithm>
 #include <sstream>
 
 namespace sc_core {
@@ -66,7 +67,8 @@ sc_clock::sc_clock() :
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_parked( false ), m_parked_posedge(), m_parked_edge()
 {
     init( sc_time::from_value(simcontext()->m_time_params->default_time_unit),
 	  0.5,
@@ -81,7 +83,8 @@ sc_clock::sc_clock( const char* name_ ) :
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_parked( false ), m_parked_posedge(), m_parked_edge()
 {
     init( sc_time::from_value(simcontext()->m_time_params->default_time_unit),
 	  0.5,
@@ -100,7 +103,8 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_parked( false ), m_parked_posedge(), m_parked_edge()
 {
     init( period_,
 	  duty_cycle_,
@@ -124,7 +128,8 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_parked( false ), m_parked_posedge(), m_parked_edge()
 {
     init( sc_time( period_v_, period_tu_, simcontext() ),
 	  duty_cycle_,
@@ -146,7 +151,8 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_parked( false ), m_parked_posedge(), m_parked_edge()
 {
     init( sc_time( period_v_, period_tu_, simcontext() ),
 	  duty_cycle_,
@@ -172,7 +178,8 @@ sc_clock::sc_clock( const char* name_,
     m_period(), m_duty_cycle(), m_start_time(), m_posedge_first(),
     m_posedge_time(), m_negedge_time(),
     m_next_posedge_event( sc_event::kernel_event, "next_posedge_event" ),
-    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" )
+    m_next_negedge_event( sc_event::kernel_event, "next_negedge_event" ),
+    m_parked( false ), m_parked_posedge(), m_parked_edge()
 {
     static bool warn_sc_clock=true;
     if ( warn_sc_clock )
@@ -241,6 +248,8 @@ void sc_clock::before_end_of_elaboration()
     gen_base += "_negedge_action";
     sc_spawn( sc_clock_negedge_callback(this),
     	sc_gen_unique_name( gen_base.c_str() ), &negedge_options );
+
+    simcontext()->m_clocks.push_back( this );
 }
 
 //clear VC++6.0 macros
@@ -248,10 +257,17 @@ void sc_clock::before_end_of_elaboration()
 #undef sc_clock_negedge_callback
 #undef sc_spawn
 
-// destructor (does nothing)
+// destructor
 
 sc_clock::~sc_clock()
-{}
+{
+    std::vector<sc_clock*>& clocks = simcontext()->m_clocks;
+    clocks.erase( std::remove( clocks.begin(), clocks.end(), this ),
+                  clocks.end() );
+    std::vector<sc_clock*>& parked = simcontext()->m_parked_clocks;
+    parked.erase( std::remove( parked.begin(), parked.end(), this ),
+                  parked.end() );
+}
 
 void sc_clock::register_port( sc_port_base& /*port*/, const char* if_typename_ )
 {
@@ -269,6 +285,141 @@ sc_clock::write( const bool& /* value */ )
     // may continue, if suppressed
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_clock::save_state"
+// |
+// | This method saves the value of the clock and the time of its next edge,
+// | which are restored by restore_state when a checkpoint is restored.
+// +----------------------------------------------------------------------------
+void
+sc_clock::save_state( std::ostream& os ) const
+{
+    const sc_event* next_p = &m_next_posedge_event;
+    if ( next_p->m_notify_type != sc_event::TIMED )
+        next_p = &m_next_negedge_event;
+    if ( next_p->m_notify_type != sc_event::TIMED )
+        return;
+
+    os << m_cur_val << ' ' << ( next_p == &m_next_posedge_event ) << ' '
+       << next_p->m_timed->notify_time().value();
+}
+
+void
+sc_clock::restore_state( std::istream& is )
+{
+    bool          value, posedge;
+    sc_dt::uint64 edge_time;
+    if ( !( is >> value >> posedge >> edge_time ) )
+        return;
+
+    m_cur_val = m_new_val = value;
+    m_next_posedge_event.cancel();
+    m_next_negedge_event.cancel();
+    ( posedge ? m_next_posedge_event : m_next_negedge_event ).notify_internal(
+        sc_time::from_value( edge_time ) - sc_time_stamp() );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_clock::observed"
+// |
+// | This method returns true if an edge of the clock would trigger a
+// | process, directly or through a reset.
+// +----------------------------------------------------------------------------
+bool
+sc_clock::observed() const
+{
+    const edge_events* edges_p = m_edge_events_p;
+    return ( m_change_event_p && m_change_event_p->observed() )
+        || ( edges_p
+             && ( edges_p->reset_p
+                  || ( edges_p->posedge_event_p
+                       && edges_p->posedge_event_p->observed() )
+                  || ( edges_p->negedge_event_p
+                       && edges_p->negedge_event_p->observed() ) ) );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_clock::park"
+// |
+// | This method suppresses the edges of a clock without observers: the
+// | pending notification of the next edge is cancelled and its time kept.
+// | Returns true if the clock was parked.
+// +----------------------------------------------------------------------------
+bool
+sc_clock::park()
+{
+    if ( m_parked || m_negedge_time == SC_ZERO_TIME ||
+         m_posedge_time == SC_ZERO_TIME || observed() )
+        return false;
+
+    sc_event* next_p = &m_next_posedge_event;
+    if ( next_p->m_notify_type != sc_event::TIMED )
+        next_p = &m_next_negedge_event;
+    if ( next_p->m_notify_type != sc_event::TIMED )
+        return false;
+
+    m_parked_posedge = ( next_p == &m_next_posedge_event );
+    m_parked_edge = next_p->m_timed->notify_time();
+    next_p->cancel();
+    m_parked = true;
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_clock::skip_edges"
+// |
+// | This method applies the suppressed edges of a parked clock up to a time
+// | to its value, without notifying its events. The edges follow each other
+// | at a fixed period, so they are counted rather than stepped through.
+// |
+// | Arguments:
+// |     limit     = time to skip to.
+// |     inclusive = false to skip the edges before limit, true to skip the
+// |                 edges before the last one at or before limit.
+// | Result is true if the next edge is the last one to be skipped, i.e. it
+// | is at limit or, if inclusive, at or before it.
+// +----------------------------------------------------------------------------
+bool
+sc_clock::skip_edges( const sc_time& limit, bool inclusive )
+{
+    typedef sc_dt::uint64 uint64;
+
+    if ( limit < m_parked_edge || ( !inclusive && limit == m_parked_edge ) )
+        return limit == m_parked_edge;
+
+    // number of edges to skip, the first one included
+    uint64 first = m_parked_edge.value();
+    uint64 period = m_period.value();
+    uint64 gap = ( m_parked_posedge ? m_negedge_time : m_posedge_time ).value();
+    uint64 offset = limit.value() - first - ( inclusive ? 0 : 1 );
+    uint64 edges = 2 * ( offset / period ) + 1 + ( offset % period >= gap );
+    if ( inclusive )
+        --edges;
+
+    if ( edges != 0 )
+    {
+        bool last_posedge = ( ( edges - 1 ) % 2 == 0 ) == m_parked_posedge;
+        m_cur_val = m_new_val = last_posedge;
+        m_parked_edge = sc_time::from_value( first + ( edges / 2 ) * period +
+                                             ( edges % 2 ? gap : 0 ) );
+        m_parked_posedge = !last_posedge;
+    }
+    return inclusive || m_parked_edge == limit;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_clock::unpark"
+// |
+// | This method resumes the edges of a parked clock with its next edge.
+// +----------------------------------------------------------------------------
+void
+sc_clock::unpark()
+{
+    m_parked = false;
+    ( m_parked_posedge ? m_next_posedge_event : m_next_negedge_event )
+        .notify_internal( m_parked_edge - sc_time_stamp() );
+}
+
 // interface methods
 
 // get the current time
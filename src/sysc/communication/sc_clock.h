@@ -50,6 +50,7 @@ public:
 
     friend class sc_clock_posedge_callback;
     friend class sc_clock_negedge_callback;
+    friend class sc_simcontext;
 
     // constructors
 
@@ -138,6 +139,10 @@ protected:
 
     void before_end_of_elaboration();
 
+    // the value and the next edge of the clock
+    virtual void save_state( std::ostream& ) const;
+    virtual void restore_state( std::istream& );
+
     // processes
     void posedge_action();
     void negedge_action();
@@ -151,6 +156,12 @@ protected:
 
     bool is_clock() const { return true; }
 
+    // skip-ahead over the edges of a clock without observers
+    bool observed() const;
+    bool park();
+    bool skip_edges( const sc_time& limit, bool inclusive );
+    void unpark();
+
 protected:
 
     sc_time  m_period;		// the period of this clock
@@ -163,6 +174,10 @@ protected:
     sc_event m_next_posedge_event;
     sc_event m_next_negedge_event;
 
+    bool     m_parked;          // edges suppressed by skip-ahead
+    bool     m_parked_posedge;  // next suppressed edge is positive
+    sc_time  m_parked_edge;     // time of next suppressed edge
+
 private:
 
     // disabled
@@ -107,6 +107,12 @@ SC_DEFINE_MESSAGE( SC_ID_ATTEMPT_TO_BIND_CLOCK_TO_OUTPUT_,  128,
     "attempted to bind sc_clock instance to sc_inout or sc_out" )
 SC_DEFINE_MESSAGE( SC_ID_NO_ASYNC_UPDATE_,  129,
     "this build has no asynchronous update support" )
+SC_DEFINE_MESSAGE( SC_ID_SHARED_MEMORY_,  130,
+    "shared memory channel" )
+SC_DEFINE_MESSAGE( SC_ID_INVALID_FIFO_COMMIT_,  131,
+    "sc_fifo<T> commit exceeds the contiguous values or space" )
+SC_DEFINE_MESSAGE( SC_ID_INVALID_SIGNAL_BANK_ACCESS_,  132,
+    "sc_signal_bank bits out of range or vector of wrong width" )
 
 /* 
 $Log: sc_communication_ids.h,v $
@@ -36,6 +36,7 @@
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/tracing/sc_trace.h"
+#include <algorithm>
 #include <typeinfo>
 
 namespace sc_core {
@@ -83,9 +84,15 @@ public:
     // blocking read
     virtual void read( T& );
     virtual T read();
+    virtual void read( T*, int );
 
     // non-blocking read
     virtual bool nb_read( T& );
+    virtual int nb_read( T*, int );
+
+    // in-place read
+    virtual const T* peek_contiguous( int& );
+    virtual void commit_read( int );
 
 
     // get the number of available samples
@@ -102,9 +109,15 @@ public:
 
     // blocking write
     virtual void write( const T& );
+    virtual void write( const T*, int );
 
     // non-blocking write
     virtual bool nb_write( const T& );
+    virtual int nb_write( const T*, int );
+
+    // in-place write
+    virtual T* reserve_contiguous( int& );
+    virtual void commit_write( int );
 
 
     // get the number of free spaces
@@ -142,6 +155,10 @@ protected:
 
     virtual void update();
 
+    // the samples in the buffer
+    virtual void save_state( ::std::ostream& ) const;
+    virtual void restore_state( ::std::istream& );
+
     // support methods
 
     void init( int );
@@ -149,6 +166,8 @@ protected:
     void buf_init( int );
     bool buf_write( const T& );
     bool buf_read( T& );
+    void buf_write( const T*, int );
+    void buf_read( T*, int );
 
 protected:
 
@@ -237,6 +256,21 @@ sc_fifo<T>::read()
     return tmp;
 }
 
+template <class T>
+inline
+void
+sc_fifo<T>::read( T* dst_, int n_ )
+{
+    while( n_ > 0 ) {
+	while( num_available() == 0 ) {
+	    sc_core::wait( m_data_written_event );
+	}
+	int num_read = sc_fifo<T>::nb_read( dst_, n_ );
+	dst_ += num_read;
+	n_ -= num_read;
+    }
+}
+
 // non-blocking read
 
 template <class T>
@@ -255,6 +289,53 @@ sc_fifo<T>::nb_read( T& val_ )
     return read_success;
 }
 
+template <class T>
+inline
+int
+sc_fifo<T>::nb_read( T* dst_, int n_ )
+{
+    int num_read = std::min( n_, num_available() );
+    if( num_read <= 0 ) {
+	return 0;
+    }
+    buf_read( dst_, num_read );
+    m_num_read += num_read;
+    request_update();
+    return num_read;
+}
+
+// in-place read
+
+template <class T>
+inline
+const T*
+sc_fifo<T>::peek_contiguous( int& n_ )
+{
+    n_ = std::min( num_available(), m_size - m_ri );
+    return n_ > 0 ? m_buf + m_ri : 0;
+}
+
+template <class T>
+inline
+void
+sc_fifo<T>::commit_read( int n_ )
+{
+    if( n_ < 0 || n_ > std::min( num_available(), m_size - m_ri ) ) {
+	SC_REPORT_ERROR( SC_ID_INVALID_FIFO_COMMIT_, "commit_read" );
+	return;
+    }
+    if( n_ == 0 ) {
+	return;
+    }
+    for( int i = 0; i < n_; ++ i ) {
+	m_buf[m_ri + i] = T(); // clear entry for boost::shared_ptr, et al.
+    }
+    m_ri = ( m_ri + n_ ) % m_size;
+    m_free += n_;
+    m_num_read += n_;
+    request_update();
+}
+
 
 // blocking write
 
@@ -270,6 +351,21 @@ sc_fifo<T>::write( const T& val_ )
     sc_assert( write_success );
 }
 
+template <class T>
+inline
+void
+sc_fifo<T>::write( const T* src_, int n_ )
+{
+    while( n_ > 0 ) {
+	while( num_free() == 0 ) {
+	    sc_core::wait( m_data_read_event );
+	}
+	int num_written = sc_fifo<T>::nb_write( src_, n_ );
+	src_ += num_written;
+	n_ -= num_written;
+    }
+}
+
 // non-blocking write
 
 template <class T>
@@ -288,6 +384,50 @@ sc_fifo<T>::nb_write( const T& val_ )
     return write_success;
 }
 
+template <class T>
+inline
+int
+sc_fifo<T>::nb_write( const T* src_, int n_ )
+{
+    int num_written = std::min( n_, num_free() );
+    if( num_written <= 0 ) {
+	return 0;
+    }
+    buf_write( src_, num_written );
+    m_num_written += num_written;
+    request_update();
+    return num_written;
+}
+
+// in-place write
+
+template <class T>
+inline
+T*
+sc_fifo<T>::reserve_contiguous( int& n_ )
+{
+    n_ = std::min( num_free(), m_size - m_wi );
+    return n_ > 0 ? m_buf + m_wi : 0;
+}
+
+template <class T>
+inline
+void
+sc_fifo<T>::commit_write( int n_ )
+{
+    if( n_ < 0 || n_ > std::min( num_free(), m_size - m_wi ) ) {
+	SC_REPORT_ERROR( SC_ID_INVALID_FIFO_COMMIT_, "commit_write" );
+	return;
+    }
+    if( n_ == 0 ) {
+	return;
+    }
+    m_wi = ( m_wi + n_ ) % m_size;
+    m_free -= n_;
+    m_num_written += n_;
+    request_update();
+}
+
 
 template <class T>
 inline
@@ -357,6 +497,47 @@ sc_fifo<T>::update()
 }
 
 
+template <class T>
+inline
+void
+sc_fifo<T>::save_state( ::std::ostream& os ) const
+{
+    os << ( m_size - m_free );
+    for( int i = m_ri, n = m_size - m_free; n > 0; -- n ) {
+        os << ' ';
+        if( !sc_save_value( os, m_buf[i] ) ) {
+            return;
+        }
+        i = ( i + 1 ) % m_size;
+    }
+}
+
+template <class T>
+inline
+void
+sc_fifo<T>::restore_state( ::std::istream& is )
+{
+    int n;
+    if( !( is >> n ) ) {
+        return;
+    }
+    for( int i = 0; i < m_size; ++ i ) {
+        m_buf[i] = T();
+    }
+    m_free = m_size;
+    m_ri = 0;
+    m_wi = 0;
+    for( T val = T(); n > 0 && sc_restore_value( is, val ); -- n ) {
+        if( !buf_write( val ) ) {
+            break;
+        }
+    }
+    m_num_readable = m_size - m_free;
+    m_num_read = 0;
+    m_num_written = 0;
+}
+
+
 // support methods
 
 template <class T>
@@ -420,6 +601,45 @@ sc_fifo<T>::buf_read( T& val_ )
     return true;
 }
 
+// copy n values in at most two runs, the caller checked the space
+
+template <class T>
+inline
+void
+sc_fifo<T>::buf_write( const T* src_, int n_ )
+{
+    while( n_ > 0 ) {
+	int run = std::min( n_, m_size - m_wi );
+	T* buf = m_buf + m_wi;
+	for( int i = 0; i < run; ++ i ) {
+	    buf[i] = src_[i];
+	}
+	m_wi = ( m_wi + run ) % m_size;
+	m_free -= run;
+	src_ += run;
+	n_ -= run;
+    }
+}
+
+template <class T>
+inline
+void
+sc_fifo<T>::buf_read( T* dst_, int n_ )
+{
+    while( n_ > 0 ) {
+	int run = std::min( n_, m_size - m_ri );
+	T* buf = m_buf + m_ri;
+	for( int i = 0; i < run; ++ i ) {
+	    dst_[i] = buf[i];
+	    buf[i] = T(); // clear entry for boost::shared_ptr, et al.
+	}
+	m_ri = ( m_ri + run ) % m_size;
+	m_free += run;
+	dst_ += run;
+	n_ -= run;
+    }
+}
+
 
 // ----------------------------------------------------------------------------
 
@@ -49,6 +49,18 @@ public:
     // non-blocking read 
     virtual bool nb_read( T& ) = 0; 
 
+    // non-blocking read of up to n values, returns the number read
+    virtual int nb_read( T* dst_, int n_ )
+        { int i = 0; while( i < n_ && nb_read( dst_[i] ) ) ++ i; return i; }
+
+    // the readable values at the front of the fifo that are stored
+    // contiguously, n_ is set to their number (0 if the channel does not
+    // support in-place access); commit_read( n ) consumes the first n
+    virtual const T* peek_contiguous( int& n_ )
+        { n_ = 0; return 0; }
+    virtual void commit_read( int )
+        {}
+
     // get the data written event 
     virtual const sc_event& data_written_event() const = 0; 
 }; 
@@ -68,6 +80,10 @@ public:
     // blocking read 
     virtual void read( T& ) = 0; 
     virtual T read() = 0; 
+
+    // blocking read of n values
+    virtual void read( T* dst_, int n_ )
+        { for( int i = 0; i < n_; ++ i ) read( dst_[i] ); }
 }; 
 
 // ----------------------------------------------------------------------------
@@ -116,6 +132,18 @@ public:
     // non-blocking write 
     virtual bool nb_write( const T& ) = 0; 
 
+    // non-blocking write of up to n values, returns the number written
+    virtual int nb_write( const T* src_, int n_ )
+        { int i = 0; while( i < n_ && nb_write( src_[i] ) ) ++ i; return i; }
+
+    // the free space at the back of the fifo that is stored contiguously,
+    // n_ is set to its size (0 if the channel does not support in-place
+    // access); commit_write( n ) appends the first n values written to it
+    virtual T* reserve_contiguous( int& n_ )
+        { n_ = 0; return 0; }
+    virtual void commit_write( int )
+        {}
+
     // get the data read event 
     virtual const sc_event& data_read_event() const = 0; 
 }; 
@@ -135,6 +163,9 @@ public:
     // blocking write 
     virtual void write( const T& ) = 0; 
 
+    // blocking write of n values
+    virtual void write( const T* src_, int n_ )
+        { for( int i = 0; i < n_; ++ i ) write( src_[i] ); }
 }; 
 
 // ----------------------------------------------------------------------------
@@ -121,12 +121,27 @@ public:
     data_type read()
         { return (*this)->read(); }
 
+    void read( data_type* dst_, int n_ )
+        { (*this)->read( dst_, n_ ); }
+
 
     // non-blocking read
 
     bool nb_read( data_type& value_ )
         { return (*this)->nb_read( value_ ); }
 
+    int nb_read( data_type* dst_, int n_ )
+        { return (*this)->nb_read( dst_, n_ ); }
+
+
+    // in-place read
+
+    const data_type* peek_contiguous( int& n_ )
+        { return (*this)->peek_contiguous( n_ ); }
+
+    void commit_read( int n_ )
+        { (*this)->commit_read( n_ ); }
+
 
     // get the number of available samples
 
@@ -245,12 +260,27 @@ public:
     void write( const data_type& value_ )
         { (*this)->write( value_ ); }
 
+    void write( const data_type* src_, int n_ )
+        { (*this)->write( src_, n_ ); }
+
 
     // non-blocking write
 
     bool nb_write( const data_type& value_ )
         { return (*this)->nb_write( value_ ); }
 
+    int nb_write( const data_type* src_, int n_ )
+        { return (*this)->nb_write( src_, n_ ); }
+
+
+    // in-place write
+
+    data_type* reserve_contiguous( int& n_ )
+        { return (*this)->reserve_contiguous( n_ ); }
+
+    void commit_write( int n_ )
+        { (*this)->commit_write( n_ ); }
+
 
     // get the number of free spaces
 
@@ -0,0 +1,167 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_pdes_channel.cpp -- Channels between the partitions of a distributed
+                         simulation.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/communication/sc_pdes_channel.h"
+#include "sysc/kernel/sc_pdes.h"
+#include "sysc/kernel/sc_simcontext.h"
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_pdes_outbox_base
+// ----------------------------------------------------------------------------
+
+sc_pdes_outbox_base::sc_pdes_outbox_base( const char* name_, int peer_,
+                                          const sc_time& lookahead_ )
+  : sc_prim_channel( name_ ), m_link( 0 ), m_peer( peer_ ),
+    m_lookahead( lookahead_ ),
+    m_data_read_event( sc_event::kernel_event, "read_event" ), m_index( 0 )
+{
+    if ( peer_ < 0 || peer_ >= sc_get_pdes_size() )
+    {
+        SC_REPORT_ERROR( SC_ID_PDES_, "partition of outbox out of range" );
+        return;
+    }
+    if ( lookahead_ == SC_ZERO_TIME )
+    {
+        SC_REPORT_ERROR( SC_ID_PDES_, "lookahead of outbox must be positive" );
+        return;
+    }
+    m_link = simcontext()->pdes();
+    m_link->add_outbox( this );
+}
+
+sc_pdes_outbox_base::~sc_pdes_outbox_base()
+{
+    if ( m_link )
+        m_link->remove_outbox( this );
+}
+
+void
+sc_pdes_outbox_base::send( const std::vector<char>& bytes )
+{
+    if ( m_link )
+        m_link->send( this, simcontext()->time_stamp() + m_lookahead, bytes );
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_pdes_inbox_base
+// ----------------------------------------------------------------------------
+
+sc_pdes_inbox_base::sc_pdes_inbox_base( const char* name_, int peer_,
+                                        const char* outbox_name_ )
+  : sc_prim_channel( name_ ), m_link( 0 ), m_peer( peer_ ),
+    m_outbox_name(), m_values(),
+    m_data_written_event( sc_event::kernel_event, "write_event" ),
+    m_armed_time(), m_armed( false )
+{
+    m_outbox_name = outbox_name_ ? outbox_name_ : name();
+    if ( peer_ < 0 || peer_ >= sc_get_pdes_size() )
+    {
+        SC_REPORT_ERROR( SC_ID_PDES_, "partition of inbox out of range" );
+        return;
+    }
+    m_link = simcontext()->pdes();
+    m_link->add_inbox( this );
+}
+
+sc_pdes_inbox_base::~sc_pdes_inbox_base()
+{
+    if ( m_link )
+        m_link->remove_inbox( this );
+}
+
+int
+sc_pdes_inbox_base::available() const
+{
+    const sc_time& now = simcontext()->time_stamp();
+    int n = 0;
+    for ( std::deque<value_type>::const_iterator it = m_values.begin();
+          it != m_values.end() && it->first <= now; ++it )
+    {
+        ++n;
+    }
+    return n;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes_inbox_base::receive"
+// |
+// | This method adds a value received from the peer partition. Since the
+// | outbox has a positive lookahead, the time of the value is in the
+// | future.
+// +----------------------------------------------------------------------------
+void
+sc_pdes_inbox_base::receive( const sc_time& t, const char* bytes_p,
+                             std::size_t size )
+{
+    m_values.push_back( value_type( t, std::vector<char>() ) );
+    if ( size )
+        m_values.back().second.assign( bytes_p, bytes_p + size );
+    arm();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes_inbox_base::arm"
+// |
+// | This method notifies the data written event for the earliest value
+// | whose time has not come, unless a notification is pending. The
+// | simulator calls it before each time advance, so the event is notified
+// | once for each time at which values become available.
+// +----------------------------------------------------------------------------
+void
+sc_pdes_inbox_base::arm()
+{
+    const sc_time& now = simcontext()->time_stamp();
+    if ( m_armed && m_armed_time > now )
+        return;
+    m_armed = false;
+    for ( std::deque<value_type>::const_iterator it = m_values.begin();
+          it != m_values.end(); ++it )
+    {
+        if ( it->first > now )
+        {
+            m_data_written_event.notify( it->first - now );
+            m_armed_time = it->first;
+            m_armed = true;
+            break;
+        }
+    }
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,324 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_pdes_channel.h -- Channels between the partitions of a distributed
+                       simulation.
+
+  An sc_pdes_outbox<T> in one partition sends the values written to it to
+  the sc_pdes_inbox<T> of the same name in another partition, where they
+  can be read lookahead after they were written. The outbox implements
+  sc_fifo_out_if<T> with an unbounded capacity, the inbox implements
+  sc_fifo_in_if<T>, so both can be bound to sc_fifo ports.
+
+  The values are transferred as their bytes. Types that are not plain
+  old data must specialize sc_pdes_pack and sc_pdes_unpack.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_PDES_CHANNEL_H_INCLUDED_
+#define SC_PDES_CHANNEL_H_INCLUDED_
+
+#include "sysc/communication/sc_fifo_ifs.h"
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_time.h"
+#include "sysc/utils/sc_report.h"
+
+#include <climits>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::deque,std::vector
+#endif
+
+namespace sc_core {
+
+class sc_pdes;
+
+// ----------------------------------------------------------------------------
+//  FUNCTION : sc_pdes_pack, sc_pdes_unpack
+//
+//  Conversion of the values of the cross-partition channels to bytes.
+// ----------------------------------------------------------------------------
+
+template <class T>
+inline void
+sc_pdes_pack( std::vector<char>& bytes, const T& value )
+{
+    bytes.resize( sizeof( T ) );
+    std::memcpy( &bytes[0], &value, sizeof( T ) );
+}
+
+template <class T>
+inline bool
+sc_pdes_unpack( const std::vector<char>& bytes, T& value )
+{
+    if ( bytes.size() != sizeof( T ) )
+        return false;
+    std::memcpy( &value, &bytes[0], sizeof( T ) );
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_pdes_outbox_base
+//
+//  Type independent part of the sending end of a cross-partition channel.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_pdes_outbox_base : public sc_prim_channel
+{
+    friend class sc_pdes;
+
+public:
+
+    // partition the values are sent to
+    int peer() const
+        { return m_peer; }
+
+    // delay of the values
+    const sc_time& lookahead() const
+        { return m_lookahead; }
+
+    virtual const char* kind() const
+        { return "sc_pdes_outbox"; }
+
+protected:
+
+    sc_pdes_outbox_base( const char* name_, int peer_,
+                         const sc_time& lookahead_ );
+    virtual ~sc_pdes_outbox_base();
+
+    // send a value written in the current delta cycle
+    void send( const std::vector<char>& bytes );
+
+    const sc_event& read_event() const
+        { return m_data_read_event; }
+
+private:
+    sc_pdes*       m_link;
+    int            m_peer;
+    sc_time        m_lookahead;
+    sc_event       m_data_read_event;
+    unsigned       m_index;  // among the outboxes to the same partition.
+
+private:
+    // disabled
+    sc_pdes_outbox_base( const sc_pdes_outbox_base& );
+    sc_pdes_outbox_base& operator = ( const sc_pdes_outbox_base& );
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_pdes_inbox_base
+//
+//  Type independent part of the receiving end of a cross-partition channel.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_pdes_inbox_base : public sc_prim_channel
+{
+    friend class sc_pdes;
+
+    typedef std::pair<sc_time, std::vector<char> > value_type;
+
+public:
+
+    // partition the values are received from
+    int peer() const
+        { return m_peer; }
+
+    virtual const char* kind() const
+        { return "sc_pdes_inbox"; }
+
+protected:
+
+    sc_pdes_inbox_base( const char* name_, int peer_,
+                        const char* outbox_name_ );
+    virtual ~sc_pdes_inbox_base();
+
+    // number of received values whose time has come
+    int available() const;
+
+    // oldest available value, remove it
+    const std::vector<char>& front() const
+        { return m_values.front().second; }
+    void pop()
+        { m_values.pop_front(); }
+
+    const sc_event& written_event() const
+        { return m_data_written_event; }
+
+private:
+
+    void receive( const sc_time& t, const char* bytes_p, std::size_t size );
+    void arm();
+
+private:
+    sc_pdes*                m_link;
+    int                     m_peer;
+    std::string             m_outbox_name;
+    std::deque<value_type>  m_values;      // in the order of their times.
+    sc_event                m_data_written_event;
+    sc_time                 m_armed_time;  // of the pending notification.
+    bool                    m_armed;
+
+private:
+    // disabled
+    sc_pdes_inbox_base( const sc_pdes_inbox_base& );
+    sc_pdes_inbox_base& operator = ( const sc_pdes_inbox_base& );
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_pdes_outbox<T>
+//
+//  The sending end of a cross-partition channel.
+// ----------------------------------------------------------------------------
+
+template <class T>
+class sc_pdes_outbox
+: public sc_pdes_outbox_base,
+  public sc_fifo_out_if<T>
+{
+public:
+
+    // constructor, peer_ is the partition of the inbox
+
+    sc_pdes_outbox( const char* name_, int peer_, const sc_time& lookahead_ )
+      : sc_pdes_outbox_base( name_, peer_, lookahead_ ),
+        m_written(), m_bytes()
+      {}
+
+    // write, never blocks
+
+    virtual void write( const T& value_ )
+        { m_written.push_back( value_ ); request_update(); }
+
+    virtual bool nb_write( const T& value_ )
+        { write( value_ ); return true; }
+
+    virtual int num_free() const
+        { return INT_MAX; }
+
+    // never notified, the outbox is never full
+
+    virtual const sc_event& data_read_event() const
+        { return read_event(); }
+
+protected:
+
+    virtual void update();
+
+private:
+    std::vector<T>     m_written;
+    std::vector<char>  m_bytes;
+};
+
+template <class T>
+inline void
+sc_pdes_outbox<T>::update()
+{
+    for ( std::size_t i = 0; i < m_written.size(); ++i )
+    {
+        sc_pdes_pack( m_bytes, m_written[i] );
+        send( m_bytes );
+    }
+    m_written.clear();
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_pdes_inbox<T>
+//
+//  The receiving end of a cross-partition channel. outbox_name_ is the
+//  hierarchical name of the outbox in the peer partition, by default the
+//  name of the inbox.
+// ----------------------------------------------------------------------------
+
+template <class T>
+class sc_pdes_inbox
+: public sc_pdes_inbox_base,
+  public sc_fifo_in_if<T>
+{
+public:
+
+    // constructor, peer_ is the partition of the outbox
+
+    sc_pdes_inbox( const char* name_, int peer_, const char* outbox_name_ = 0 )
+      : sc_pdes_inbox_base( name_, peer_, outbox_name_ )
+      {}
+
+    // blocking read
+
+    virtual void read( T& value_ )
+        {
+            while ( !available() )
+                sc_core::wait( written_event() );
+            nb_read( value_ );
+        }
+
+    virtual T read()
+        { T tmp; read( tmp ); return tmp; }
+
+    // non-blocking read
+
+    virtual bool nb_read( T& value_ );
+
+    virtual int num_available() const
+        { return available(); }
+
+    // notified when a value becomes available
+
+    virtual const sc_event& data_written_event() const
+        { return written_event(); }
+};
+
+template <class T>
+inline bool
+sc_pdes_inbox<T>::nb_read( T& value_ )
+{
+    if ( !available() )
+        return false;
+    if ( !sc_pdes_unpack( front(), value_ ) )
+        SC_REPORT_ERROR( SC_ID_PDES_, "value of unexpected size received" );
+    pop();
+    return true;
+}
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_PDES_CHANNEL_H_INCLUDED_
+// Taf!
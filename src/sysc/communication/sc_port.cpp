@@ -31,13 +31,27 @@
 #include "sysc/kernel/sc_object_int.h"
 #include "sysc/kernel/sc_method_process.h"
 #include "sysc/kernel/sc_thread_process.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/communication/sc_communication_ids.h"
 #include "sysc/utils/sc_utils_ids.h"
 #include "sysc/communication/sc_event_finder.h"
 #include "sysc/communication/sc_port.h"
 #include "sysc/communication/sc_signal_ifs.h"
 
+#if SC_HAS_PARALLEL_EVALUATION_
+#  include "sysc/communication/sc_host_mutex.h"
+#  include "sysc/communication/sc_host_semaphore.h"
+#  if SC_CPLUSPLUS >= 201103L
+#    include <thread>
+#  else
+#    include <pthread.h>
+#  endif
+#endif
+
+#include <algorithm>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 namespace sc_core {
 
@@ -138,6 +152,7 @@ struct sc_bind_info
     int                        last_add;
     bool                       is_leaf;
     bool                       complete;
+    int                        level;    // depth of the parent port chain.
 
     ef_vector                  thread_vec;
     ef_vector                  method_vec;
@@ -156,6 +171,7 @@ sc_bind_info::sc_bind_info( int max_size_, sc_port_policy policy_ )
   last_add( -1 ),
   is_leaf( true ),
   complete( false ),
+  level( -1 ),
   thread_vec(),
   method_vec()
 {}
@@ -403,51 +419,106 @@ sc_port_base::make_sensitive( sc_method_handle handle_,
 
 // support methods
 
-int
-sc_port_base::first_parent()
+// Appends this port to order_ after its parent ports, and sets the level
+// of each port appended to 1 + the highest level of its parents (0 if it
+// has no parents). The parents are visited in the order of their
+// binding, with an explicit stack instead of recursion, so that deep
+// hierarchies do not exhaust the stack. A parent that is bound to one of
+// its children is reported and ignored.
+
+void
+sc_port_base::order_binding( std::vector<sc_port_base*>& order_ )
 {
-    for( int i = 0; i < m_bind_info->size(); ++ i ) {
-	if( m_bind_info->vec[i]->parent != 0 ) {
-	    return i;
-	}
+    static const int ordering = -2; // level while the parents are ordered
+
+    if( m_bind_info->level != -1 ) {
+        return;
+    }
+
+    std::vector< std::pair<this_type*, int> > stack;
+    stack.push_back( std::make_pair( this, 0 ) );
+    m_bind_info->level = ordering;
+
+    while( ! stack.empty() ) {
+        this_type*    port_p = stack.back().first;
+        sc_bind_info* info_p = port_p->m_bind_info;
+        int           j      = stack.back().second;
+
+        // find the next parent that is not ordered yet
+
+        for( ; j < info_p->size(); ++ j ) {
+            this_type* parent_p = info_p->vec[j]->parent;
+            if( parent_p == 0 || parent_p->m_bind_info->level >= 0 ) {
+                continue;
+            }
+            if( parent_p->m_bind_info->level == ordering ) {
+                parent_p->report_error( SC_ID_COMPLETE_BINDING_,
+                                        "port is bound to itself" );
+                info_p->vec[j]->parent = 0;
+                continue;
+            }
+            break;
+        }
+        if( j < info_p->size() ) {
+            this_type* parent_p = info_p->vec[j]->parent;
+            stack.back().second = j + 1;
+            parent_p->m_bind_info->level = ordering;
+            stack.push_back( std::make_pair( parent_p, 0 ) );
+            continue;
+        }
+
+        // all parents are ordered
+
+        int level = 0;
+        for( j = 0; j < info_p->size(); ++ j ) {
+            this_type* parent_p = info_p->vec[j]->parent;
+            if( parent_p != 0 ) {
+                level = std::max( level, parent_p->m_bind_info->level + 1 );
+            }
+        }
+        info_p->level = level;
+        order_.push_back( port_p );
+        stack.pop_back();
     }
-    return -1;
 }
 
+// Replaces each parent port in the bind vector by the interfaces the
+// parent is bound to. The parents must be resolved already, so their bind
+// vectors contain only interfaces, and each parent is visited once.
+
 void
-sc_port_base::insert_parent( int i )
+sc_port_base::resolve_parents()
 {
     std::vector<sc_bind_elem*>& vec = m_bind_info->vec;
+    std::vector<sc_bind_elem*>  resolved;
+    resolved.reserve( vec.size() );
+
+    for( std::size_t i = 0; i < vec.size(); ++ i ) {
+        sc_bind_elem* elem_p = vec[i];
+        this_type*    parent = elem_p->parent;
+        resolved.push_back( elem_p );
+        if( parent == 0 ) {
+            continue;
+        }
 
-    this_type* parent = vec[i]->parent;
+        // IF OUR PARENT HAS NO BINDING THEN IGNORE IT:
+        //
+        // Note that the zeroing of the parent pointer must occur before this
+        // test
 
+        elem_p->parent = 0;
+        const std::vector<sc_bind_elem*>& parent_vec = parent->m_bind_info->vec;
+        if( parent_vec.empty() ) {
+            continue;
+        }
 
-    // IF OUR PARENT HAS NO BINDING THEN IGNORE IT:
-    //
-    // Note that the zeroing of the parent pointer must occur before this
-    // test
-
-    vec[i]->parent = 0;
-    if ( parent->m_bind_info->vec.size() == 0 ) return;
-
-    vec[i]->iface = parent->m_bind_info->vec[0]->iface;
-    int n = parent->m_bind_info->size() - 1;
-    if( n > 0 ) {
-	// resize the bind vector (by adding new elements)
-	for( int k = 0; k < n; ++ k ) {
-	    vec.push_back( new sc_bind_elem() );
-	}
-	// move elements in the bind vector
-	for( int k = m_bind_info->size() - n - 1; k > i; -- k ) {
-	    vec[k + n]->iface = vec[k]->iface;
-	    vec[k + n]->parent = vec[k]->parent;
-	}
-	// insert parent interfaces into the bind vector
-	for( int k = i + 1; k <= i + n; ++ k ) {
-	    vec[k]->iface = parent->m_bind_info->vec[k - i]->iface;
-	    vec[k]->parent = 0;
-	}
+        // insert parent interfaces into the bind vector
+        elem_p->iface = parent_vec[0]->iface;
+        for( std::size_t k = 1; k < parent_vec.size(); ++ k ) {
+            resolved.push_back( new sc_bind_elem( parent_vec[k]->iface ) );
+        }
     }
+    vec.swap( resolved );
 }
 
 
@@ -463,13 +534,31 @@ sc_port_base::complete_binding()
         return;
     }
 
-    // COMPLETE BINDING OF OUR PARENT PORTS SO THAT WE CAN USE THAT INFORMATION:
+    // THE PARENT PORTS HAVE BEEN RESOLVED BY THE REGISTRY ALREADY:
+    //
+    // (see sc_port_registry::complete_binding)
 
-    int i = first_parent();
-    while( i >= 0 ) {
-        m_bind_info->vec[i]->parent->complete_binding();
-        insert_parent( i );
-        i = first_parent();
+    // MAKE SURE NO INTERFACE IS BOUND TWICE:
+    //
+    // This is checked once here, on the sorted interfaces, rather than on
+    // every bind, so that binding n interfaces to a multiport is not O(n^2).
+
+    if( m_bind_info->size() > 1 ) {
+        std::vector<sc_interface*> ifaces;
+        ifaces.reserve( m_bind_info->size() );
+        for( int j = 0; j < m_bind_info->size(); ++ j ) {
+            if( m_bind_info->vec[j]->iface != 0 ) {
+                ifaces.push_back( m_bind_info->vec[j]->iface );
+            }
+        }
+        std::sort( ifaces.begin(), ifaces.end() );
+        for( std::size_t j = 1; j < ifaces.size(); ++ j ) {
+            if( ifaces[j] == ifaces[j - 1] ) {
+                report_error( SC_ID_BIND_IF_TO_PORT_,
+                              "interface already bound to port" );
+                // may continue, if suppressed
+            }
+        }
     }
 
     // LOOP OVER BINDING INFORMATION TO COMPLETE THE BINDING PROCESS:
@@ -614,6 +703,134 @@ sc_port_base::simulation_done()
 }
 
 
+#if SC_HAS_PARALLEL_EVALUATION_
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_bind_resolver
+//
+//  Host threads resolving the parent ports of the ports of one level of the
+//  port hierarchy in parallel (see sc_port_registry::complete_binding).
+// ----------------------------------------------------------------------------
+
+class sc_bind_resolver
+{
+public:
+
+    // ports taken by a thread at once, smaller levels are not worth it
+    enum { chunk_size = 1024, min_ports = 4 * chunk_size };
+
+    explicit sc_bind_resolver( unsigned workers );
+    ~sc_bind_resolver();
+
+    // resolve the parents of the ports [first, last), returns when done
+    void resolve( sc_port_base** first, sc_port_base** last );
+
+private:
+
+    void execute();
+    static void* worker_main( void* );
+
+private:
+#if SC_CPLUSPLUS >= 201103L
+    std::vector<std::thread> m_threads;
+#else
+    std::vector<pthread_t>   m_threads;
+#endif
+    sc_host_mutex            m_mutex;     // guards m_next.
+    sc_host_semaphore        m_start;     // posted per thread and level.
+    sc_host_semaphore        m_done;      // posted by a thread per level.
+    sc_port_base**           m_next;      // next port to resolve.
+    sc_port_base**           m_last;      // end of the level.
+    bool                     m_shutdown;
+};
+
+// starts workers - 1 host threads, the calling thread is the first worker
+
+sc_bind_resolver::sc_bind_resolver( unsigned workers )
+  : m_threads(), m_mutex(), m_start( 0 ), m_done( 0 )
+  , m_next( 0 ), m_last( 0 ), m_shutdown( false )
+{
+    sc_assert( workers > 1 );
+    for( unsigned i = 1; i < workers; ++ i ) {
+#if SC_CPLUSPLUS >= 201103L
+        m_threads.push_back( std::thread( &worker_main, this ) );
+#else
+        pthread_t thread;
+        int result = pthread_create( &thread, NULL, &worker_main, this );
+        sc_assert( result == 0 );
+        m_threads.push_back( thread );
+#endif
+    }
+}
+
+sc_bind_resolver::~sc_bind_resolver()
+{
+    m_shutdown = true;
+    for( std::size_t i = 0; i < m_threads.size(); ++ i ) {
+        m_start.post();
+    }
+    for( std::size_t i = 0; i < m_threads.size(); ++ i ) {
+#if SC_CPLUSPLUS >= 201103L
+        m_threads[i].join();
+#else
+        pthread_join( m_threads[i], NULL );
+#endif
+    }
+}
+
+void
+sc_bind_resolver::resolve( sc_port_base** first, sc_port_base** last )
+{
+    m_next = first;
+    m_last = last;
+    for( std::size_t i = 0; i < m_threads.size(); ++ i ) {
+        m_start.post();
+    }
+    execute();
+    for( std::size_t i = 0; i < m_threads.size(); ++ i ) {
+        m_done.wait();
+    }
+}
+
+// resolve chunks of ports until the level is done
+
+void
+sc_bind_resolver::execute()
+{
+    for( ;; ) {
+        m_mutex.lock();
+        sc_port_base** first = m_next;
+        sc_port_base** last  = first + std::min<std::ptrdiff_t>
+                                 ( chunk_size, m_last - first );
+        m_next = last;
+        m_mutex.unlock();
+
+        if( first == last ) {
+            return;
+        }
+        for( ; first != last; ++ first ) {
+            (*first)->resolve_parents();
+        }
+    }
+}
+
+void*
+sc_bind_resolver::worker_main( void* arg_p )
+{
+    sc_bind_resolver* resolver_p = static_cast<sc_bind_resolver*>( arg_p );
+    for( ;; ) {
+        resolver_p->m_start.wait();
+        if( resolver_p->m_shutdown ) {
+            return 0;
+        }
+        resolver_p->execute();
+        resolver_p->m_done.post();
+    }
+}
+
+#endif // SC_HAS_PARALLEL_EVALUATION_
+
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_port_registry
 //
@@ -659,10 +876,16 @@ sc_port_registry::insert( sc_port_base* port_ )
 void
 sc_port_registry::remove( sc_port_base* port_ )
 {
-    int i;
-    for( i = size() - 1; i >= 0; -- i ) {
-	if( port_ == m_port_vec[i] ) {
-	    break;
+    // search outwards from the last removal, ports are mostly deleted in
+    // (or in the reverse) order of their creation, e.g. by sc_vector
+    int i = -1;
+    int hint = std::min( m_remove_i, size() - 1 );
+    for( int d = 0; i < 0 && hint >= 0 &&
+                    ( hint - d >= 0 || hint + d < size() ); ++ d ) {
+	if( hint + d < size() && port_ == m_port_vec[hint + d] ) {
+	    i = hint + d;
+	} else if( hint - d >= 0 && port_ == m_port_vec[hint - d] ) {
+	    i = hint - d;
 	}
     }
     if( i == -1 ) {
@@ -673,6 +896,7 @@ sc_port_registry::remove( sc_port_base* port_ )
     // remove
     m_port_vec[i] = m_port_vec.back();
     m_port_vec.pop_back();
+    m_remove_i = i;
 }
 
 
@@ -681,6 +905,7 @@ sc_port_registry::remove( sc_port_base* port_ )
 sc_port_registry::sc_port_registry( sc_simcontext& simc_ )
 : m_construction_done(0),
   m_port_vec(),
+  m_remove_i( 0 ),
   m_simc( &simc_ )
 {
 }
@@ -711,11 +936,76 @@ sc_port_registry::construction_done()
 
 // called when when elaboration is done
 
+//
+// The parent ports are resolved first, level by level, so that each port
+// copies the interfaces of its parents only once, after the parents were
+// resolved themselves (see sc_port_base::order_binding). The ports of a
+// level do not depend on each other, large levels are resolved on host
+// threads if the parallel evaluation is enabled (see
+// sc_set_parallel_evaluation). The rest of the binding, which registers
+// the ports with their interfaces and processes, is completed sequentially
+// in the order of the former recursive completion: from the last port on,
+// each port after its parents.
+
 void
 sc_port_registry::complete_binding()
 {
+    std::vector<sc_port_base*> order;
+    order.reserve( size() );
     for( int i = size() - 1; i >= 0; -- i ) {
-        m_port_vec[i]->complete_binding();
+        m_port_vec[i]->order_binding( order );
+    }
+
+    // SORT THE PORTS WITH PARENTS BY LEVEL AND RESOLVE THE PARENTS:
+
+    int max_level = 0;
+    for( std::size_t i = 0; i < order.size(); ++ i ) {
+        max_level = std::max( max_level, order[i]->m_bind_info->level );
+    }
+    if( max_level > 0 ) {
+        std::vector<std::size_t> level_begin( max_level + 2, 0 );
+        for( std::size_t i = 0; i < order.size(); ++ i ) {
+            ++ level_begin[order[i]->m_bind_info->level + 1];
+        }
+        for( int level = 0; level <= max_level; ++ level ) {
+            level_begin[level + 1] += level_begin[level];
+        }
+        std::vector<sc_port_base*> by_level( order.size() );
+        std::vector<std::size_t>   level_next( level_begin );
+        for( std::size_t i = 0; i < order.size(); ++ i ) {
+            by_level[level_next[order[i]->m_bind_info->level] ++] = order[i];
+        }
+
+#if SC_HAS_PARALLEL_EVALUATION_
+        sc_bind_resolver* resolver_p = 0;
+#endif
+        for( int level = 1; level <= max_level; ++ level ) {
+            sc_port_base** first = &by_level[0] + level_begin[level];
+            sc_port_base** last  = &by_level[0] + level_begin[level + 1];
+#if SC_HAS_PARALLEL_EVALUATION_
+            if( last - first >= sc_bind_resolver::min_ports &&
+                sc_get_parallel_evaluation() > 1 ) {
+                if( resolver_p == 0 ) {
+                    resolver_p =
+                      new sc_bind_resolver( sc_get_parallel_evaluation() );
+                }
+                resolver_p->resolve( first, last );
+                continue;
+            }
+#endif
+            for( ; first != last; ++ first ) {
+                (*first)->resolve_parents();
+            }
+        }
+#if SC_HAS_PARALLEL_EVALUATION_
+        delete resolver_p;
+#endif
+    }
+
+    // COMPLETE THE BINDING:
+
+    for( std::size_t i = 0; i < order.size(); ++ i ) {
+        order[i]->complete_binding();
     }
 }
 
@@ -77,7 +77,10 @@ enum sc_port_policy
 class SC_API sc_port_base
 : public sc_object
 {
+    friend class sc_bind_resolver;
+    friend class sc_method_levelizer;
     friend class sc_module;
+    friend class sc_parallel_evaluator;
     friend class sc_port_registry;
     friend class sc_sensitive;
     friend class sc_sensitive_pos;
@@ -164,9 +167,9 @@ private:
     int pbind( sc_port_base& );
 
 
-    // support methods
-    int first_parent();
-    void insert_parent( int );
+    // support methods, called by sc_port_registry::complete_binding
+    void order_binding( std::vector<sc_port_base*>& order_ );
+    void resolve_parents();
 
     // called when construction is done
     void construction_done();
@@ -245,6 +248,7 @@ private:
 
     int                         m_construction_done;
     std::vector<sc_port_base*>  m_port_vec;
+    int                         m_remove_i;   // last removal.
     sc_simcontext*              m_simc;
 
 private:
@@ -552,18 +556,7 @@ sc_port_b<IF>::add_interface( sc_interface* interface_ )
     IF* iface = dynamic_cast<IF*>( interface_ );
     sc_assert( iface != 0 );
 
-    // make sure that the interface is not already bound:
-
-    int if_n = size();
-    for ( int i = 0; i < if_n; i++ )
-    {
-        if ( iface == m_interface_vec[i] )
-        {
-            report_error( SC_ID_BIND_IF_TO_PORT_,
-                          "interface already bound to port" );
-            // may continue, if suppressed
-        }
-    }
+    // an interface bound twice is reported by complete_binding
 
     // "bind" the interface and make sure our short cut for 0 is set up.
 
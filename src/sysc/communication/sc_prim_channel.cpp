@@ -32,10 +32,17 @@
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_object_int.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
+#include "sysc/communication/sc_async_atomic.h"
 
 #ifndef SC_DISABLE_ASYNC_UPDATES
 #  include "sysc/communication/sc_host_mutex.h"
 #  include "sysc/communication/sc_host_semaphore.h"
+#  if SC_CPLUSPLUS >= 201103L
+#    include <chrono>
+#  elif !defined(WIN32) && !defined(_WIN32)
+#    include <time.h>
+#  endif
 #endif
 
 #include <algorithm> // std::find
@@ -48,12 +55,28 @@ namespace sc_core {
 //  Abstract base class of all primitive channel classes.
 // ----------------------------------------------------------------------------
 
+// the update request of a channel from outside the simulator, see
+// sc_prim_channel_registry::async_update_list
+
+struct sc_prim_channel::async_request
+{
+    explicit async_request( sc_prim_channel& channel_ )
+      : channel_p( &channel_ ), pending( 0 ), time( 0 ), next_p( 0 ) {}
+
+    sc_prim_channel*     channel_p;
+    sc_async_atomic<int> pending;   // pushed, but not accepted yet.
+    sc_dt::uint64        time;      // host time of the request, if measured.
+    async_request*       next_p;
+};
+
 // constructors
 
 sc_prim_channel::sc_prim_channel()
 : sc_object( 0 ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( 0 ) 
+  m_update_next_p( 0 ),
+  m_eager_update( false ),
+  m_batch_update( 0 )
 {
     m_registry->insert( *this );
 }
@@ -61,7 +84,9 @@ sc_prim_channel::sc_prim_channel()
 sc_prim_channel::sc_prim_channel( const char* name_ )
 : sc_object( name_ ),
   m_registry( simcontext()->get_prim_channel_registry() ),
-  m_update_next_p( 0 )
+  m_update_next_p( 0 ),
+  m_eager_update( false ),
+  m_batch_update( 0 )
 {
     m_registry->insert( *this );
 }
@@ -72,6 +97,7 @@ sc_prim_channel::sc_prim_channel( const char* name_ )
 sc_prim_channel::~sc_prim_channel()
 {
     m_registry->remove( *this );
+    delete m_async_request_p.load();
 }
 
 
@@ -142,59 +168,185 @@ sc_prim_channel::simulation_done()
     end_of_simulation();
 }
 
+// called by sc_save_checkpoint and sc_restore_checkpoint (does nothing)
+
+void
+sc_prim_channel::save_state( std::ostream& ) const
+{}
+
+void
+sc_prim_channel::restore_state( std::istream& )
+{}
+
+#ifndef SC_DISABLE_ASYNC_UPDATES
+
+// monotonic host time in nanoseconds, used for the drain latency
+
+static sc_dt::uint64
+sc_async_host_time()
+{
+#if SC_CPLUSPLUS >= 201103L
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch() ).count();
+#elif !defined(WIN32) && !defined(_WIN32)
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return static_cast<sc_dt::uint64>( ts.tv_sec ) * 1000000000u + ts.tv_nsec;
+#else
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter( &count );
+    QueryPerformanceFrequency( &freq );
+    return static_cast<sc_dt::uint64>(
+             count.QuadPart / freq.QuadPart * 1000000000u
+           + count.QuadPart % freq.QuadPart * 1000000000u / freq.QuadPart );
+#endif
+}
+
+#endif // ! SC_DISABLE_ASYNC_UPDATES
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_update_batch
+//
+//  Abstract base class of the update batches.
+// ----------------------------------------------------------------------------
+
+sc_update_batch::~sc_update_batch()
+{}
+
+// allocates the index of a new type of update batch, the types are shared
+// by the simulation contexts of all host threads
+
+int
+sc_update_batch::new_type()
+{
+    static sc_async_atomic<int> types;
+    return types.fetch_add( 1 );
+}
+
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_prim_channel_registry::async_update_list
 //
 //  Thread-safe list of pending external updates
+//
+//  External threads push the requests of the channels onto a lock-free
+//  stack. Each channel has a request record of its own, allocated by its
+//  first request, which is pushed only if it is not pending yet. The
+//  simulator takes the whole stack at once at the beginning of the update
+//  phase and accepts the requests in the order they were made. A waiting
+//  simulator is only woken up by the first request after it went to sleep.
 //  FOR INTERNAL USE ONLY!
 // ----------------------------------------------------------------------------
 
 class sc_prim_channel_registry::async_update_list
 {
 #ifndef SC_DISABLE_ASYNC_UPDATES
+
+    typedef sc_prim_channel::async_request request;
+
 public:
 
     bool pending() const
     {
-	return m_push_queue.size() != 0;
+	return m_head.load() != 0;
     }
 
     void suspend()
     {
-        if( m_has_suspending_channels ) {
+        if( !m_has_suspending_channels )
+            return;
+
+        while( !pending() ) {
+            m_waiting.store( 1 );
+            if( pending() ) {
+                // a request raced with us, consume its wake-up, if any
+                if( !m_waiting.exchange( 0 ) )
+                    m_suspend_semaphore.wait();
+                break;
+            }
             m_suspend_semaphore.wait();
-            m_suspend_semaphore.post(); // replace token
         }
     }
 
     void append( sc_prim_channel& prim_channel_ )
     {
-        sc_scoped_lock lock( m_mutex );
-        m_push_queue.push_back( &prim_channel_ );
-        m_suspend_semaphore.post();
-        // return releases the mutex
+        request* req = prim_channel_.m_async_request_p.load();
+        if( SC_UNLIKELY_( req == 0 ) )
+            req = first_request( prim_channel_ );
+
+        // a pending request covers this one, the plain load keeps the
+        // record of a busy channel from bouncing between the writers
+        if( req->pending.load() || req->pending.exchange( 1 ) )
+            return;
+
+        req->time = m_measure_latency.load() ? sc_async_host_time() : 0;
+        req->next_p = m_head.load();
+        while( !m_head.compare_exchange( req->next_p, req ) ) {}
+
+        if( m_waiting.load() && m_waiting.exchange( 0 ) )
+            m_suspend_semaphore.post();
+    }
+
+    // install the request record of a channel, racing writers agree on one
+    static request* first_request( sc_prim_channel& prim_channel_ )
+    {
+        request* req = new request( prim_channel_ );
+        request* installed = 0;
+        while( !prim_channel_.m_async_request_p.compare_exchange( installed,
+                                                                 req ) ) {
+            if( installed != 0 ) {
+                delete req;
+                return installed;
+            }
+        }
+        return req;
     }
 
     void accept_updates()
     {
-	sc_assert( ! m_pop_queue.size() );
+	request* req = m_head.exchange( 0 );
+
+	// restore the request order
+	request* first = 0;
+	while( req != 0 )
 	{
-	    sc_scoped_lock lock( m_mutex );
-	    m_push_queue.swap( m_pop_queue );
-	    // leaving the block releases the mutex
+	    request* next = req->next_p;
+	    req->next_p = first;
+	    first = req;
+	    req = next;
 	}
 
-	std::vector< sc_prim_channel* >::const_iterator
-	    it = m_pop_queue.begin(), end = m_pop_queue.end();
-	while( it!= end )
+	sc_dt::uint64 now = m_measure_latency.load() ? sc_async_host_time() : 0;
+	sc_dt::uint64 batch = 0;
+	while( first != 0 )
 	{
+	    req = first;
+	    first = req->next_p;
+
+	    if( now != 0 && req->time != 0 ) {
+	        double latency = ( now > req->time )
+	                       ? 1e-9 * ( now - req->time ) : 0.0;
+	        m_stats.total_latency += latency;
+	        if( latency > m_stats.max_latency )
+	            m_stats.max_latency = latency;
+	    }
+
+	    // the next request of the channel is pushed again, and updates
+	    // the values written from now on
+	    req->pending.store( 0 );
+
 	    // we use request_update instead of perform_update
 	    // to skip duplicates
-	    (*it++)->request_update();
-	    int sem_trywait = m_suspend_semaphore.trywait(); // this must never block !
-	    sc_assert( sem_trywait == 0 );
+	    req->channel_p->request_update();
+	    ++batch;
+	}
+
+	if( batch != 0 ) {
+	    m_stats.requests += batch;
+	    m_stats.batches++;
+	    if( batch > m_stats.max_batch )
+	        m_stats.max_batch = batch;
 	}
-	m_pop_queue.clear();
     }
 
     bool attach_suspending( sc_prim_channel& p )
@@ -226,15 +378,35 @@ public:
         // return releases the mutex
     }
 
-    async_update_list() : m_has_suspending_channels() {}
+    const sc_async_update_stats& stats() const
+    {
+        return m_stats;
+    }
+
+    void measure_latency( bool enable )
+    {
+        m_measure_latency.store( enable );
+    }
+
+    bool measure_latency() const
+    {
+        return m_measure_latency.load() != 0;
+    }
+
+    // the request records belong to the channels
+    async_update_list()
+      : m_head( 0 ), m_waiting( 0 ), m_measure_latency( 0 )
+      , m_has_suspending_channels() {}
 
 private:
-    sc_host_mutex                   m_mutex;
+    sc_async_atomic<request*>       m_head;      // most recent request.
+    sc_async_atomic<int>            m_waiting;   // simulator is suspended.
+    sc_async_atomic<int>            m_measure_latency; // read host time.
+    sc_host_mutex                   m_mutex;     // suspending channels.
     sc_host_semaphore               m_suspend_semaphore;
-    std::vector< sc_prim_channel* > m_push_queue;
-    std::vector< sc_prim_channel* > m_pop_queue;
     std::vector< sc_prim_channel* > m_suspending_channels;
     bool                            m_has_suspending_channels;
+    sc_async_update_stats           m_stats;     // simulator thread only.
 
 #endif // ! SC_DISABLE_ASYNC_UPDATES
 };
@@ -277,13 +449,20 @@ sc_prim_channel_registry::insert( sc_prim_channel& prim_channel_ )
 void
 sc_prim_channel_registry::remove( sc_prim_channel& prim_channel_ )
 {
-    int i;
-    for( i = 0; i < size(); ++ i ) {
-	if( &prim_channel_ == m_prim_channel_vec[i] ) {
-	    break;
+    // search outwards from the last removal, channels are mostly deleted
+    // in (or in the reverse) order of their creation, e.g. by sc_vector
+    sc_prim_channel* channel_p = &prim_channel_;
+    int i = -1;
+    int hint = std::min( m_remove_i, size() - 1 );
+    for( int d = 0; i < 0 && hint >= 0 &&
+                    ( hint - d >= 0 || hint + d < size() ); ++ d ) {
+	if( hint + d < size() && channel_p == m_prim_channel_vec[hint + d] ) {
+	    i = hint + d;
+	} else if( hint - d >= 0 && channel_p == m_prim_channel_vec[hint - d] ) {
+	    i = hint - d;
 	}
     }
-    if( i == size() ) {
+    if( i < 0 ) {
         SC_REPORT_ERROR( SC_ID_REMOVE_PRIM_CHANNEL_, 0 );
         return;
     }
@@ -291,6 +470,7 @@ sc_prim_channel_registry::remove( sc_prim_channel& prim_channel_ )
     // remove
     m_prim_channel_vec[i] = m_prim_channel_vec.back();
     m_prim_channel_vec.pop_back();
+    m_remove_i = i;
 
 #ifndef SC_DISABLE_ASYNC_UPDATES
     // remove, if async suspending channel
@@ -319,6 +499,16 @@ sc_prim_channel_registry::async_suspend()
 #endif
 }
 
+// record an update request of a method executed by a parallel evaluation
+// worker, the request is replayed before the update phase
+
+void
+sc_prim_channel_registry::defer_update( sc_prim_channel& prim_channel_ )
+{
+    sc_parallel_evaluator::defer( sc_parallel_evaluator::op_update,
+                                  &prim_channel_ );
+}
+
 void
 sc_prim_channel_registry::async_request_update( sc_prim_channel& prim_channel_ )
 {
@@ -329,6 +519,37 @@ sc_prim_channel_registry::async_request_update( sc_prim_channel& prim_channel_ )
 #endif
 }
 
+sc_async_update_stats
+sc_prim_channel_registry::async_update_stats() const
+{
+#ifndef SC_DISABLE_ASYNC_UPDATES
+    return m_async_update_list_p->stats();
+#else
+    return sc_async_update_stats();
+#endif
+}
+
+void
+sc_prim_channel_registry::async_update_latency( bool enable )
+{
+#ifndef SC_DISABLE_ASYNC_UPDATES
+    m_async_update_list_p->measure_latency( enable );
+#else
+    if( enable )
+        SC_REPORT_ERROR( SC_ID_NO_ASYNC_UPDATE_, "latency measurement" );
+#endif
+}
+
+bool
+sc_prim_channel_registry::async_update_latency() const
+{
+#ifndef SC_DISABLE_ASYNC_UPDATES
+    return m_async_update_list_p->measure_latency();
+#else
+    return false;
+#endif
+}
+
 bool
 sc_prim_channel_registry::async_attach_suspending(sc_prim_channel& p)
 {
@@ -381,6 +602,29 @@ sc_prim_channel_registry::perform_update()
 	next_p = now_p->m_update_next_p;
 	now_p->perform_update();
     }
+
+    // Update the channels in the update batches.
+
+    sc_update_batch* batch_p = m_batch_list_p;
+    m_batch_list_p = 0;
+    while ( batch_p )
+    {
+        sc_update_batch* next_batch_p = batch_p->m_next_p;
+        batch_p->perform_update();
+        batch_p = next_batch_p;
+    }
+}
+
+// take ownership of the update batch of the given type
+
+sc_update_batch*
+sc_prim_channel_registry::insert_update_batch( int type_,
+                                               sc_update_batch* batch_p )
+{
+    if( type_ >= static_cast<int>( m_update_batches.size() ) )
+        m_update_batches.resize( type_ + 1, 0 );
+    m_update_batches[type_] = batch_p;
+    return batch_p;
 }
 
 // constructor
@@ -389,8 +633,13 @@ sc_prim_channel_registry::sc_prim_channel_registry( sc_simcontext& simc_ )
   :  m_async_update_list_p(0)
   ,  m_construction_done(0)
   ,  m_prim_channel_vec()
+  ,  m_remove_i(0)
   ,  m_simc( &simc_ )
   ,  m_update_list_p((sc_prim_channel*)sc_prim_channel::list_end)
+  ,  m_defer_updates(false)
+  ,  m_batch_updates(true)
+  ,  m_update_batches()
+  ,  m_batch_list_p(0)
 {
 #   ifndef SC_DISABLE_ASYNC_UPDATES
         m_async_update_list_p = new async_update_list();
@@ -403,6 +652,8 @@ sc_prim_channel_registry::sc_prim_channel_registry( sc_simcontext& simc_ )
 sc_prim_channel_registry::~sc_prim_channel_registry()
 {
     delete m_async_update_list_p;
+    for( std::size_t i = 0; i < m_update_batches.size(); ++i )
+        delete m_update_batches[i];
 }
 
 // called when construction is done
@@ -452,6 +703,45 @@ sc_prim_channel_registry::simulation_done()
     }
 }
 
+// ----------------------------------------------------------------------------
+//  FUNCTION : sc_get_async_update_stats
+//
+//  Returns the counters of the external updates accepted by the current
+//  simulation context so far, e.g. to compute the async update throughput
+//  (requests per second) and the mean drain latency (total_latency divided
+//  by requests).
+// ----------------------------------------------------------------------------
+
+sc_async_update_stats
+sc_get_async_update_stats()
+{
+    return sc_get_curr_simcontext()->get_prim_channel_registry()
+             ->async_update_stats();
+}
+
+// ----------------------------------------------------------------------------
+//  FUNCTION : sc_set_async_update_latency
+//
+//  Enables the measurement of the host time between an external update
+//  request and its acceptance in the current simulation context, which
+//  reads the host clock on every request and every update phase that
+//  accepts requests. Disabled by default.
+// ----------------------------------------------------------------------------
+
+void
+sc_set_async_update_latency( bool enable )
+{
+    sc_get_curr_simcontext()->get_prim_channel_registry()
+      ->async_update_latency( enable );
+}
+
+bool
+sc_get_async_update_latency()
+{
+    return sc_get_curr_simcontext()->get_prim_channel_registry()
+             ->async_update_latency();
+}
+
 } // namespace sc_core
 
 /*****************************************************************************
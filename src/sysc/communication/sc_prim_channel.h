@@ -30,11 +30,16 @@
 #define SC_PRIM_CHANNEL_H
 
 #include "sysc/kernel/sc_object.h"
+#include "sysc/communication/sc_async_atomic.h"
 #include "sysc/kernel/sc_wait.h"
 #include "sysc/kernel/sc_wait_cthread.h"
+#include <limits>
+#include <typeinfo>
 
 namespace sc_core {
 
+class sc_update_batch;
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_prim_channel
 //
@@ -44,10 +49,14 @@ namespace sc_core {
 class SC_API sc_prim_channel
 : public sc_object
 {
+    friend class sc_checkpoint;
+    friend class sc_kernel_profiler;
+    friend class sc_method_levelizer;
     friend class sc_prim_channel_registry;
+    friend class sc_update_batch;
 
 public:
-    enum { list_end = 0xdb };
+    enum { list_end = 0xdb, list_batched = 0xdc };
 public:
     virtual const char* kind() const
         { return "sc_prim_channel"; }
@@ -64,6 +73,12 @@ public:
 
 protected:
 
+    // request the update to be performed by the update batch of type B
+    // during the update phase, if the channel is exactly of the type
+    // B::channel_type, and the update method otherwise
+    template< class B >
+    inline void request_batched_update();
+
     // constructors
     sc_prim_channel();
     explicit sc_prim_channel( const char* );
@@ -86,6 +101,13 @@ protected:
     // called by simulation_done (does nothing by default)
     virtual void end_of_simulation();
 
+    // called by sc_save_checkpoint (saves nothing by default), sets the
+    // failbit of the stream if the state cannot be saved
+    virtual void save_state( std::ostream& ) const;
+
+    // called by sc_restore_checkpoint with the state saved by save_state
+    virtual void restore_state( std::istream& );
+
     // indicate that this channel is async and could call async_request_update
     // therefore, the kernel should arrange to suspend rather than exit while
     // this channel is attached.
@@ -219,12 +241,104 @@ private:
     sc_prim_channel( const sc_prim_channel& );
     sc_prim_channel& operator = ( const sc_prim_channel& );
 
+    // the update request of the channel from outside the simulator
+    struct async_request;
+
 private:
 
     sc_prim_channel_registry* m_registry;          // Update list manager.
     sc_prim_channel*          m_update_next_p;     // Next entry in update list.
+    bool                      m_eager_update;      // See sc_method_levelizer.
+    unsigned char             m_batch_update;      // May updates be batched?
+    sc_async_atomic<async_request*> m_async_request_p; // On first async use.
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_update_batch
+//
+//  Abstract base class of the update batches. An update batch collects
+//  the channels of one type, whose update is requested in an evaluation
+//  phase, and updates them in one loop during the update phase, instead
+//  of calling their virtual update method one by one.
+//  FOR INTERNAL USE ONLY!
+// ----------------------------------------------------------------------------
+
+class SC_API sc_update_batch
+{
+    friend class sc_kernel_profiler;
+    friend class sc_prim_channel;
+    friend class sc_prim_channel_registry;
+
+protected:
+
+    typedef std::vector<sc_prim_channel*> channel_vec;
+
+    sc_update_batch()
+      : m_channels(), m_next_p( 0 )
+    {}
+
+    virtual ~sc_update_batch();
+
+    // updates the channels in m_channels
+    virtual void update() = 0;
+
+    // marks a channel of m_channels as updated
+    static void updated( sc_prim_channel& channel_ )
+        { channel_.m_update_next_p = 0; }
+
+protected:
+    channel_vec m_channels;  // channels to update.
+
+private:
+
+    // allocates the index of a new type of update batch
+    static int new_type();
+
+    // called during the update phase of a delta cycle (if requested)
+    void perform_update()
+        { update(); m_channels.clear(); }
+
+    // disabled
+    sc_update_batch( const sc_update_batch& );
+    sc_update_batch& operator = ( const sc_update_batch& );
+
+private:
+    sc_update_batch* m_next_p;  // next batch to update.
+};
+
+
+// ----------------------------------------------------------------------------
+//  STRUCT : sc_async_update_stats
+//
+//  Counters of the update requests from processes external to the
+//  simulator, collected when the requests are accepted in the update phase.
+//  Repeated requests of a channel before the first one is accepted count
+//  once. The latencies are only measured if enabled with
+//  sc_set_async_update_latency.
+// ----------------------------------------------------------------------------
+
+struct SC_API sc_async_update_stats
+{
+    sc_dt::uint64 requests;       // accepted channel update requests.
+    sc_dt::uint64 batches;        // update phases accepting requests.
+    sc_dt::uint64 max_batch;      // most requests accepted at once.
+    double        total_latency;  // sum of the request to accept times (s).
+    double        max_latency;    // longest request to accept time (s).
+
+    sc_async_update_stats()
+      : requests(0), batches(0), max_batch(0)
+      , total_latency(0.0), max_latency(0.0)
+    {}
 };
 
+// statistics of the current simulation context
+SC_API sc_async_update_stats sc_get_async_update_stats();
+
+// measure the request to accept times of the current simulation context
+// (off by default, as it reads the host clock on every request)
+SC_API void sc_set_async_update_latency( bool enable );
+SC_API bool sc_get_async_update_latency();
 
 // ----------------------------------------------------------------------------
 //  CLASS : sc_prim_channel_registry
@@ -235,6 +349,9 @@ private:
 
 class sc_prim_channel_registry
 {
+    friend class sc_kernel_profiler;
+    friend class sc_method_levelizer;
+    friend class sc_parallel_evaluator;
     friend class sc_simcontext;
 
 public:
@@ -249,9 +366,30 @@ public:
     inline void request_update( sc_prim_channel& );
     void async_request_update( sc_prim_channel& );
 
+    // request the update of a channel by an update batch
+    inline void request_update( sc_prim_channel&, sc_update_batch& );
+
+    // may update requests be batched (not while methods are evaluated in
+    // parallel or levelized)?
+    bool batch_updates() const
+        { return m_batch_updates && !m_defer_updates; }
+
+    // the update batch of the given type, 0 if not created yet or if
+    // update requests may not be batched
+    sc_update_batch* update_batch( int type_ ) const
+    {
+        return batch_updates() &&
+               type_ < static_cast<int>( m_update_batches.size() )
+               ? m_update_batches[type_] : 0;
+    }
+
+    // take ownership of the update batch of the given type
+    sc_update_batch* insert_update_batch( int type_, sc_update_batch* );
+
     bool pending_updates() const
     { 
         return m_update_list_p != (sc_prim_channel*)sc_prim_channel::list_end 
+               || m_batch_list_p != 0
                || pending_async_updates();
     }   
 
@@ -271,6 +409,13 @@ public:
     bool async_attach_suspending(sc_prim_channel&);
     bool async_detach_suspending(sc_prim_channel&);
 
+    // counters of the accepted external updates
+    sc_async_update_stats async_update_stats() const;
+
+    // measure the request to accept times of the external updates?
+    void async_update_latency( bool enable );
+    bool async_update_latency() const;
+
 private:
 
     // constructor
@@ -294,6 +439,9 @@ private:
     // called after simulation ends
     void simulation_done();
 
+    // called while methods are evaluated in parallel
+    void defer_update( sc_prim_channel& );
+
     // disabled
     sc_prim_channel_registry();
     sc_prim_channel_registry( const sc_prim_channel_registry& );
@@ -305,8 +453,13 @@ private:
     async_update_list*            m_async_update_list_p; // external updates.
     int                           m_construction_done;   // # of constructs.
     std::vector<sc_prim_channel*> m_prim_channel_vec;    // existing channels.
+    int                           m_remove_i;            // last removal.
     sc_simcontext*                m_simc;                // simulator context.
     sc_prim_channel*              m_update_list_p;       // internal updates.
+    bool                          m_defer_updates;       // parallel evaluation.
+    bool                          m_batch_updates;       // batching enabled.
+    std::vector<sc_update_batch*> m_update_batches;      // batches by type.
+    sc_update_batch*              m_batch_list_p;        // batched updates.
 };
 
 
@@ -323,10 +476,28 @@ inline
 void
 sc_prim_channel_registry::request_update( sc_prim_channel& prim_channel_ )
 {
+    if( SC_UNLIKELY_(m_defer_updates) ) {
+        defer_update( prim_channel_ );
+        return;
+    }
     prim_channel_.m_update_next_p = m_update_list_p;
     m_update_list_p = &prim_channel_;
 }
 
+inline
+void
+sc_prim_channel_registry::request_update( sc_prim_channel& prim_channel_,
+                                          sc_update_batch& batch_ )
+{
+    if( batch_.m_channels.empty() ) {
+        batch_.m_next_p = m_batch_list_p;
+        m_batch_list_p = &batch_;
+    }
+    prim_channel_.m_update_next_p =
+      (sc_prim_channel*)sc_prim_channel::list_batched;
+    batch_.m_channels.push_back( &prim_channel_ );
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_prim_channel
 //
@@ -344,6 +515,40 @@ sc_prim_channel::request_update()
     }
 }
 
+// request the update by an update batch (to be executed during the update
+// phase), whether the channel is exactly of the type of the channels in the
+// batch is checked once, on the first request
+
+template< class B >
+inline
+void
+sc_prim_channel::request_batched_update()
+{
+    enum { batch_unknown, batch_never, batch_always };
+
+    if( m_update_next_p ) {
+        return;
+    }
+    static const int batch_type = sc_update_batch::new_type();
+    sc_update_batch* batch_p = m_registry->update_batch( batch_type );
+    if( SC_LIKELY_(batch_p != 0 && m_batch_update == batch_always) ) {
+        m_registry->request_update( *this, *batch_p );
+        return;
+    }
+    if( m_batch_update == batch_unknown ) {
+        m_batch_update = typeid( *this ) == typeid( typename B::channel_type )
+                         ? batch_always : batch_never;
+    }
+    if( m_batch_update == batch_never || !m_registry->batch_updates() ) {
+        m_registry->request_update( *this );
+        return;
+    }
+    if( !batch_p ) {
+        batch_p = m_registry->insert_update_batch( batch_type, new B );
+    }
+    m_registry->request_update( *this, *batch_p );
+}
+
 // request the update method from external to the simulator (to be executed 
 // during the update phase)
 
@@ -380,6 +585,87 @@ sc_prim_channel::perform_update()
 }
 
 
+// ----------------------------------------------------------------------------
+//  FUNCTION TEMPLATES : sc_save_value, sc_restore_value
+//
+//  Write and read a value in save_state and restore_state of a primitive
+//  channel, with the stream operators of its type. The values of pointers
+//  and of types without an operator >> cannot be read back: sc_save_value
+//  does not write them and sets the failbit of the stream instead, and the
+//  channel is reported as not saved by sc_save_checkpoint.
+// ----------------------------------------------------------------------------
+
+namespace sc_value_io {
+
+  // the operator >> found for types without one
+  struct no_extractor {};
+  struct any_value { template< class T > any_value( const T& ) {} };
+  no_extractor operator >> ( ::std::istream&, const any_value& );
+
+  char         extracted( ::std::istream& );
+  char       (&extracted( const no_extractor& ))[2];
+
+  template< class T >
+  struct extractable
+  {
+      static ::std::istream& stream();
+      static T&              object();
+      enum { value = sizeof( extracted( stream() >> object() ) ) == 1 };
+  };
+
+  template< class T >
+  struct extractable<T*>
+  {
+      enum { value = false };
+  };
+
+  template< class T, bool = extractable<T>::value >
+  struct value_io
+  {
+      static bool save( ::std::ostream& os, const T& value_ )
+      {
+          ::std::streamsize precision = os.precision();
+          if( ::std::numeric_limits<T>::is_specialized ) {
+              os.precision( ::std::numeric_limits<T>::digits10 + 3 );
+          }
+          os << value_;
+          os.precision( precision );
+          return !os.fail();
+      }
+
+      static bool restore( ::std::istream& is, T& value_ )
+          { return !( is >> value_ ).fail(); }
+  };
+
+  template< class T >
+  struct value_io<T,false>
+  {
+      static bool save( ::std::ostream& os, const T& )
+          { os.setstate( ::std::ios::failbit ); return false; }
+
+      static bool restore( ::std::istream&, T& )
+          { return false; }
+  };
+
+} // namespace sc_value_io
+
+template< class T >
+inline
+bool
+sc_save_value( ::std::ostream& os, const T& value_ )
+{
+    return sc_value_io::value_io<T>::save( os, value_ );
+}
+
+template< class T >
+inline
+bool
+sc_restore_value( ::std::istream& is, T& value_ )
+{
+    return sc_value_io::value_io<T>::restore( is, value_ );
+}
+
+
 } // namespace sc_core
 
 
@@ -0,0 +1,771 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_shm_channel.cpp -- Channels to other host processes over shared memory.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/communication/sc_shm_channel.h"
+#include "sysc/kernel/sc_simcontext.h"
+
+#include <cstring>
+
+// The ring needs POSIX shared memory and the GCC atomic builtins, the
+// channels additionally need host threads for their watchers.
+
+#if !( defined(WIN32) || defined(_WIN32) ) && defined(__GNUC__)
+#  define SC_SHM_RING_ 1
+#  include <cerrno>
+#  include <fcntl.h>
+#  include <pthread.h>
+#  include <sched.h>
+#  include <signal.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <time.h>
+#  include <unistd.h>
+#else
+#  define SC_SHM_RING_ 0
+#endif
+
+#if SC_SHM_RING_ && !defined(SC_DISABLE_ASYNC_UPDATES)
+#  define SC_SHM_CHANNEL_ 1
+#  include "sysc/communication/sc_host_semaphore.h"
+#else
+#  define SC_SHM_CHANNEL_ 0
+#endif
+
+namespace sc_core {
+
+#if SC_SHM_RING_
+
+static const unsigned ring_magic = 0x5c5e1a01u;
+static const int      spin_limit = 64;  // polls before ringing for a wakeup.
+
+// process-shared doorbell, rung to wake the other side of a ring
+struct shm_doorbell
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+    unsigned        rung;
+};
+
+// ----------------------------------------------------------------------------
+//  STRUCT : sc_shm_ring::shared
+//
+//  Layout of the shared memory object, followed by the slots. Each slot
+//  holds the length of its message followed by slot_size bytes. The
+//  indices written by the producer and by the consumer are kept on
+//  separate cache lines.
+// ----------------------------------------------------------------------------
+
+struct sc_shm_ring::shared
+{
+    enum { line = 64 };
+
+    // written once by the creator
+    unsigned        magic;           // set last, when the ring is ready.
+    unsigned        capacity;        // number of slots, a power of two.
+    unsigned        slot_size;       // bytes of payload per slot.
+    unsigned        slot_stride;     // bytes per slot.
+    int             creator;         // process id of the creator.
+    char            pad0[ line - 5 * sizeof(unsigned) ];
+
+    // written by the producer
+    sc_dt::uint64   head;            // messages written.
+    unsigned        reader_waiting;  // the consumer sleeps on readable.
+    unsigned        write_closed;
+    char            pad1[ line - sizeof(sc_dt::uint64) - 2 * sizeof(unsigned) ];
+
+    // written by the consumer
+    sc_dt::uint64   tail;            // messages read.
+    unsigned        writer_waiting;  // the producer sleeps on writable.
+    unsigned        read_closed;
+    char            pad2[ line - sizeof(sc_dt::uint64) - 2 * sizeof(unsigned) ];
+
+    shm_doorbell    readable;        // rung by the producer.
+    shm_doorbell    writable;        // rung by the consumer.
+};
+
+template< typename T >
+inline T
+shm_load( const T& v, int order = __ATOMIC_SEQ_CST )
+{
+    return __atomic_load_n( &v, order );
+}
+
+template< typename T >
+inline void
+shm_store( T& v, T value, int order = __ATOMIC_SEQ_CST )
+{
+    __atomic_store_n( &v, value, order );
+}
+
+template< typename T >
+inline T
+shm_exchange( T& v, T value )
+{
+    return __atomic_exchange_n( &v, value, __ATOMIC_SEQ_CST );
+}
+
+static void
+init_doorbell( shm_doorbell& bell )
+{
+    pthread_mutexattr_t mutex_attr;
+    pthread_mutexattr_init( &mutex_attr );
+    pthread_mutexattr_setpshared( &mutex_attr, PTHREAD_PROCESS_SHARED );
+    pthread_mutex_init( &bell.mutex, &mutex_attr );
+    pthread_mutexattr_destroy( &mutex_attr );
+
+    pthread_condattr_t cond_attr;
+    pthread_condattr_init( &cond_attr );
+    pthread_condattr_setpshared( &cond_attr, PTHREAD_PROCESS_SHARED );
+    pthread_cond_init( &bell.cond, &cond_attr );
+    pthread_condattr_destroy( &cond_attr );
+
+    bell.rung = 0;
+}
+
+static void
+ring_doorbell( shm_doorbell& bell )
+{
+    pthread_mutex_lock( &bell.mutex );
+    bell.rung = 1;
+    pthread_cond_signal( &bell.cond );
+    pthread_mutex_unlock( &bell.mutex );
+}
+
+static void
+wait_doorbell( shm_doorbell& bell )
+{
+    pthread_mutex_lock( &bell.mutex );
+    while ( !bell.rung )
+        pthread_cond_wait( &bell.cond, &bell.mutex );
+    bell.rung = 0;
+    pthread_mutex_unlock( &bell.mutex );
+}
+
+static void
+sleep_ms( unsigned ms )
+{
+    timespec ts;
+    ts.tv_sec = ms / 1000;
+    ts.tv_nsec = ( ms % 1000 ) * 1000000L;
+    nanosleep( &ts, 0 );
+}
+
+#endif // SC_SHM_RING_
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_shm_ring
+//
+//  Ring of messages in shared memory between two host processes.
+// ----------------------------------------------------------------------------
+
+sc_shm_ring::sc_shm_ring()
+  : m_shared_p( 0 ), m_bytes( 0 ), m_name(), m_owner( false ),
+    m_cached_head( 0 ), m_cached_tail( 0 ), m_wakeups( 0 )
+{}
+
+sc_shm_ring::~sc_shm_ring()
+{
+    close();
+}
+
+#if SC_SHM_RING_
+
+bool
+sc_shm_ring::create( const char* name_, unsigned capacity_,
+                     unsigned slot_size_ )
+{
+    close();
+    if ( !name_ || capacity_ == 0 || capacity_ > ( 1u << 30 ) )
+        return false;
+
+    unsigned capacity = 1;
+    while ( capacity < capacity_ )
+        capacity <<= 1;
+    unsigned stride = ( sizeof(unsigned) + slot_size_ + 7u ) & ~7u;
+    std::size_t bytes = sizeof(shared) + std::size_t( capacity ) * stride;
+
+    shm_unlink( name_ );
+    int fd = shm_open( name_, O_RDWR | O_CREAT | O_EXCL, 0600 );
+    if ( fd < 0 )
+        return false;
+    void* p = MAP_FAILED;
+    if ( ftruncate( fd, bytes ) == 0 )
+        p = mmap( 0, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+    ::close( fd );
+    if ( p == MAP_FAILED )
+    {
+        shm_unlink( name_ );
+        return false;
+    }
+
+    // the object is zero-filled, so the indices and flags are clear
+    shared* s = static_cast<shared*>( p );
+    s->capacity = capacity;
+    s->slot_size = slot_size_;
+    s->slot_stride = stride;
+    s->creator = static_cast<int>( getpid() );
+    init_doorbell( s->readable );
+    init_doorbell( s->writable );
+    shm_store( s->magic, ring_magic );
+
+    m_shared_p = s;
+    m_bytes = bytes;
+    m_name = name_;
+    m_owner = true;
+    m_cached_head = m_cached_tail = 0;
+    m_wakeups = 0;
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_shm_ring::open"
+// |
+// | This method maps a ring created by another process. A ring left
+// | behind by a creator that no longer runs is not opened.
+// +----------------------------------------------------------------------------
+bool
+sc_shm_ring::open( const char* name_, unsigned timeout_ms_ )
+{
+    close();
+    if ( !name_ )
+        return false;
+
+    for ( unsigned waited = 0; ; ++waited )
+    {
+        int fd = shm_open( name_, O_RDWR, 0 );
+        if ( fd >= 0 )
+        {
+            struct stat st;
+            void* p = MAP_FAILED;
+            std::size_t bytes = 0;
+            if ( fstat( fd, &st ) == 0 &&
+                 st.st_size >= static_cast<off_t>( sizeof(shared) ) )
+            {
+                bytes = static_cast<std::size_t>( st.st_size );
+                p = mmap( 0, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+            }
+            ::close( fd );
+            if ( p != MAP_FAILED )
+            {
+                shared* s = static_cast<shared*>( p );
+                if ( shm_load( s->magic ) == ring_magic &&
+                     bytes == sizeof(shared)
+                              + std::size_t( s->capacity ) * s->slot_stride &&
+                     ( kill( s->creator, 0 ) == 0 || errno == EPERM ) )
+                {
+                    m_shared_p = s;
+                    m_bytes = bytes;
+                    m_name = name_;
+                    m_owner = false;
+                    m_cached_head = shm_load( s->head );
+                    m_cached_tail = shm_load( s->tail );
+                    m_wakeups = 0;
+                    shm_unlink( name_ );
+                    return true;
+                }
+                munmap( p, bytes );
+            }
+        }
+        if ( waited >= timeout_ms_ )
+            return false;
+        sleep_ms( 1 );
+    }
+}
+
+void
+sc_shm_ring::close()
+{
+    if ( !m_shared_p )
+        return;
+    munmap( m_shared_p, m_bytes );
+    if ( m_owner )
+        shm_unlink( m_name.c_str() );
+    m_shared_p = 0;
+    m_bytes = 0;
+    m_owner = false;
+}
+
+unsigned
+sc_shm_ring::capacity() const
+{
+    return m_shared_p ? m_shared_p->capacity : 0;
+}
+
+unsigned
+sc_shm_ring::slot_size() const
+{
+    return m_shared_p ? m_shared_p->slot_size : 0;
+}
+
+char*
+sc_shm_ring::slot( sc_dt::uint64 index ) const
+{
+    return reinterpret_cast<char*>( m_shared_p + 1 )
+           + ( index & ( m_shared_p->capacity - 1 ) ) * m_shared_p->slot_stride;
+}
+
+bool
+sc_shm_ring::readable() const
+{
+    return shm_load( m_shared_p->head ) != shm_load( m_shared_p->tail )
+           || shm_load( m_shared_p->write_closed );
+}
+
+bool
+sc_shm_ring::writable() const
+{
+    return shm_load( m_shared_p->head ) - shm_load( m_shared_p->tail )
+             < m_shared_p->capacity
+           || shm_load( m_shared_p->read_closed );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_shm_ring::try_write"
+// |
+// | This method copies a message into the next free slot and publishes it.
+// | The consumer index is only read when the last one seen says the ring
+// | is full, and the doorbell is only rung if the consumer sleeps.
+// +----------------------------------------------------------------------------
+bool
+sc_shm_ring::try_write( const void* data_p, std::size_t size_ )
+{
+    shared* s = m_shared_p;
+    if ( !s || size_ > s->slot_size )
+        return false;
+
+    sc_dt::uint64 head = shm_load( s->head, __ATOMIC_RELAXED );
+    if ( head - m_cached_tail >= s->capacity )
+    {
+        m_cached_tail = shm_load( s->tail, __ATOMIC_ACQUIRE );
+        if ( head - m_cached_tail >= s->capacity )
+            return false;
+    }
+
+    char* slot_p = slot( head );
+    unsigned size = static_cast<unsigned>( size_ );
+    std::memcpy( slot_p, &size, sizeof(unsigned) );
+    if ( size_ )
+        std::memcpy( slot_p + sizeof(unsigned), data_p, size_ );
+    shm_store( s->head, head + 1 );
+
+    if ( shm_load( s->reader_waiting ) &&
+         shm_exchange( s->reader_waiting, 0u ) )
+    {
+        ring_doorbell( s->readable );
+        ++m_wakeups;
+    }
+    return true;
+}
+
+bool
+sc_shm_ring::write( const void* data_p, std::size_t size_ )
+{
+    for ( ;; )
+    {
+        if ( try_write( data_p, size_ ) )
+            return true;
+        if ( !m_shared_p || size_ > m_shared_p->slot_size || read_closed() )
+            return false;
+        wait_writable();
+    }
+}
+
+int
+sc_shm_ring::num_free() const
+{
+    if ( !m_shared_p )
+        return 0;
+    return static_cast<int>( m_shared_p->capacity
+                             - ( shm_load( m_shared_p->head )
+                                 - shm_load( m_shared_p->tail ) ) );
+}
+
+void
+sc_shm_ring::close_write()
+{
+    if ( !m_shared_p )
+        return;
+    shm_store( m_shared_p->write_closed, 1u );
+    ring_doorbell( m_shared_p->readable );
+}
+
+bool
+sc_shm_ring::read_closed() const
+{
+    return m_shared_p && shm_load( m_shared_p->read_closed );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_shm_ring::try_read"
+// |
+// | This method copies the message of the oldest slot and frees the slot.
+// | The producer index is only read when the last one seen says the ring
+// | is empty, and the doorbell is only rung if the producer sleeps.
+// +----------------------------------------------------------------------------
+bool
+sc_shm_ring::try_read( void* data_p, std::size_t& size_ )
+{
+    shared* s = m_shared_p;
+    if ( !s )
+        return false;
+
+    sc_dt::uint64 tail = shm_load( s->tail, __ATOMIC_RELAXED );
+    if ( tail == m_cached_head )
+    {
+        m_cached_head = shm_load( s->head, __ATOMIC_ACQUIRE );
+        if ( tail == m_cached_head )
+            return false;
+    }
+
+    const char* slot_p = slot( tail );
+    unsigned size;
+    std::memcpy( &size, slot_p, sizeof(unsigned) );
+    if ( size > size_ )
+    {
+        size_ = size;
+        return false;
+    }
+    if ( size )
+        std::memcpy( data_p, slot_p + sizeof(unsigned), size );
+    size_ = size;
+    shm_store( s->tail, tail + 1 );
+
+    if ( shm_load( s->writer_waiting ) &&
+         shm_exchange( s->writer_waiting, 0u ) )
+    {
+        ring_doorbell( s->writable );
+        ++m_wakeups;
+    }
+    return true;
+}
+
+bool
+sc_shm_ring::read( void* data_p, std::size_t& size_ )
+{
+    std::size_t buffer_size = size_;
+    for ( ;; )
+    {
+        size_ = buffer_size;
+        if ( try_read( data_p, size_ ) )
+            return true;
+        if ( !m_shared_p || size_ > buffer_size )
+            return false;
+        if ( write_closed() )
+        {
+            // messages written before the close may have arrived meanwhile
+            size_ = buffer_size;
+            return try_read( data_p, size_ );
+        }
+        wait_readable();
+    }
+}
+
+int
+sc_shm_ring::num_available() const
+{
+    if ( !m_shared_p )
+        return 0;
+    return static_cast<int>( shm_load( m_shared_p->head )
+                             - shm_load( m_shared_p->tail ) );
+}
+
+void
+sc_shm_ring::close_read()
+{
+    if ( !m_shared_p )
+        return;
+    shm_store( m_shared_p->read_closed, 1u );
+    ring_doorbell( m_shared_p->writable );
+}
+
+bool
+sc_shm_ring::write_closed() const
+{
+    return m_shared_p && shm_load( m_shared_p->write_closed );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_shm_ring::wait_readable"
+// |
+// | This method polls the ring for a while, then announces that the
+// | consumer sleeps and waits for the doorbell. The ring is checked again
+// | after the announcement, since the producer only rings the doorbell
+// | if it sees the announcement after publishing a message.
+// +----------------------------------------------------------------------------
+bool
+sc_shm_ring::wait_readable()
+{
+    shared* s = m_shared_p;
+    if ( !s )
+        return false;
+    for ( int spin = 0; spin < spin_limit; ++spin )
+    {
+        if ( readable() )
+            return true;
+        sched_yield();
+    }
+    shm_store( s->reader_waiting, 1u );
+    if ( !readable() )
+        wait_doorbell( s->readable );
+    shm_store( s->reader_waiting, 0u );
+    return readable();
+}
+
+bool
+sc_shm_ring::wait_writable()
+{
+    shared* s = m_shared_p;
+    if ( !s )
+        return false;
+    for ( int spin = 0; spin < spin_limit; ++spin )
+    {
+        if ( writable() )
+            return true;
+        sched_yield();
+    }
+    shm_store( s->writer_waiting, 1u );
+    if ( !writable() )
+        wait_doorbell( s->writable );
+    shm_store( s->writer_waiting, 0u );
+    return writable();
+}
+
+void
+sc_shm_ring::wake_reader()
+{
+    if ( m_shared_p )
+        ring_doorbell( m_shared_p->readable );
+}
+
+void
+sc_shm_ring::wake_writer()
+{
+    if ( m_shared_p )
+        ring_doorbell( m_shared_p->writable );
+}
+
+#else // !SC_SHM_RING_
+
+bool sc_shm_ring::create( const char*, unsigned, unsigned ) { return false; }
+bool sc_shm_ring::open( const char*, unsigned ) { return false; }
+void sc_shm_ring::close() {}
+unsigned sc_shm_ring::capacity() const { return 0; }
+unsigned sc_shm_ring::slot_size() const { return 0; }
+char* sc_shm_ring::slot( sc_dt::uint64 ) const { return 0; }
+bool sc_shm_ring::readable() const { return false; }
+bool sc_shm_ring::writable() const { return false; }
+bool sc_shm_ring::try_write( const void*, std::size_t ) { return false; }
+bool sc_shm_ring::write( const void*, std::size_t ) { return false; }
+int sc_shm_ring::num_free() const { return 0; }
+void sc_shm_ring::close_write() {}
+bool sc_shm_ring::read_closed() const { return false; }
+bool sc_shm_ring::try_read( void*, std::size_t& ) { return false; }
+bool sc_shm_ring::read( void*, std::size_t& ) { return false; }
+int sc_shm_ring::num_available() const { return 0; }
+void sc_shm_ring::close_read() {}
+bool sc_shm_ring::write_closed() const { return false; }
+bool sc_shm_ring::wait_readable() { return false; }
+bool sc_shm_ring::wait_writable() { return false; }
+void sc_shm_ring::wake_reader() {}
+void sc_shm_ring::wake_writer() {}
+
+#endif // SC_SHM_RING_
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_shm_channel_base
+//
+//  Type independent part of the shared memory channels.
+// ----------------------------------------------------------------------------
+
+#if SC_SHM_CHANNEL_
+
+// host thread waiting for the ring of a channel
+struct sc_shm_channel_base::watcher
+{
+    watcher() : armed( 0 ), stop( 0 ), thread() {}
+
+    sc_host_semaphore armed;   // posted by arm().
+    int               stop;    // set by the destructor of the channel.
+    pthread_t         thread;
+};
+
+#else
+
+struct sc_shm_channel_base::watcher {};
+
+#endif // SC_SHM_CHANNEL_
+
+sc_shm_channel_base::sc_shm_channel_base( const char* name_,
+                                          const char* shm_name_,
+                                          unsigned capacity_,
+                                          unsigned slot_size_,
+                                          bool inbound_ )
+  : sc_prim_channel( name_ ), m_ring(), m_inbound( inbound_ ),
+    m_ready_event( sc_event::kernel_event,
+                   inbound_ ? "write_event" : "read_event" ),
+    m_armed( false ), m_suspending( false ), m_watcher_p( 0 )
+{
+#if SC_SHM_CHANNEL_
+    if ( !m_ring.create( shm_name_, capacity_, slot_size_ ) )
+    {
+        std::string msg = std::string( "cannot create ring '" )
+                          + ( shm_name_ ? shm_name_ : "" ) + "' of "
+                          + name();
+        SC_REPORT_ERROR( SC_ID_SHARED_MEMORY_, msg.c_str() );
+    }
+#else
+    SC_REPORT_ERROR( SC_ID_SHARED_MEMORY_, "not supported on this host" );
+#endif
+}
+
+sc_shm_channel_base::~sc_shm_channel_base()
+{
+#if SC_SHM_CHANNEL_
+    if ( m_watcher_p )
+    {
+        shm_store( m_watcher_p->stop, 1 );
+        m_watcher_p->armed.post();
+        if ( m_inbound )
+            m_ring.wake_reader();
+        else
+            m_ring.wake_writer();
+        pthread_join( m_watcher_p->thread, 0 );
+    }
+#endif
+    delete m_watcher_p;
+    close();
+}
+
+void
+sc_shm_channel_base::close()
+{
+    if ( m_inbound )
+        m_ring.close_read();
+    else
+        m_ring.close_write();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_shm_channel_base::arm"
+// |
+// | This method has the watcher wait until the ring can be read or written
+// | and then request an update, which notifies the ready event. While the
+// | watcher waits for the other process, the simulator suspends instead of
+// | stopping at starvation. Nothing is awaited once the other process
+// | closed its side, except for the values it left in an inbound ring.
+// +----------------------------------------------------------------------------
+void
+sc_shm_channel_base::arm() const
+{
+#if SC_SHM_CHANNEL_
+    if ( m_armed || !m_ring.is_open() )
+        return;
+    bool closed = m_inbound ? m_ring.write_closed() : m_ring.read_closed();
+    if ( closed && !( m_inbound && m_ring.num_available() ) )
+        return;
+
+    sc_shm_channel_base* self = const_cast<sc_shm_channel_base*>( this );
+    if ( !m_watcher_p )
+    {
+        m_watcher_p = new watcher;
+        if ( pthread_create( &m_watcher_p->thread, 0, &watch_main, self ) )
+        {
+            delete m_watcher_p;
+            m_watcher_p = 0;
+            SC_REPORT_ERROR( SC_ID_SHARED_MEMORY_, "cannot start watcher" );
+            return;
+        }
+    }
+    m_armed = true;
+    if ( !closed && !m_suspending )
+        m_suspending = self->async_attach_suspending();
+    m_watcher_p->armed.post();
+#endif
+}
+
+void*
+sc_shm_channel_base::watch_main( void* channel_p )
+{
+    static_cast<sc_shm_channel_base*>( channel_p )->watch();
+    return 0;
+}
+
+void
+sc_shm_channel_base::watch()
+{
+#if SC_SHM_CHANNEL_
+    for ( ;; )
+    {
+        m_watcher_p->armed.wait();
+        for ( ;; )
+        {
+            if ( shm_load( m_watcher_p->stop ) )
+                return;
+            if ( m_inbound ? m_ring.wait_readable() : m_ring.wait_writable() )
+                break;
+        }
+        async_request_update();
+    }
+#endif
+}
+
+void
+sc_shm_channel_base::update()
+{
+    m_armed = false;
+    if ( m_suspending )
+    {
+        async_detach_suspending();
+        m_suspending = false;
+    }
+    m_ready_event.notify( SC_ZERO_TIME );
+}
+
+void
+sc_shm_channel_base::end_of_simulation()
+{
+    close();
+}
+
+void
+sc_shm_channel_base::report_size() const
+{
+    SC_REPORT_ERROR( SC_ID_SHARED_MEMORY_,
+                     "value of unexpected size received" );
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,343 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_shm_channel.h -- Channels to other host processes over shared memory.
+
+  An sc_shm_ring is a single-producer single-consumer ring of fixed size
+  slots in a POSIX shared memory object. Writing and reading a message
+  copies it into or out of a slot and publishes the new ring index; no
+  system call is made unless the other side sleeps because the ring was
+  empty or full, in which case it is woken by a process-shared doorbell.
+  The ring does not depend on a simulation context, so the process on
+  the other side can use it without running a simulation.
+
+  An sc_shm_inbox<T> receives the values another process writes to its
+  ring and implements sc_fifo_in_if<T>, an sc_shm_outbox<T> sends the
+  values written to it and implements sc_fifo_out_if<T>. A host thread of
+  the channel waits for the ring to become readable or writable and wakes
+  the simulator with async_request_update(). While a process of the
+  simulation waits for a channel, the simulator suspends instead of
+  stopping at starvation.
+
+  The values are transferred as their bytes, so T must be trivially
+  copyable. Shared memory channels are only available on POSIX hosts.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_SHM_CHANNEL_H_INCLUDED_
+#define SC_SHM_CHANNEL_H_INCLUDED_
+
+#include "sysc/communication/sc_communication_ids.h"
+#include "sysc/communication/sc_fifo_ifs.h"
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+#include "sysc/utils/sc_report.h"
+
+#include <cstddef>
+#include <string>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::string
+#endif
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_shm_ring
+//
+//  Ring of messages in shared memory between two host processes.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_shm_ring
+{
+public:
+
+    sc_shm_ring();
+    ~sc_shm_ring();
+
+    // create the shared memory object name_ (e.g. "/my_ring") with
+    // capacity_ slots of slot_size_ bytes, replacing an existing one
+    bool create( const char* name_, unsigned capacity_, unsigned slot_size_ );
+
+    // map the shared memory object created by another process, waiting
+    // up to timeout_ms_ milliseconds for it to be created; the name is
+    // removed once the ring is open, so a ring has exactly two users
+    bool open( const char* name_, unsigned timeout_ms_ = 0 );
+
+    // unmap the ring (does not close either side)
+    void close();
+
+    bool is_open() const
+        { return m_shared_p != 0; }
+    const char* name() const
+        { return m_name.c_str(); }
+    unsigned capacity() const;
+    unsigned slot_size() const;
+
+    // producer side: write a message of up to slot_size() bytes, false if
+    // the ring is full (try_write) or the reader closed its side (write,
+    // which blocks while the ring is full)
+    bool try_write( const void* data_p, std::size_t size_ );
+    bool write( const void* data_p, std::size_t size_ );
+    int num_free() const;
+    void close_write();
+    bool read_closed() const;
+
+    // consumer side: read a message into a buffer of size_ bytes and set
+    // size_ to its length, false if the ring is empty (try_read) or the
+    // writer closed its side and all messages were read; read blocks
+    // while the ring is empty
+    bool try_read( void* data_p, std::size_t& size_ );
+    bool read( void* data_p, std::size_t& size_ );
+    int num_available() const;
+    void close_read();
+    bool write_closed() const;
+
+    // sleep until a message can be read (written) or the writer (reader)
+    // closed its side, true if so; false if woken by wake_reader
+    // (wake_writer) of another thread of this process
+    bool wait_readable();
+    bool wait_writable();
+    void wake_reader();
+    void wake_writer();
+
+    // number of times this process rang the doorbell of the other side
+    sc_dt::uint64 wakeups() const
+        { return m_wakeups; }
+
+private:
+
+    struct shared;
+
+    bool readable() const;
+    bool writable() const;
+    char* slot( sc_dt::uint64 index ) const;
+
+private:
+    shared*       m_shared_p;     // mapped ring, null if not open.
+    std::size_t   m_bytes;        // size of the mapping.
+    std::string   m_name;
+    bool          m_owner;        // ring was created by this process.
+    sc_dt::uint64 m_cached_head;  // last seen head, by the consumer.
+    sc_dt::uint64 m_cached_tail;  // last seen tail, by the producer.
+    sc_dt::uint64 m_wakeups;
+
+private:
+    // disabled
+    sc_shm_ring( const sc_shm_ring& );
+    sc_shm_ring& operator = ( const sc_shm_ring& );
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_shm_channel_base
+//
+//  Type independent part of the shared memory channels.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_shm_channel_base : public sc_prim_channel
+{
+public:
+
+    // the ring shared with the other process
+    const sc_shm_ring& ring() const
+        { return m_ring; }
+
+    virtual const char* kind() const
+        { return "sc_shm_channel"; }
+
+    // close this side of the ring, the other process sees the end of the
+    // stream (inbox) or can no longer write (outbox)
+    void close();
+
+protected:
+
+    // inbound_ is true if the simulation reads from the ring
+    sc_shm_channel_base( const char* name_, const char* shm_name_,
+                         unsigned capacity_, unsigned slot_size_,
+                         bool inbound_ );
+    virtual ~sc_shm_channel_base();
+
+    sc_shm_ring& mutable_ring()
+        { return m_ring; }
+
+    // notify the ready event once the ring can be read (inbound) or
+    // written (outbound), as soon as the other process allows it
+    void arm() const;
+
+    const sc_event& ready_event() const
+        { return m_ready_event; }
+
+    virtual void update();
+    virtual void end_of_simulation();
+
+    // report a value of the wrong size
+    void report_size() const;
+
+private:
+
+    struct watcher;
+
+    void watch();
+    static void* watch_main( void* );
+
+private:
+    sc_shm_ring       m_ring;
+    bool              m_inbound;
+    sc_event          m_ready_event;
+    mutable bool      m_armed;       // the watcher looks at the ring.
+    mutable bool      m_suspending;  // attached as async suspending.
+    mutable watcher*  m_watcher_p;   // started by the first arm().
+
+private:
+    // disabled
+    sc_shm_channel_base( const sc_shm_channel_base& );
+    sc_shm_channel_base& operator = ( const sc_shm_channel_base& );
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_shm_inbox<T>
+//
+//  Channel receiving the values another process writes to a ring.
+// ----------------------------------------------------------------------------
+
+template <class T>
+class sc_shm_inbox
+: public sc_shm_channel_base,
+  public sc_fifo_in_if<T>
+{
+public:
+
+    // constructor, creates the ring shm_name_ of capacity_ values
+
+    sc_shm_inbox( const char* name_, const char* shm_name_,
+                  unsigned capacity_ = 1024 )
+      : sc_shm_channel_base( name_, shm_name_, capacity_, sizeof( T ), true )
+      {}
+
+    // blocking read
+
+    virtual void read( T& value_ )
+        {
+            while ( !nb_read( value_ ) )
+                sc_core::wait( data_written_event() );
+        }
+
+    virtual T read()
+        { T tmp; read( tmp ); return tmp; }
+
+    // non-blocking read
+
+    virtual bool nb_read( T& value_ );
+
+    virtual int num_available() const
+        { return ring().num_available(); }
+
+    // notified when values can be read after the last read
+
+    virtual const sc_event& data_written_event() const
+        { arm(); return ready_event(); }
+
+    virtual const char* kind() const
+        { return "sc_shm_inbox"; }
+};
+
+template <class T>
+inline bool
+sc_shm_inbox<T>::nb_read( T& value_ )
+{
+    std::size_t size = sizeof( T );
+    bool read_one = mutable_ring().try_read( &value_, size );
+    arm();
+    if ( read_one && size != sizeof( T ) )
+        report_size();
+    return read_one;
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_shm_outbox<T>
+//
+//  Channel sending the values written to it to another process.
+// ----------------------------------------------------------------------------
+
+template <class T>
+class sc_shm_outbox
+: public sc_shm_channel_base,
+  public sc_fifo_out_if<T>
+{
+public:
+
+    // constructor, creates the ring shm_name_ of capacity_ values
+
+    sc_shm_outbox( const char* name_, const char* shm_name_,
+                   unsigned capacity_ = 1024 )
+      : sc_shm_channel_base( name_, shm_name_, capacity_, sizeof( T ), false )
+      {}
+
+    // blocking write, waits while the ring is full
+
+    virtual void write( const T& value_ )
+        {
+            while ( !nb_write( value_ ) )
+                sc_core::wait( data_read_event() );
+        }
+
+    // non-blocking write
+
+    virtual bool nb_write( const T& value_ )
+        {
+            if ( mutable_ring().try_write( &value_, sizeof( T ) ) )
+                return true;
+            arm();
+            return false;
+        }
+
+    virtual int num_free() const
+        { return ring().num_free(); }
+
+    // notified when values can be written after the ring was full
+
+    virtual const sc_event& data_read_event() const
+        { arm(); return ready_event(); }
+
+    virtual const char* kind() const
+        { return "sc_shm_outbox"; }
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_SHM_CHANNEL_H_INCLUDED_
+// Taf!
@@ -144,6 +144,23 @@ sc_signal_channel::lazy_kernel_event( sc_event** ev, const char* name ) const
     return *ev;
 }
 
+// create the edge events record of a bool or sc_logic signal, if needed
+sc_signal_channel::edge_events*
+sc_signal_channel::lazy_edge_events( edge_events** edges ) const
+{
+    if ( !*edges ) {
+        *edges = new edge_events;
+    }
+    return *edges;
+}
+
+sc_signal_channel::edge_events::~edge_events()
+{
+    delete posedge_event_p;
+    delete negedge_event_p;
+    delete reset_p;
+}
+
 
 // get the value changed event
 const sc_event&
@@ -180,10 +197,15 @@ sc_signal<bool,POL>::do_update()
     // order of execution below is important, the notify_processes() call
     // must come after the update of m_cur_val for things to work properly!
     base_type::do_update();
-    if ( m_reset_p ) m_reset_p->notify_processes();
 
-    sc_event* event_p = this->m_cur_val ? m_posedge_event_p : m_negedge_event_p;
-    sc_signal_channel::notify_next_delta( event_p );
+    // nothing to notify as long as no edge event or reset was requested
+    if ( const edge_events* edges_p = m_edge_events_p ) {
+        if ( edges_p->reset_p ) edges_p->reset_p->notify_processes();
+
+        sc_event* event_p = this->m_cur_val ? edges_p->posedge_event_p
+                                            : edges_p->negedge_event_p;
+        sc_signal_channel::notify_next_delta( event_p );
+    }
 }
 
 // edge event methods
@@ -192,14 +214,18 @@ template< sc_writer_policy POL >
 const sc_event&
 sc_signal<bool,POL>::posedge_event() const
 {
-    return *this->lazy_kernel_event(&m_posedge_event_p,"posedge_event");
+    return *this->lazy_kernel_event(
+        &this->lazy_edge_events(&m_edge_events_p)->posedge_event_p,
+        "posedge_event");
 }
 
 template< sc_writer_policy POL >
 const sc_event&
 sc_signal<bool,POL>::negedge_event() const
 {
-    return *this->lazy_kernel_event(&m_negedge_event_p,"negedge_event");
+    return *this->lazy_kernel_event(
+        &this->lazy_edge_events(&m_edge_events_p)->negedge_event_p,
+        "negedge_event");
 }
 
 
@@ -209,10 +235,9 @@ template< sc_writer_policy POL >
 sc_reset*
 sc_signal<bool,POL>::is_reset() const
 {
-    sc_reset* result_p;
-    if ( !m_reset_p ) m_reset_p = new sc_reset( this );
-    result_p = m_reset_p;
-    return result_p;
+    edge_events* edges_p = this->lazy_edge_events( &m_edge_events_p );
+    if ( !edges_p->reset_p ) edges_p->reset_p = new sc_reset( this );
+    return edges_p->reset_p;
 }
 
 // destructor
@@ -220,9 +245,7 @@ sc_signal<bool,POL>::is_reset() const
 template< sc_writer_policy POL >
 sc_signal<bool,POL>::~sc_signal()
 {
-    delete m_negedge_event_p;
-    delete m_posedge_event_p;
-    delete m_reset_p;
+    delete m_edge_events_p;
 }
 
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
@@ -243,11 +266,17 @@ sc_signal<sc_logic,POL>::do_update()
 {
     base_type::do_update();
 
+    // nothing to notify as long as no edge event was requested
+    const edge_events* edges_p = m_edge_events_p;
+    if( !edges_p ) {
+        return;
+    }
+
     if( this->m_cur_val == sc_dt::SC_LOGIC_1 ) {
-        sc_signal_channel::notify_next_delta( m_posedge_event_p );
+        sc_signal_channel::notify_next_delta( edges_p->posedge_event_p );
     }
     else if( this->m_cur_val == sc_dt::SC_LOGIC_0 ) {
-        sc_signal_channel::notify_next_delta( m_negedge_event_p );
+        sc_signal_channel::notify_next_delta( edges_p->negedge_event_p );
     }
 }
 
@@ -257,14 +286,18 @@ template< sc_writer_policy POL >
 const sc_event&
 sc_signal<sc_logic,POL>::posedge_event() const
 {
-    return *this->lazy_kernel_event(&m_posedge_event_p,"posedge_event");
+    return *this->lazy_kernel_event(
+        &this->lazy_edge_events(&m_edge_events_p)->posedge_event_p,
+        "posedge_event");
 }
 
 template< sc_writer_policy POL >
 const sc_event&
 sc_signal<sc_logic,POL>::negedge_event() const
 {
-    return *this->lazy_kernel_event(&m_negedge_event_p,"negedge_event");
+    return *this->lazy_kernel_event(
+        &this->lazy_edge_events(&m_edge_events_p)->negedge_event_p,
+        "negedge_event");
 }
 
 // destructor
@@ -272,8 +305,7 @@ sc_signal<sc_logic,POL>::negedge_event() const
 template< sc_writer_policy POL >
 sc_signal<sc_logic,POL>::~sc_signal()
 {
-    delete m_negedge_event_p;
-    delete m_posedge_event_p;
+    delete m_edge_events_p;
 }
 
 
@@ -74,6 +74,8 @@ sc_writer_policy_check_write::update()
 }
 
 
+class SC_API sc_reset;
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_signal_channel
 //
@@ -83,6 +85,8 @@ sc_writer_policy_check_write::update()
 class SC_API sc_signal_channel
   : public sc_prim_channel
 {
+    friend class sc_method_levelizer;
+
 protected:
 
     sc_signal_channel( const char* name_ )
@@ -121,6 +125,28 @@ protected:
     void deprecated_trace()         const;
 
     sc_event* lazy_kernel_event( sc_event**, const char* ) const;
+
+    // the edge events and the reset mechanism of the bool and sc_logic
+    // signals, allocated together when the first of them is requested
+    struct edge_events
+    {
+        edge_events()
+          : posedge_event_p( 0 ), negedge_event_p( 0 ), reset_p( 0 )
+        {}
+        ~edge_events();
+
+        sc_event* posedge_event_p;  // positive edge event if present.
+        sc_event* negedge_event_p;  // negative edge event if present.
+        sc_reset* reset_p;          // reset mechanism if present.
+
+    private:
+        // disabled
+        edge_events( const edge_events& ) /* = delete */;
+        edge_events& operator=( const edge_events& ) /* = delete */;
+    };
+
+    edge_events* lazy_edge_events( edge_events** ) const;
+
     void notify_next_delta( sc_event* ev ) const
         { if( ev ) ev->notify_next_delta(); }
 
@@ -144,6 +170,43 @@ operator << ( ::std::ostream& os, const sc_signal_channel& a )
 }
 
 
+// ----------------------------------------------------------------------------
+//  CLASS TEMPLATE : sc_signal_batch_traits<T>
+//
+//  Whether the sc_signal<T,POL> channels are updated in batches (see
+//  sc_signal_update_batch). This is the case for the fundamental types and
+//  sc_logic, i.e. for values that are cheap to compare and copy. It can be
+//  specialized for other trivially copyable types.
+// ----------------------------------------------------------------------------
+
+template< class T >
+struct sc_signal_batch_traits
+{
+    enum { batched = false };
+};
+
+#define SC_SIGNAL_BATCHED_( T ) \
+    template<> struct sc_signal_batch_traits< T > { enum { batched = true }; }
+
+SC_SIGNAL_BATCHED_( bool );
+SC_SIGNAL_BATCHED_( char );
+SC_SIGNAL_BATCHED_( signed char );
+SC_SIGNAL_BATCHED_( unsigned char );
+SC_SIGNAL_BATCHED_( short );
+SC_SIGNAL_BATCHED_( unsigned short );
+SC_SIGNAL_BATCHED_( int );
+SC_SIGNAL_BATCHED_( unsigned int );
+SC_SIGNAL_BATCHED_( long );
+SC_SIGNAL_BATCHED_( unsigned long );
+SC_SIGNAL_BATCHED_( float );
+SC_SIGNAL_BATCHED_( double );
+SC_SIGNAL_BATCHED_( sc_dt::sc_logic );
+
+#undef SC_SIGNAL_BATCHED_
+
+template< class T, sc_writer_policy POL > class sc_signal_update_batch;
+
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_signal_t<T, POL> (implementation-defined)
 //
@@ -157,6 +220,8 @@ class sc_signal_t
   , public    sc_signal_channel
   , protected sc_writer_policy_check<POL>
 {
+    friend class sc_signal_update_batch<T,POL>;
+
 protected:
     typedef sc_signal_inout_if<T>       if_type;
     typedef sc_signal_channel           base_type;
@@ -258,6 +323,10 @@ protected:
     virtual void update();
             void do_update();
 
+    // the current value
+    virtual void save_state( ::std::ostream& ) const;
+    virtual void restore_state( ::std::istream& );
+
 protected:
     T m_cur_val;         // current value of object.
     T m_new_val;         // next value of object.
@@ -295,7 +364,11 @@ sc_signal_t<T,POL>::write( const T& value_ )
 
     m_new_val = value_;
     if( value_changed || policy_type::needs_update() ) {
-        request_update();
+        if( sc_signal_batch_traits<T>::batched ) {
+            request_batched_update< sc_signal_update_batch<T,POL> >();
+        } else {
+            request_update();
+        }
     }
 }
 
@@ -336,6 +409,25 @@ sc_signal_t<T,POL>::do_update()
     m_cur_val = m_new_val;
 }
 
+
+template< class T, sc_writer_policy POL >
+void
+sc_signal_t<T,POL>::save_state( ::std::ostream& os ) const
+{
+    sc_save_value( os, m_cur_val );
+}
+
+template< class T, sc_writer_policy POL >
+void
+sc_signal_t<T,POL>::restore_state( ::std::istream& is )
+{
+    if( sc_restore_value( is, m_new_val ) ) {
+        m_cur_val = m_new_val;
+    } else {
+        m_new_val = m_cur_val;
+    }
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_signal<T, POL>
 //
@@ -392,8 +484,6 @@ private:
 //  Specialization of sc_signal<T> for type bool.
 // ----------------------------------------------------------------------------
 
-class SC_API sc_reset;
-
 SC_API_TEMPLATE_DECL_ sc_signal_t<bool,SC_ONE_WRITER>;
 SC_API_TEMPLATE_DECL_ sc_signal_t<bool,SC_MANY_WRITERS>;
 SC_API_TEMPLATE_DECL_ sc_signal_t<bool,SC_UNCHECKED_WRITERS>;
@@ -402,11 +492,15 @@ template< sc_writer_policy POL >
 class SC_API sc_signal<bool,POL>
   : public sc_signal_t<bool,POL>
 {
+    friend class sc_method_levelizer;
+    friend class sc_signal_update_batch<bool,POL>;
+
 protected:
     typedef sc_signal_t<bool,POL>       base_type;
     typedef sc_signal<bool,POL>         this_type;
     typedef bool                        value_type;
     typedef sc_writer_policy_check<POL> policy_type;
+    typedef sc_signal_channel::edge_events edge_events;
 
 public:
 
@@ -414,18 +508,18 @@ public:
 
     sc_signal()
       : base_type( sc_gen_unique_name( "signal" ), value_type() )
-      , m_negedge_event_p( 0 ) , m_posedge_event_p( 0 ) , m_reset_p( 0 )
+      , m_edge_events_p( 0 )
     {}
 
     explicit
     sc_signal( const char* name_ )
       : base_type( name_, value_type() )
-      , m_negedge_event_p( 0 ) , m_posedge_event_p( 0 ) , m_reset_p( 0 )
+      , m_edge_events_p( 0 )
     {}
 
     sc_signal( const char* name_, const value_type& initial_value_ )
       : base_type( name_, initial_value_ )
-      , m_negedge_event_p( 0 ) , m_posedge_event_p( 0 ) , m_reset_p( 0 )
+      , m_edge_events_p( 0 )
     {}
 
     virtual ~sc_signal();
@@ -463,9 +557,7 @@ protected:
     virtual bool is_clock() const { return false; }
 
 protected:
-    mutable sc_event* m_negedge_event_p; // negative edge event if present.
-    mutable sc_event* m_posedge_event_p; // positive edge event if present.
-    mutable sc_reset* m_reset_p;         // reset mechanism if present.
+    mutable edge_events* m_edge_events_p; // edge events and reset if present.
 
 private:
     // reset creation
@@ -490,28 +582,32 @@ template< sc_writer_policy POL >
 class SC_API sc_signal<sc_dt::sc_logic,POL>
   : public sc_signal_t<sc_dt::sc_logic,POL>
 {
+    friend class sc_method_levelizer;
+    friend class sc_signal_update_batch<sc_dt::sc_logic,POL>;
+
 protected:
     typedef sc_signal_t<sc_dt::sc_logic,POL>    base_type;
     typedef sc_signal<sc_dt::sc_logic,POL>      this_type;
     typedef sc_dt::sc_logic                     value_type;
     typedef sc_writer_policy_check<POL> policy_type;
+    typedef sc_signal_channel::edge_events     edge_events;
 
 public:
 
     sc_signal()
       : base_type( sc_gen_unique_name( "signal" ), value_type() )
-      , m_negedge_event_p( 0 ) , m_posedge_event_p( 0 )
+      , m_edge_events_p( 0 )
     {}
 
     explicit
     sc_signal( const char* name_ )
       : base_type( name_, value_type() )
-      , m_negedge_event_p( 0 ) , m_posedge_event_p( 0 )
+      , m_edge_events_p( 0 )
     {}
 
     sc_signal( const char* name_, const value_type& initial_value_ )
       : base_type( name_, initial_value_ )
-      , m_negedge_event_p( 0 ) , m_posedge_event_p( 0 )
+      , m_edge_events_p( 0 )
     {}
 
     virtual ~sc_signal();
@@ -548,14 +644,53 @@ protected:
             void do_update();
 
 protected:
-    mutable sc_event* m_negedge_event_p; // negative edge event if present.
-    mutable sc_event* m_posedge_event_p; // positive edge event if present.
+    mutable edge_events* m_edge_events_p; // edge events if present.
 
 private:
     // disabled
     sc_signal( const this_type& ) /* = delete */;
 };
 
+
+// ----------------------------------------------------------------------------
+//  CLASS TEMPLATE : sc_signal_update_batch<T, POL> (implementation-defined)
+//
+//  Update batch of the sc_signal<T,POL> channels, for the types T with
+//  sc_signal_batch_traits<T>::batched. The signals written in an evaluation
+//  phase are kept in a vector, and their updates are called directly in
+//  one loop instead of through the update list. Classes derived from
+//  sc_signal<T,POL> are never batched, as they may override update().
+// ----------------------------------------------------------------------------
+
+template< class T, sc_writer_policy POL >
+class sc_signal_update_batch
+  : public sc_update_batch
+{
+public:
+    typedef sc_signal<T,POL> channel_type;
+
+protected:
+
+    virtual void update()
+    {
+        enum { prefetch_distance = 4 };
+
+        sc_prim_channel* const* channels = &m_channels[0];
+        std::size_t size = m_channels.size();
+        for( std::size_t i = 0; i < size; ++i ) {
+            if( i + prefetch_distance < size ) {
+                channel_type* next_p = static_cast<channel_type*>(
+                                         channels[i + prefetch_distance] );
+                SC_PREFETCH_( &next_p->m_change_event_p );
+                SC_PREFETCH_( &next_p->m_new_val );
+            }
+            channel_type& signal_ = static_cast<channel_type&>( *channels[i] );
+            updated( signal_ );
+            signal_.channel_type::update();
+        }
+    }
+};
+
 } // namespace sc_core
 
 /*****************************************************************************
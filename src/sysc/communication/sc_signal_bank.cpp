@@ -0,0 +1,491 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_signal_bank.cpp -- A bank of bool or sc_logic signals packed in words.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/communication/sc_signal_bank.h"
+#include "sysc/communication/sc_communication_ids.h"
+#include "sysc/kernel/sc_reset.h"
+#include "sysc/kernel/sc_simcontext.h"
+
+#include <sstream>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_signal_bank_base
+//
+//  The type-agnostic base class of sc_signal_bank<T>.
+// ----------------------------------------------------------------------------
+
+// constructor
+
+sc_signal_bank_base::sc_signal_bank_base( const char* name_, int size_,
+                                          int planes_ )
+  : sc_prim_channel( name_ )
+  , m_size( size_ )
+  , m_words( 0 )
+  , m_planes( planes_ )
+  , m_cur_val()
+  , m_new_val()
+  , m_changed()
+  , m_dirty_lo( 0 )
+  , m_dirty_hi( -1 )
+  , m_changed_lo( 0 )
+  , m_changed_hi( -1 )
+  , m_change_event_p( 0 )
+  , m_bit_events()
+  , m_slice_events()
+  , m_change_stamp( ~sc_dt::UINT64_ONE )
+{
+    if( m_size < 1 ) {
+        check_range( m_size - 1, 0, "sc_signal_bank" );
+        m_size = 1;
+    }
+    m_words = ( m_size - 1 ) / word_bits + 1;
+    m_cur_val.resize( m_planes * m_words, 0 );
+    m_new_val.resize( m_planes * m_words, 0 );
+    m_changed.resize( m_words, 0 );
+    m_dirty_lo = m_words;
+}
+
+
+// destructor
+
+sc_signal_bank_base::~sc_signal_bank_base()
+{
+    delete m_change_event_p;
+    for( std::size_t i = 0; i < m_bit_events.size(); ++i ) {
+        bit_events* events_p = m_bit_events[i];
+        if( events_p ) {
+            delete events_p->change_event_p;
+            delete events_p->posedge_event_p;
+            delete events_p->negedge_event_p;
+            delete events_p->reset_p;
+            delete events_p;
+        }
+    }
+    for( std::size_t i = 0; i < m_slice_events.size(); ++i ) {
+        delete m_slice_events[i].event_p;
+    }
+}
+
+
+// check the bits left_ down to right_
+
+bool
+sc_signal_bank_base::check_range( int left_, int right_,
+                                  const char* method_ ) const
+{
+    if( right_ >= 0 && left_ >= right_ && left_ < m_size ) {
+        return true;
+    }
+    std::stringstream msg;
+    msg << name() << "." << method_ << "( " << left_;
+    if( left_ != right_ ) {
+        msg << ", " << right_;
+    }
+    msg << " ), size = " << m_size;
+    SC_REPORT_ERROR( SC_ID_INVALID_SIGNAL_BANK_ACCESS_, msg.str().c_str() );
+    return false;
+}
+
+bool
+sc_signal_bank_base::check_width( int left_, int right_, int width_,
+                                  const char* method_ ) const
+{
+    if( width_ == left_ - right_ + 1 ) {
+        return true;
+    }
+    std::stringstream msg;
+    msg << name() << "." << method_ << "( " << left_ << ", " << right_
+        << " ), vector width = " << width_;
+    SC_REPORT_ERROR( SC_ID_INVALID_SIGNAL_BANK_ACCESS_, msg.str().c_str() );
+    return false;
+}
+
+
+// write a bit of the new value
+
+void
+sc_signal_bank_base::set_bit( int p_, int i_, bool v_ )
+{
+    int wi = i_ / word_bits;
+    word_type mask = word_type( 1 ) << ( i_ % word_bits );
+    word_type& word = m_new_val[p_ * m_words + wi];
+    word = v_ ? ( word | mask ) : ( word & ~mask );
+
+    if( wi < m_dirty_lo ) m_dirty_lo = wi;
+    if( wi > m_dirty_hi ) m_dirty_hi = wi;
+    request_update();
+}
+
+
+// get up to a word of bits of the current value
+
+sc_signal_bank_base::word_type
+sc_signal_bank_base::get_bits( int p_, int lo_, int n_ ) const
+{
+    const word_type* plane = &m_cur_val[p_ * m_words];
+    int wi = lo_ / word_bits;
+    int shift = lo_ % word_bits;
+
+    word_type v = plane[wi] >> shift;
+    if( shift != 0 && shift + n_ > word_bits ) {
+        v |= plane[wi + 1] << ( word_bits - shift );
+    }
+    return n_ < word_bits ? v & ( ( word_type( 1 ) << n_ ) - 1 ) : v;
+}
+
+
+// write up to a word of bits of the new value
+
+void
+sc_signal_bank_base::set_bits( int p_, int lo_, int n_, word_type v_ )
+{
+    word_type* plane = &m_new_val[p_ * m_words];
+    int wi = lo_ / word_bits;
+    int shift = lo_ % word_bits;
+    word_type mask = n_ < word_bits ? ( word_type( 1 ) << n_ ) - 1
+                                    : ~word_type( 0 );
+    v_ &= mask;
+
+    plane[wi] = ( plane[wi] & ~( mask << shift ) ) | ( v_ << shift );
+    if( wi < m_dirty_lo ) m_dirty_lo = wi;
+    if( shift != 0 && shift + n_ > word_bits ) {
+        int rest = word_bits - shift;
+        ++wi;
+        plane[wi] = ( plane[wi] & ~( mask >> rest ) ) | ( v_ >> rest );
+    }
+    if( wi > m_dirty_hi ) m_dirty_hi = wi;
+    request_update();
+}
+
+
+// set all bits of a plane, the bits beyond the size stay 0
+
+void
+sc_signal_bank_base::fill( int p_, bool v_ )
+{
+    for( int wi = 0; wi < m_words; ++wi ) {
+        word_type word = v_ ? ~word_type( 0 ) : word_type( 0 );
+        if( wi == m_words - 1 && m_size % word_bits != 0 ) {
+            word &= ( word_type( 1 ) << ( m_size % word_bits ) ) - 1;
+        }
+        m_cur_val[p_ * m_words + wi] = word;
+        m_new_val[p_ * m_words + wi] = word;
+    }
+}
+
+
+// create a (kernel) event, if needed
+
+sc_event*
+sc_signal_bank_base::lazy_kernel_event( sc_event** ev, const char* name ) const
+{
+    if( !*ev ) {
+        *ev = new sc_event( sc_event::kernel_event, name );
+    }
+    return *ev;
+}
+
+
+// the events of a bit, created with the first of them
+
+sc_signal_bank_base::bit_events&
+sc_signal_bank_base::events_of( int i_ ) const
+{
+    if( m_bit_events.empty() ) {
+        m_bit_events.resize( m_size, 0 );
+    }
+    bit_events*& events_p = m_bit_events[i_];
+    if( !events_p ) {
+        events_p = new bit_events();
+        events_p->change_event_p = 0;
+        events_p->posedge_event_p = 0;
+        events_p->negedge_event_p = 0;
+        events_p->reset_p = 0;
+    }
+    return *events_p;
+}
+
+
+// get the value changed events
+
+const sc_event&
+sc_signal_bank_base::value_changed_event() const
+{
+    return *lazy_kernel_event( &m_change_event_p, "value_changed_event" );
+}
+
+const sc_event&
+sc_signal_bank_base::value_changed_event( int i_ ) const
+{
+    if( !check_range( i_, i_, "value_changed_event" ) ) {
+        i_ = 0;
+    }
+    return *lazy_kernel_event( &events_of( i_ ).change_event_p,
+                               "value_changed_event" );
+}
+
+const sc_event&
+sc_signal_bank_base::value_changed_event( int left_, int right_ ) const
+{
+    if( !check_range( left_, right_, "value_changed_event" ) ) {
+        left_ = right_ = 0;
+    }
+    for( std::size_t i = 0; i < m_slice_events.size(); ++i ) {
+        if( m_slice_events[i].left == left_ &&
+            m_slice_events[i].right == right_ ) {
+            return *m_slice_events[i].event_p;
+        }
+    }
+    slice_event slice;
+    slice.left = left_;
+    slice.right = right_;
+    slice.event_p = 0;
+    lazy_kernel_event( &slice.event_p, "value_changed_event" );
+    m_slice_events.push_back( slice );
+    return *slice.event_p;
+}
+
+
+// get the edge events of a bit
+
+const sc_event&
+sc_signal_bank_base::posedge_event( int i_ ) const
+{
+    if( !check_range( i_, i_, "posedge_event" ) ) {
+        i_ = 0;
+    }
+    return *lazy_kernel_event( &events_of( i_ ).posedge_event_p,
+                               "posedge_event" );
+}
+
+const sc_event&
+sc_signal_bank_base::negedge_event( int i_ ) const
+{
+    if( !check_range( i_, i_, "negedge_event" ) ) {
+        i_ = 0;
+    }
+    return *lazy_kernel_event( &events_of( i_ ).negedge_event_p,
+                               "negedge_event" );
+}
+
+
+// get the reset of a bit
+
+sc_reset*
+sc_signal_bank_base::bit_reset( int i_,
+                                const sc_signal_in_if<bool>* iface_p ) const
+{
+    bit_events& events = events_of( i_ );
+    if( !events.reset_p ) {
+        events.reset_p = new sc_reset( iface_p );
+    }
+    return events.reset_p;
+}
+
+
+// was there an event?
+
+bool
+sc_signal_bank_base::event() const
+{
+    return simcontext()->event_occurred( m_change_stamp );
+}
+
+bool
+sc_signal_bank_base::event( int i_ ) const
+{
+    return check_range( i_, i_, "event" ) && event() &&
+           ( ( m_changed[i_ / word_bits] >> ( i_ % word_bits ) ) & 1 );
+}
+
+bool
+sc_signal_bank_base::event( int left_, int right_ ) const
+{
+    return check_range( left_, right_, "event" ) && event() &&
+           changed( left_, right_ );
+}
+
+bool
+sc_signal_bank_base::posedge( int i_ ) const
+{
+    return event( i_ ) && get_bit( 0, i_ ) &&
+           !( m_planes > 1 && get_bit( 1, i_ ) );
+}
+
+bool
+sc_signal_bank_base::negedge( int i_ ) const
+{
+    return event( i_ ) && !get_bit( 0, i_ ) &&
+           !( m_planes > 1 && get_bit( 1, i_ ) );
+}
+
+
+// did any of the bits left_ down to right_ change in the last update?
+
+bool
+sc_signal_bank_base::changed( int left_, int right_ ) const
+{
+    int lo = right_ / word_bits;
+    int hi = left_ / word_bits;
+    for( int wi = lo; wi <= hi; ++wi ) {
+        word_type mask = ~word_type( 0 );
+        if( wi == lo ) {
+            mask &= ~word_type( 0 ) << ( right_ % word_bits );
+        }
+        if( wi == hi && left_ % word_bits != word_bits - 1 ) {
+            mask &= ( word_type( 1 ) << ( left_ % word_bits + 1 ) ) - 1;
+        }
+        if( m_changed[wi] & mask ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+// notify the events of the changed bits of a word
+
+void
+sc_signal_bank_base::notify_bits( int w_ )
+{
+    word_type diff = m_changed[w_];
+    for( int i = w_ * word_bits; diff != 0; ++i, diff >>= 1 ) {
+        if( !( diff & 1 ) || !m_bit_events[i] ) {
+            continue;
+        }
+        bit_events& events = *m_bit_events[i];
+        if( events.change_event_p ) {
+            events.change_event_p->notify_next_delta();
+        }
+        if( !( m_planes > 1 && get_bit( 1, i ) ) ) {
+            sc_event* edge_p = get_bit( 0, i ) ? events.posedge_event_p
+                                               : events.negedge_event_p;
+            if( edge_p ) {
+                edge_p->notify_next_delta();
+            }
+        }
+        if( events.reset_p ) {
+            events.reset_p->notify_processes();
+        }
+    }
+}
+
+
+// save and restore the words of all planes of the current value
+
+void
+sc_signal_bank_base::save_state( ::std::ostream& os ) const
+{
+    os << m_cur_val.size() << ::std::hex;
+    for( std::size_t i = 0; i < m_cur_val.size(); ++i ) {
+        os << ' ' << m_cur_val[i];
+    }
+}
+
+void
+sc_signal_bank_base::restore_state( ::std::istream& is )
+{
+    std::size_t n;
+    if( !( is >> n ) || n != m_cur_val.size() ) {
+        return;
+    }
+    std::vector<word_type> words( n );
+    is >> ::std::hex;
+    for( std::size_t i = 0; i < n; ++i ) {
+        if( !( is >> words[i] ) ) {
+            return;
+        }
+    }
+    m_cur_val = words;
+    m_new_val = words;
+}
+
+
+// commit the written words, then notify the events of the changed bits
+
+void
+sc_signal_bank_base::update()
+{
+    for( int wi = m_changed_lo; wi <= m_changed_hi; ++wi ) {
+        m_changed[wi] = 0;
+    }
+    m_changed_lo = m_words;
+    m_changed_hi = -1;
+
+    for( int wi = m_dirty_lo; wi <= m_dirty_hi; ++wi ) {
+        word_type diff = 0;
+        for( int p = 0; p < m_planes; ++p ) {
+            word_type& cur = m_cur_val[p * m_words + wi];
+            word_type  next = m_new_val[p * m_words + wi];
+            diff |= cur ^ next;
+            cur = next;
+        }
+        if( diff != 0 ) {
+            m_changed[wi] = diff;
+            if( wi < m_changed_lo ) m_changed_lo = wi;
+            m_changed_hi = wi;
+        }
+    }
+    m_dirty_lo = m_words;
+    m_dirty_hi = -1;
+
+    if( m_changed_hi < 0 ) {
+        return;
+    }
+
+    m_change_stamp = simcontext()->change_stamp();
+    if( m_change_event_p ) {
+        m_change_event_p->notify_next_delta();
+    }
+    if( !m_bit_events.empty() ) {
+        for( int wi = m_changed_lo; wi <= m_changed_hi; ++wi ) {
+            if( m_changed[wi] != 0 ) {
+                notify_bits( wi );
+            }
+        }
+    }
+    for( std::size_t i = 0; i < m_slice_events.size(); ++i ) {
+        const slice_event& slice = m_slice_events[i];
+        if( changed( slice.left, slice.right ) ) {
+            slice.event_p->notify_next_delta();
+        }
+    }
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
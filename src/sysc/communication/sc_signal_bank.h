@@ -0,0 +1,529 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_signal_bank.h -- A bank of bool or sc_logic signals packed in words.
+
+  A single primitive channel holds the values of all bits of a wide bus or
+  register file, instead of one sc_signal<bool> per bit. The value changed
+  events of the whole bank, of slices and of single bits are created when
+  they are first requested, and ports bind to single bits via adapters:
+
+      sc_signal_bank<bool> regs( "regs", 4096 );
+      sc_in<bool>          in;
+      in( regs.bit( 42 ) );
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_SIGNAL_BANK_H_INCLUDED_
+#define SC_SIGNAL_BANK_H_INCLUDED_
+
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/communication/sc_signal_ifs.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/datatypes/bit/sc_bv_base.h"
+#include "sysc/datatypes/bit/sc_lv_base.h"
+
+#include <algorithm>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::vector
+#endif
+
+namespace sc_core {
+
+class SC_API sc_reset;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_signal_bank_base
+//
+//  The type-agnostic base class of sc_signal_bank<T>. The bits are kept in
+//  one or two planes of 64-bit words, like the data and control words of
+//  sc_lv_base, and the written words are committed at once in the update
+//  phase.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_signal_bank_base
+  : public sc_interface
+  , public sc_prim_channel
+{
+public:
+
+    typedef sc_dt::uint64 word_type;
+    enum { word_bits = 64 };
+
+    virtual const char* kind() const
+        { return "sc_signal_bank"; }
+
+    // the number of bits
+    int size() const
+        { return m_size; }
+
+    // get the default event
+    virtual const sc_event& default_event() const
+        { return value_changed_event(); }
+
+    // get the value changed event of the whole bank, of bit i_, and of the
+    // bits left_ down to right_
+    const sc_event& value_changed_event() const;
+    const sc_event& value_changed_event( int i_ ) const;
+    const sc_event& value_changed_event( int left_, int right_ ) const;
+
+    // get the events of bit i_ changing to 1 and to 0
+    const sc_event& posedge_event( int i_ ) const;
+    const sc_event& negedge_event( int i_ ) const;
+
+    // was there an event of the whole bank, of bit i_, of the bits left_
+    // down to right_?
+    bool event() const;
+    bool event( int i_ ) const;
+    bool event( int left_, int right_ ) const;
+
+    // did bit i_ change to 1 or to 0?
+    bool posedge( int i_ ) const;
+    bool negedge( int i_ ) const;
+
+protected:
+
+    // constructor and destructor
+
+    sc_signal_bank_base( const char* name_, int size_, int planes_ );
+
+    virtual ~sc_signal_bank_base();
+
+    // report an error and return false, if the bits left_ down to right_
+    // are out of range, or if a vector of width_ bits does not fit them
+    bool check_range( int left_, int right_, const char* method_ ) const;
+    bool check_width( int left_, int right_, int width_,
+                      const char* method_ ) const;
+
+    // the bit i_ of plane p_ of the current value
+    bool get_bit( int p_, int i_ ) const
+    {
+        return ( m_cur_val[p_ * m_words + i_ / word_bits]
+                 >> ( i_ % word_bits ) ) & 1;
+    }
+
+    // write the bit i_ of plane p_ of the new value
+    void set_bit( int p_, int i_, bool v_ );
+
+    // the n_ bits from bit lo_ of plane p_ of the current value, n_ <= 64
+    word_type get_bits( int p_, int lo_, int n_ ) const;
+
+    // write the n_ bits from bit lo_ of plane p_ of the new value, n_ <= 64
+    void set_bits( int p_, int lo_, int n_, word_type v_ );
+
+    // set all bits of plane p_ of the current and the new value
+    void fill( int p_, bool v_ );
+
+    // the reset of bit i_ for reset_signal_is(), created on first use,
+    // the bits of sc_logic banks are no reset signals
+    sc_reset* bit_reset( int i_, const sc_signal_in_if<bool>* iface_p ) const;
+    sc_reset* bit_reset( int, const sc_signal_in_if<sc_dt::sc_logic>* ) const
+        { return 0; }
+
+    virtual void update();
+
+    // the words of the current value
+    virtual void save_state( ::std::ostream& ) const;
+    virtual void restore_state( ::std::istream& );
+
+private:
+
+    // the events of a single bit, created when requested
+    struct bit_events
+    {
+        sc_event* change_event_p;
+        sc_event* posedge_event_p;
+        sc_event* negedge_event_p;
+        sc_reset* reset_p;
+    };
+
+    // the value changed event of a slice
+    struct slice_event
+    {
+        int       left;
+        int       right;
+        sc_event* event_p;
+    };
+
+    bit_events& events_of( int i_ ) const;
+    sc_event* lazy_kernel_event( sc_event**, const char* ) const;
+    bool changed( int left_, int right_ ) const;
+    void notify_bits( int w_ );
+
+    // disabled
+    sc_signal_bank_base( const sc_signal_bank_base& );
+    sc_signal_bank_base& operator = ( const sc_signal_bank_base& );
+
+private:
+    int                              m_size;           // number of bits.
+    int                              m_words;          // words per plane.
+    int                              m_planes;         // 1 (bool) or 2.
+    std::vector<word_type>           m_cur_val;        // current planes.
+    std::vector<word_type>           m_new_val;        // next planes.
+    std::vector<word_type>           m_changed;        // bits of last event.
+    int                              m_dirty_lo;       // first written word.
+    int                              m_dirty_hi;       // last written word.
+    int                              m_changed_lo;     // first changed word.
+    int                              m_changed_hi;     // last changed word.
+    mutable sc_event*                m_change_event_p; // bank event if present.
+    mutable std::vector<bit_events*> m_bit_events;     // bit events if present.
+    mutable std::vector<slice_event> m_slice_events;   // slice events.
+    sc_dt::uint64                    m_change_stamp;   // delta of last event.
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS TEMPLATE : sc_signal_bank_traits<T>
+//
+//  How the values of type T are kept in the planes of an sc_signal_bank<T>.
+// ----------------------------------------------------------------------------
+
+template< class T > struct sc_signal_bank_traits;
+
+template<>
+struct sc_signal_bank_traits<bool>
+{
+    enum { planes = 1 };
+    typedef sc_dt::sc_bv_base vector_type;
+
+    static bool value( bool data_, bool /* ctrl_ */ )
+        { return data_; }
+    static bool data( bool v_ )
+        { return v_; }
+    static bool ctrl( bool /* v_ */ )
+        { return false; }
+};
+
+template<>
+struct sc_signal_bank_traits<sc_dt::sc_logic>
+{
+    enum { planes = 2 };
+    typedef sc_dt::sc_lv_base vector_type;
+
+    static sc_dt::sc_logic value( bool data_, bool ctrl_ )
+        { return sc_dt::sc_logic( sc_dt::sc_logic_value_t( data_ | ctrl_ << 1 ) ); }
+    static bool data( const sc_dt::sc_logic& v_ )
+        { return v_.value() & 1; }
+    static bool ctrl( const sc_dt::sc_logic& v_ )
+        { return ( v_.value() >> 1 ) & 1; }
+};
+
+
+template< class T > class sc_signal_bank;
+
+// ----------------------------------------------------------------------------
+//  CLASS TEMPLATE : sc_signal_bank_bit<T>
+//
+//  The signal interface of a single bit of an sc_signal_bank<T>, to bind
+//  the ports of single bit signals, e.g. sc_in<bool>. Created by
+//  sc_signal_bank<T>::bit() and owned by the bank.
+// ----------------------------------------------------------------------------
+
+template< class T >
+class sc_signal_bank_bit
+  : public sc_signal_inout_if<T>
+{
+    friend class sc_signal_bank<T>;
+
+public:
+
+    // the bank and the index of the bit
+    sc_signal_bank<T>& bank() const
+        { return m_bank; }
+    int index() const
+        { return m_index; }
+
+    // interface methods
+
+    virtual const sc_event& default_event() const
+        { return value_changed_event(); }
+
+    virtual const sc_event& value_changed_event() const
+        { return m_bank.value_changed_event( m_index ); }
+
+    virtual const sc_event& posedge_event() const
+        { return m_bank.posedge_event( m_index ); }
+
+    virtual const sc_event& negedge_event() const
+        { return m_bank.negedge_event( m_index ); }
+
+    virtual const T& read() const
+        { m_value = m_bank.read( m_index ); return m_value; }
+
+    virtual const T& get_data_ref() const
+        { return read(); }
+
+    virtual bool event() const
+        { return m_bank.event( m_index ); }
+
+    virtual bool posedge() const
+        { return m_bank.posedge( m_index ); }
+
+    virtual bool negedge() const
+        { return m_bank.negedge( m_index ); }
+
+    virtual void write( const T& v_ )
+        { m_bank.write( m_index, v_ ); }
+
+    virtual sc_writer_policy get_writer_policy() const
+        { return SC_MANY_WRITERS; }
+
+private:
+
+    sc_signal_bank_bit( sc_signal_bank<T>& bank_, int index_ )
+      : m_bank( bank_ ), m_index( index_ ), m_value()
+    {}
+
+    // designate this bit as a reset signal (for bool banks only)
+    virtual sc_reset* is_reset() const
+        { return m_bank.bit_reset( m_index, this ); }
+
+    // disabled
+    sc_signal_bank_bit( const sc_signal_bank_bit& );
+    sc_signal_bank_bit& operator = ( const sc_signal_bank_bit& );
+
+private:
+    sc_signal_bank<T>& m_bank;   // bank of the bit.
+    int                m_index;  // index of the bit.
+    mutable T          m_value;  // value returned by reference.
+};
+
+
+// ----------------------------------------------------------------------------
+//  CLASS TEMPLATE : sc_signal_bank<T>
+//
+//  A bank of bool or sc_dt::sc_logic signals packed in words.
+// ----------------------------------------------------------------------------
+
+template< class T >
+class sc_signal_bank
+  : public sc_signal_bank_base
+{
+    friend class sc_signal_bank_bit<T>;
+
+    typedef sc_signal_bank_traits<T> traits_type;
+
+public:
+
+    typedef T                                 value_type;
+    typedef typename traits_type::vector_type vector_type;
+    typedef sc_signal_bank_bit<T>             bit_type;
+
+    // constructors and destructor
+
+    explicit sc_signal_bank( int size_, const value_type& init_ = value_type() )
+      : sc_signal_bank_base( sc_gen_unique_name( "signal_bank" ), size_,
+                             traits_type::planes )
+      , m_bits()
+        { init( init_ ); }
+
+    sc_signal_bank( const char* name_, int size_,
+                    const value_type& init_ = value_type() )
+      : sc_signal_bank_base( name_, size_, traits_type::planes )
+      , m_bits()
+        { init( init_ ); }
+
+    virtual ~sc_signal_bank();
+
+    // read the current value of bit i_, of the bits left_ down to right_,
+    // and of the whole bank
+
+    value_type read( int i_ ) const;
+    vector_type read( int left_, int right_ ) const;
+    vector_type read() const
+        { return read( size() - 1, 0 ); }
+
+    // write the new value of bit i_, of the bits left_ down to right_, and
+    // of the whole bank
+
+    void write( int i_, const value_type& v_ );
+    void write( int left_, int right_, const vector_type& v_ );
+    void write( const vector_type& v_ )
+        { write( size() - 1, 0, v_ ); }
+
+    // get the signal interface of bit i_, to bind a port
+
+    bit_type& bit( int i_ );
+    bit_type& operator [] ( int i_ )
+        { return bit( i_ ); }
+
+    virtual void print( ::std::ostream& = ::std::cout ) const;
+    virtual void dump( ::std::ostream& = ::std::cout ) const;
+
+private:
+
+    void init( const value_type& init_ );
+
+    // disabled
+    sc_signal_bank( const sc_signal_bank& );
+    sc_signal_bank& operator = ( const sc_signal_bank& );
+
+private:
+    std::vector<bit_type*> m_bits;  // bit interfaces if present.
+};
+
+// IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
+
+template< class T >
+inline
+sc_signal_bank<T>::~sc_signal_bank()
+{
+    for( std::size_t i = 0; i < m_bits.size(); ++i ) {
+        delete m_bits[i];
+    }
+}
+
+template< class T >
+inline
+void
+sc_signal_bank<T>::init( const value_type& init_ )
+{
+    fill( 0, traits_type::data( init_ ) );
+    if( traits_type::planes > 1 ) {
+        fill( 1, traits_type::ctrl( init_ ) );
+    }
+}
+
+template< class T >
+inline
+typename sc_signal_bank<T>::value_type
+sc_signal_bank<T>::read( int i_ ) const
+{
+    if( !check_range( i_, i_, "read" ) ) {
+        return value_type();
+    }
+    return traits_type::value( get_bit( 0, i_ ),
+                               traits_type::planes > 1 && get_bit( 1, i_ ) );
+}
+
+// the slice is copied word by word
+
+template< class T >
+inline
+typename sc_signal_bank<T>::vector_type
+sc_signal_bank<T>::read( int left_, int right_ ) const
+{
+    if( !check_range( left_, right_, "read" ) ) {
+        return vector_type( 1 );
+    }
+    int length = left_ - right_ + 1;
+    vector_type result( length );
+    for( int wi = 0; wi < result.size(); ++wi ) {
+        int lo = right_ + wi * sc_dt::SC_DIGIT_SIZE;
+        int n = std::min( sc_dt::SC_DIGIT_SIZE, left_ + 1 - lo );
+        result.set_word( wi, static_cast<sc_dt::sc_digit>( get_bits( 0, lo, n ) ) );
+        if( traits_type::planes > 1 ) {
+            result.set_cword( wi,
+                              static_cast<sc_dt::sc_digit>( get_bits( 1, lo, n ) ) );
+        }
+    }
+    return result;
+}
+
+template< class T >
+inline
+void
+sc_signal_bank<T>::write( int i_, const value_type& v_ )
+{
+    if( !check_range( i_, i_, "write" ) ) {
+        return;
+    }
+    set_bit( 0, i_, traits_type::data( v_ ) );
+    if( traits_type::planes > 1 ) {
+        set_bit( 1, i_, traits_type::ctrl( v_ ) );
+    }
+}
+
+template< class T >
+inline
+void
+sc_signal_bank<T>::write( int left_, int right_, const vector_type& v_ )
+{
+    if( !check_range( left_, right_, "write" ) ||
+        !check_width( left_, right_, v_.length(), "write" ) ) {
+        return;
+    }
+    for( int wi = 0; wi < v_.size(); ++wi ) {
+        int lo = right_ + wi * sc_dt::SC_DIGIT_SIZE;
+        int n = std::min( sc_dt::SC_DIGIT_SIZE, left_ + 1 - lo );
+        set_bits( 0, lo, n, v_.get_word( wi ) );
+        if( traits_type::planes > 1 ) {
+            set_bits( 1, lo, n, v_.get_cword( wi ) );
+        }
+    }
+}
+
+template< class T >
+inline
+typename sc_signal_bank<T>::bit_type&
+sc_signal_bank<T>::bit( int i_ )
+{
+    if( !check_range( i_, i_, "bit" ) ) {
+        i_ = 0;
+    }
+    if( m_bits.empty() ) {
+        m_bits.resize( size(), 0 );
+    }
+    if( !m_bits[i_] ) {
+        m_bits[i_] = new bit_type( *this, i_ );
+    }
+    return *m_bits[i_];
+}
+
+template< class T >
+inline
+void
+sc_signal_bank<T>::print( ::std::ostream& os ) const
+{
+    os << read();
+}
+
+template< class T >
+inline
+void
+sc_signal_bank<T>::dump( ::std::ostream& os ) const
+{
+    os << "     name = " << name() << ::std::endl;
+    os << "     size = " << size() << ::std::endl;
+    os << "    value = " << read() << ::std::endl;
+}
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_SIGNAL_BANK_H_INCLUDED_
+// Taf!
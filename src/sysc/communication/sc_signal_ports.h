@@ -72,6 +72,21 @@ struct SC_API sc_trace_params
 typedef std::vector<sc_trace_params*> sc_trace_params_vec;
 
 
+// ----------------------------------------------------------------------------
+//  CLASS : sc_signal_in_port
+//
+//  Common base class of the sc_in<T> ports, which only read the bound
+//  signal. Identifies them regardless of T, e.g. by a dynamic_cast from
+//  sc_port_base.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_signal_in_port
+{
+protected:
+    ~sc_signal_in_port() {}
+};
+
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_in<T>
 //
@@ -80,7 +95,8 @@ typedef std::vector<sc_trace_params*> sc_trace_params_vec;
 
 template <class T>
 class sc_in
-: public sc_port<sc_signal_in_if<T>,1,SC_ONE_OR_MORE_BOUND>
+: public sc_port<sc_signal_in_if<T>,1,SC_ONE_OR_MORE_BOUND>,
+  public sc_signal_in_port
 {
 public:
 
@@ -392,7 +408,8 @@ SC_API_TEMPLATE_DECL_ sc_port<sc_signal_in_if<bool>,1,SC_ONE_OR_MORE_BOUND>;
 
 template <>
 class SC_API sc_in<bool> :
-    public sc_port<sc_signal_in_if<bool>,1,SC_ONE_OR_MORE_BOUND>
+    public sc_port<sc_signal_in_if<bool>,1,SC_ONE_OR_MORE_BOUND>,
+    public sc_signal_in_port
 {
 public:
 
@@ -656,7 +673,8 @@ SC_API_TEMPLATE_DECL_ sc_port<sc_signal_in_if<sc_dt::sc_logic>,1,SC_ONE_OR_MORE_
 
 template <>
 class SC_API sc_in<sc_dt::sc_logic>
-: public sc_port<sc_signal_in_if<sc_dt::sc_logic>,1,SC_ONE_OR_MORE_BOUND>
+: public sc_port<sc_signal_in_if<sc_dt::sc_logic>,1,SC_ONE_OR_MORE_BOUND>,
+  public sc_signal_in_port
 {
 public:
 
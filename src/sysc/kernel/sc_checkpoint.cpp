@@ -0,0 +1,355 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_checkpoint.cpp -- Checkpoint of the state of a simulation.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_checkpoint.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_process.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/utils/sc_report.h"
+
+#include <iomanip>
+#include <istream>
+#include <ostream>
+#include <sstream>
+
+namespace sc_core {
+
+// The checkpoint is written as text lines, except for the saved state of
+// the objects, which is written as a byte count and the raw bytes:
+//
+//   SystemC checkpoint 2
+//   resolution <femto seconds>
+//   time <time> <delta count> <delta count at time> <change stamp>
+//   timed <n>          followed by n lines "<time> <event name>"
+//   delta <n>          followed by n lines "<event name>"
+//   processes <n>      followed by n lines "<flags> <process name>"
+//   timeouts <n>       followed by n lines "<time> <process name>"
+//   objects <n>        followed by n times "<size> <object name>" and
+//                      the size bytes of the state
+//   end
+//
+// Version 1 checkpoints have no timeouts section and flag the processes
+// waiting on a timeout as waiting on dynamic sensitivity; they are still
+// read.
+
+static const char* const checkpoint_magic = "SystemC checkpoint 2";
+static const char* const checkpoint_magic_v1 = "SystemC checkpoint 1";
+
+// read a keyword and a count on a line of its own
+
+static bool
+read_section( std::istream& is, const char* keyword, sc_dt::uint64& count )
+{
+    std::string word;
+    return ( is >> word >> count ) && word == keyword;
+}
+
+// read the rest of the line after a number as a name
+
+static bool
+read_name( std::istream& is, std::string& name )
+{
+    if ( is.get() != ' ' )
+        return false;
+    return std::getline( is, name ) && !name.empty();
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_checkpoint
+// ----------------------------------------------------------------------------
+
+sc_checkpoint::sc_checkpoint()
+  : m_resolution( 0 )
+  , m_time( 0 )
+  , m_delta_count( 0 )
+  , m_delta_count_at_time( 0 )
+  , m_change_stamp( 0 )
+  , m_timed()
+  , m_delta()
+  , m_processes()
+  , m_timeouts()
+  , m_objects()
+{}
+
+sc_checkpoint::~sc_checkpoint()
+{}
+
+void
+sc_checkpoint::save_process( const sc_process_b* process_p )
+{
+    char        flags[8];
+    std::size_t count = 0;
+    if ( process_p->terminated() )
+        flags[count++] = terminated;
+    else if ( process_p->proc_kind() != SC_METHOD_PROC_ &&
+              process_p->m_has_stack )
+        flags[count++] = busy;
+    if ( process_p->m_state & sc_process_b::ps_bit_disabled )
+        flags[count++] = disabled;
+    if ( process_p->m_state & sc_process_b::ps_bit_suspended )
+        flags[count++] = suspended;
+    if ( process_p->is_runnable() ||
+         ( process_p->m_state & sc_process_b::ps_bit_ready_to_run ) )
+        flags[count++] = ready;
+    if ( process_p->m_trigger_type != sc_process_b::STATIC &&
+         process_p->m_trigger_type != sc_process_b::TIMEOUT )
+        flags[count++] = triggered;
+    if ( count == 0 )
+        flags[count++] = '-';
+    m_processes[process_p->name()].assign( flags, count );
+
+    // a delta notified timeout expires at the time of the checkpoint
+
+    const sc_event* timeout_p = process_p->m_timeout_event_p;
+    if ( process_p->m_trigger_type >= sc_process_b::TIMEOUT && timeout_p &&
+         timeout_p->m_notify_type != sc_event::NONE )
+    {
+        m_timeouts[process_p->name()] =
+          timeout_p->m_notify_type == sc_event::TIMED
+          ? timeout_p->m_timed->notify_time().value() : m_time;
+    }
+}
+
+bool
+sc_checkpoint::process_flag( const sc_process_b* process_p, char flag ) const
+{
+    state_map::const_iterator it = m_processes.find( process_p->name() );
+    return it != m_processes.end() &&
+           it->second.find( flag ) != std::string::npos;
+}
+
+bool
+sc_checkpoint::process_timeout( const sc_process_b* process_p,
+                                sc_dt::uint64& time ) const
+{
+    time_map::const_iterator it = m_timeouts.find( process_p->name() );
+    if ( it == m_timeouts.end() )
+        return false;
+    time = it->second;
+    return true;
+}
+
+// A thread process is started as in the initialization phase, unless it
+// had terminated. A method process runs if it was runnable or waiting on
+// dynamic sensitivity to events, which is not restored; a method process
+// waiting on a timeout only is triggered by the restored timeout instead.
+// Processes created since the checkpoint was saved are initialized as
+// usual.
+
+bool
+sc_checkpoint::initialize( const sc_process_b* process_p ) const
+{
+    state_map::const_iterator it = m_processes.find( process_p->name() );
+    if ( it == m_processes.end() )
+        return !process_p->dont_initialize();
+
+    const std::string& flags = it->second;
+    if ( flags.find( static_cast<char>( terminated ) ) != std::string::npos )
+        return false;
+    if ( process_p->proc_kind() != SC_METHOD_PROC_ )
+        return !process_p->dont_initialize();
+    return flags.find( static_cast<char>( ready ) ) != std::string::npos ||
+           flags.find( static_cast<char>( triggered ) ) != std::string::npos;
+}
+
+void
+sc_checkpoint::save_objects( const std::vector<sc_object*>& objects,
+                             std::vector<std::string>& unsaved )
+{
+    for ( std::size_t i = 0; i < objects.size(); ++i )
+    {
+        sc_object* object_p = objects[i];
+        std::ostringstream state;
+
+        if ( sc_module* module_p = dynamic_cast<sc_module*>( object_p ) )
+            module_p->save_state( state );
+        else if ( sc_prim_channel* channel_p =
+                    dynamic_cast<sc_prim_channel*>( object_p ) )
+            channel_p->save_state( state );
+
+        if ( state.fail() )
+            unsaved.push_back( object_p->name() );
+        else if ( !state.str().empty() )
+            m_objects[object_p->name()] = state.str();
+
+        save_objects( object_p->get_child_objects(), unsaved );
+    }
+}
+
+// parents are restored before their children, as the names sort that way
+
+void
+sc_checkpoint::restore_objects() const
+{
+    state_map::const_iterator it;
+    for ( it = m_objects.begin(); it != m_objects.end(); ++it )
+    {
+        sc_object* object_p = sc_find_object( it->first.c_str() );
+        std::istringstream state( it->second );
+
+        if ( sc_module* module_p = dynamic_cast<sc_module*>( object_p ) )
+            module_p->restore_state( state );
+        else if ( sc_prim_channel* channel_p =
+                    dynamic_cast<sc_prim_channel*>( object_p ) )
+            channel_p->restore_state( state );
+        else
+        {
+            std::string msg = "object not found, state not restored: " +
+                              it->first;
+            SC_REPORT_WARNING( SC_ID_CHECKPOINT_, msg.c_str() );
+        }
+    }
+}
+
+bool
+sc_checkpoint::write( std::ostream& os ) const
+{
+    os << checkpoint_magic << '\n'
+       << "resolution " << std::setprecision( 17 ) << m_resolution << '\n'
+       << "time " << m_time << ' ' << m_delta_count << ' '
+       << m_delta_count_at_time << ' ' << m_change_stamp << '\n';
+
+    os << "timed " << m_timed.size() << '\n';
+    for ( std::size_t i = 0; i < m_timed.size(); ++i )
+        os << m_timed[i].time << ' ' << m_timed[i].event << '\n';
+
+    os << "delta " << m_delta.size() << '\n';
+    for ( std::size_t i = 0; i < m_delta.size(); ++i )
+        os << m_delta[i] << '\n';
+
+    state_map::const_iterator it;
+    os << "processes " << m_processes.size() << '\n';
+    for ( it = m_processes.begin(); it != m_processes.end(); ++it )
+        os << it->second << ' ' << it->first << '\n';
+
+    os << "timeouts " << m_timeouts.size() << '\n';
+    for ( time_map::const_iterator t = m_timeouts.begin();
+          t != m_timeouts.end(); ++t )
+        os << t->second << ' ' << t->first << '\n';
+
+    os << "objects " << m_objects.size() << '\n';
+    for ( it = m_objects.begin(); it != m_objects.end(); ++it )
+    {
+        os << it->second.size() << ' ' << it->first << '\n';
+        os.write( it->second.data(), it->second.size() );
+        os << '\n';
+    }
+
+    os << "end" << std::endl;
+    return !os.fail();
+}
+
+bool
+sc_checkpoint::read( std::istream& is )
+{
+    std::string   line;
+    sc_dt::uint64 count;
+
+    if ( !std::getline( is, line ) )
+        return false;
+    bool v1 = line == checkpoint_magic_v1;
+    if ( !v1 && line != checkpoint_magic )
+        return false;
+
+    if ( !( is >> line >> m_resolution ) || line != "resolution" )
+        return false;
+    if ( !( is >> line >> m_time >> m_delta_count >> m_delta_count_at_time
+               >> m_change_stamp ) || line != "time" )
+        return false;
+
+    if ( !read_section( is, "timed", count ) )
+        return false;
+    m_timed.resize( count );
+    for ( std::size_t i = 0; i < m_timed.size(); ++i )
+    {
+        if ( !( is >> m_timed[i].time ) || !read_name( is, m_timed[i].event ) )
+            return false;
+    }
+
+    if ( !read_section( is, "delta", count ) || is.get() != '\n' )
+        return false;
+    m_delta.resize( count );
+    for ( std::size_t i = 0; i < m_delta.size(); ++i )
+    {
+        if ( !std::getline( is, m_delta[i] ) || m_delta[i].empty() )
+            return false;
+    }
+
+    if ( !read_section( is, "processes", count ) )
+        return false;
+    for ( ; count; --count )
+    {
+        std::string flags, name;
+        if ( !( is >> flags ) || !read_name( is, name ) )
+            return false;
+        m_processes[name] = flags;
+    }
+
+    if ( !v1 && !read_section( is, "timeouts", count ) )
+        return false;
+    for ( ; count; --count )
+    {
+        sc_dt::uint64 time;
+        std::string   name;
+        if ( !( is >> time ) || !read_name( is, name ) )
+            return false;
+        m_timeouts[name] = time;
+    }
+
+    if ( !read_section( is, "objects", count ) )
+        return false;
+    for ( ; count; --count )
+    {
+        std::size_t size;
+        std::string name;
+        if ( !( is >> size ) || !read_name( is, name ) )
+            return false;
+        std::string& state = m_objects[name];
+        state.resize( size );
+        if ( size && !is.read( &state[0], size ) )
+            return false;
+        if ( is.get() != '\n' )
+            return false;
+    }
+
+    return ( is >> line ) && line == "end";
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
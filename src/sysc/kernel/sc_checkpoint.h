@@ -0,0 +1,156 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_checkpoint.h -- Checkpoint of the state of a simulation.
+
+  A checkpoint holds the kernel state of a paused simulation: the current
+  time, the delta count, the pending timed and delta notifications of the
+  named events and the state of the processes. Modules and primitive
+  channels add their own state by overriding save_state and
+  restore_state. Events, processes and objects are identified by their
+  hierarchical names, so a checkpoint can be restored into a fresh
+  instance of the same model before its simulation starts.
+
+  The pending timeouts of the processes (wait(t), next_trigger(t)) are
+  saved as well: a method process waiting on a timeout only is triggered
+  by it again after a restore. The execution state of thread processes
+  (their stacks) and the dynamic sensitivity to events are not part of a
+  checkpoint: when a checkpoint is restored, the thread processes start
+  from the beginning of their functions, as in the initialization phase,
+  and the method processes waiting on events run once. A warning lists
+  the processes that were suspended within their functions or waiting
+  this way when the checkpoint was saved.
+
+  FOR INTERNAL USE ONLY!
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_CHECKPOINT_H_INCLUDED_
+#define SC_CHECKPOINT_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sc_core {
+
+class sc_object;
+class sc_process_b;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_checkpoint
+//
+//  Saved state of a simulation context.
+// ----------------------------------------------------------------------------
+
+class sc_checkpoint
+{
+    friend class sc_simcontext;
+
+    // pending notification of an event
+    struct notification
+    {
+        std::string   event;
+        sc_dt::uint64 time;   // in time resolution units.
+    };
+
+    typedef std::map<std::string, std::string>   state_map;
+    typedef std::map<std::string, sc_dt::uint64> time_map;
+
+    // process state flags
+    enum {
+        busy       = 'B',     // thread suspended within its function.
+        disabled   = 'D',
+        ready      = 'R',     // runnable or ready to run if resumed.
+        suspended  = 'S',
+        terminated = 'T',
+        triggered  = 'W'      // waiting on dynamic sensitivity to events.
+    };
+
+public:
+
+    // time of the checkpoint, in time resolution units
+    sc_dt::uint64 time() const { return m_time; }
+
+private:
+
+    sc_checkpoint();
+    ~sc_checkpoint();
+
+    // add the state of a process
+    void save_process( const sc_process_b* );
+
+    // check a state flag of a process, false if the process is unknown
+    bool process_flag( const sc_process_b*, char flag ) const;
+
+    // get the time of the pending timeout of a process, false if none
+    bool process_timeout( const sc_process_b*, sc_dt::uint64& time ) const;
+
+    // check whether a process is to run in the initialization phase
+    bool initialize( const sc_process_b* ) const;
+
+    // add the state of the modules and primitive channels of a hierarchy,
+    // collecting the names of the ones whose state cannot be saved
+    void save_objects( const std::vector<sc_object*>&,
+                       std::vector<std::string>& unsaved );
+
+    // restore the state of the modules and primitive channels
+    void restore_objects() const;
+
+    bool write( std::ostream& ) const;
+    bool read( std::istream& );
+
+private:
+    double                     m_resolution;  // in femto seconds.
+    sc_dt::uint64              m_time;        // in time resolution units.
+    sc_dt::uint64              m_delta_count;
+    sc_dt::uint64              m_delta_count_at_time; // at start of m_time.
+    sc_dt::uint64              m_change_stamp;
+    std::vector<notification>  m_timed;
+    std::vector<std::string>   m_delta;       // delta notified events.
+    state_map                  m_processes;   // state flags by name.
+    time_map                   m_timeouts;    // pending timeouts by name.
+    state_map                  m_objects;     // saved state by name.
+
+private:
+    // disabled
+    sc_checkpoint( const sc_checkpoint& );
+    sc_checkpoint& operator = ( const sc_checkpoint& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_CHECKPOINT_H_INCLUDED_
+// Taf!
@@ -90,6 +90,14 @@
 #  define SC_UNLIKELY_( x )  __builtin_expect( !!(x), 0 )
 #endif
 
+// helper macro to fetch data into the cache ahead of its use
+
+#ifndef __GNUC__
+#  define SC_PREFETCH_( p )  ((void)0)
+#else
+#  define SC_PREFETCH_( p )  __builtin_prefetch( p )
+#endif
+
 // ----------------------------------------------------------------------------
 // C++ standard
 //
@@ -184,6 +192,15 @@
 
 #endif // SC_WIN_DLL
 
+// thread-local storage, for POD variables with constant initializers
+#if defined(__GNUC__)
+# define SC_THREAD_LOCAL_ __thread
+#elif defined(_MSC_VER)
+# define SC_THREAD_LOCAL_ __declspec(thread)
+#else
+# define SC_THREAD_LOCAL_ thread_local
+#endif
+
 #if defined(SC_BUILD) && defined(_MSC_VER)
 // always instantiate during Windows library build
 # define SC_API_TEMPLATE_DECL_ template class SC_API
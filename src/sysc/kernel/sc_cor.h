@@ -69,6 +69,12 @@ public:
     // switch stack protection on/off
     virtual void stack_protect( bool /* enable */ ) {}
 
+    // fill the unused part of the stack with a pattern
+    virtual void stack_paint() {}
+
+    // peak stack usage since stack_paint() in bytes, 0 if unknown
+    virtual std::size_t stack_usage() const { return 0; }
+
 private:
 
     // disabled
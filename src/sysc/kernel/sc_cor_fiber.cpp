@@ -47,16 +47,22 @@ namespace sc_core {
 
 // ----------------------------------------------------------------------------
 //  File static variables.
+//
+//  Each host thread runs the coroutines of its own simulation contexts.
 // ----------------------------------------------------------------------------
 
 // main coroutine
 
-static sc_cor_fiber main_cor;
+static SC_THREAD_LOCAL_ sc_cor_fiber* main_cor = 0;
 #if defined(__GNUC__) && __USING_SJLJ_EXCEPTIONS__
 // current coroutine
-static sc_cor_fiber* curr_cor;
+static SC_THREAD_LOCAL_ sc_cor_fiber* curr_cor = 0;
 #endif
 
+// number of coroutine packages
+
+static SC_THREAD_LOCAL_ int instance_count = 0;
+
 
 // ----------------------------------------------------------------------------
 //  CLASS : sc_cor_fiber
@@ -82,9 +88,6 @@ sc_cor_fiber::~sc_cor_fiber()
 //  Coroutine package class implemented with QuickThreads.
 // ----------------------------------------------------------------------------
 
-int sc_cor_pkg_fiber::instance_count = 0;
-
-
 // constructor
 
 sc_cor_pkg_fiber::sc_cor_pkg_fiber( sc_simcontext* simc )
@@ -92,22 +95,23 @@ sc_cor_pkg_fiber::sc_cor_pkg_fiber( sc_simcontext* simc )
 {
     if( ++ instance_count == 1 ) {
         // initialize the main coroutine
-        sc_assert( main_cor.m_fiber == 0 );
-        main_cor.m_fiber = ConvertThreadToFiber( 0 );
-        main_cor.m_pkg = this;
+        sc_assert( main_cor == 0 );
+        main_cor = new sc_cor_fiber;
+        main_cor->m_fiber = ConvertThreadToFiber( 0 );
+        main_cor->m_pkg = this;
 
-        if( !main_cor.m_fiber && GetLastError() == ERROR_ALREADY_FIBER ) {
+        if( !main_cor->m_fiber && GetLastError() == ERROR_ALREADY_FIBER ) {
             // conversion of current thread to fiber has failed, because
             // someone else already converted the main thread to a fiber
             // -> store current fiber
-            main_cor.m_fiber = GetCurrentFiber();
+            main_cor->m_fiber = GetCurrentFiber();
         }
-        sc_assert( main_cor.m_fiber != 0 );
+        sc_assert( main_cor->m_fiber != 0 );
 
 #       if defined(__GNUC__) && __USING_SJLJ_EXCEPTIONS__
             // initialize the current coroutine
             sc_assert( curr_cor == 0 );
-            curr_cor = &main_cor;
+            curr_cor = main_cor;
 #       endif
     }
 }
@@ -119,8 +123,10 @@ sc_cor_pkg_fiber::~sc_cor_pkg_fiber()
 {
     if( -- instance_count == 0 ) {
         // cleanup the main coroutine
-        main_cor.m_fiber = 0;
-        main_cor.m_pkg = 0;
+        main_cor->m_fiber = 0;
+        main_cor->m_pkg = 0;
+        delete main_cor;
+        main_cor = 0;
 #       if defined(__GNUC__) && __USING_SJLJ_EXCEPTIONS__
             // cleanup the current coroutine
             curr_cor = 0;
@@ -180,7 +186,7 @@ sc_cor_pkg_fiber::abort( sc_cor* next_cor )
 sc_cor*
 sc_cor_pkg_fiber::get_main()
 {
-    return &main_cor;
+    return main_cor;
 }
 
 } // namespace sc_core
@@ -123,10 +123,6 @@ class SC_API sc_cor_pkg_fiber
     // get the main coroutine
     virtual sc_cor* get_main();
 
-private:
-
-    static int instance_count;
-
 private:
 
     // disabled
@@ -51,16 +51,20 @@ namespace sc_core {
 // ----------------------------------------------------------------------------
 //  File static variables.
 //
-// (1) The thread creation mutex and the creation condition are used to
-//     suspend the thread creating another one until the created thread
-//     reaches its invoke_module_method. This allows us to get control of
-//     thread scheduling away from the pthread package.
+// (1) The thread creation mutex and the creation condition of each
+//     coroutine package are used to suspend the thread creating another
+//     one until the created thread reaches its invoke_module_method. This
+//     allows us to get control of thread scheduling away from the pthread
+//     package.
+// (2) Each host thread running a simulation has a main coroutine of its
+//     own, shared by the coroutine packages created on that thread. Each
+//     coroutine runs on a pthread of its own, which only sees itself as
+//     the active coroutine.
 // ----------------------------------------------------------------------------
 
-static sc_cor_pthread* active_cor_p=0;   // Active co-routine.
-static pthread_cond_t  create_condition; // See note 1 above.
-static pthread_mutex_t create_mutex;     // See note 1 above.
-static sc_cor_pthread  main_cor;         // Main coroutine.
+static SC_THREAD_LOCAL_ sc_cor_pthread* active_cor_p=0;   // Active co-routine.
+static SC_THREAD_LOCAL_ sc_cor_pthread* main_cor_p=0;     // See note 2 above.
+static SC_THREAD_LOCAL_ int             instance_count=0; // Packages of thread.
 
 
 // ----------------------------------------------------------------------------
@@ -110,17 +114,22 @@ void* sc_cor_pthread::invoke_module_method(void* context_p)
     // up the main thread which is waiting for this thread to execute to this
     // wait point.
 
-    pthread_mutex_lock( &create_mutex );
+    sc_cor_pkg_pthread* pkg_p = p->m_pkg_p;
+    pthread_mutex_lock( &pkg_p->m_create_mutex );
 	DEBUGF << p << ": child signalling main thread " << endl;
-    pthread_cond_signal( &create_condition );
+    pthread_cond_signal( &pkg_p->m_create_condition );
     pthread_mutex_lock( &p->m_mutex );
-    pthread_mutex_unlock( &create_mutex );
+    pthread_mutex_unlock( &pkg_p->m_create_mutex );
     pthread_cond_wait( &p->m_pt_condition, &p->m_mutex );
     pthread_mutex_unlock( &p->m_mutex );
 
 
     // CALL THE SYSTEMC CODE THAT WILL ACTUALLY START THE THREAD OFF:
+    //
+    // The thread acts on behalf of the host thread running the simulation.
 
+    sc_set_curr_simcontext( pkg_p->simcontext() );
+    sc_report_handler::set_thread_state( pkg_p->m_report_state_p );
     active_cor_p = p;
     DEBUGF << p << ": about to invoke real method " 
 	   << active_cor_p << std::endl;
@@ -136,24 +145,26 @@ void* sc_cor_pthread::invoke_module_method(void* context_p)
 //  Coroutine package class implemented with Posix Threads.
 // ----------------------------------------------------------------------------
 
-int sc_cor_pkg_pthread::instance_count = 0;
-
 
 // constructor
 
 sc_cor_pkg_pthread::sc_cor_pkg_pthread( sc_simcontext* simc )
-: sc_cor_pkg( simc )
+: sc_cor_pkg( simc ), m_main_cor_p( 0 )
+, m_report_state_p( sc_report_handler::get_thread_state() )
 {
+    pthread_cond_init( &m_create_condition, PTHREAD_NULL );
+    pthread_mutex_init( &m_create_mutex, PTHREAD_NULL );
+
     // initialize the current coroutine
     if( ++ instance_count == 1 )
     {
-        pthread_cond_init( &create_condition, PTHREAD_NULL );
-        pthread_mutex_init( &create_mutex, PTHREAD_NULL );
         sc_assert( active_cor_p == 0 );
-        main_cor.m_pkg_p = this;
-		DEBUGF << &main_cor << ": is main co-routine" << std::endl;
-        active_cor_p = &main_cor;
+        main_cor_p = new sc_cor_pthread;
+        main_cor_p->m_pkg_p = this;
+		DEBUGF << main_cor_p << ": is main co-routine" << std::endl;
+        active_cor_p = main_cor_p;
     }
+    m_main_cor_p = main_cor_p;
 }
 
 
@@ -163,7 +174,12 @@ sc_cor_pkg_pthread::~sc_cor_pkg_pthread()
 {
     if( -- instance_count == 0 ) {
         // cleanup the main coroutine
+        active_cor_p = 0;
+        delete main_cor_p;
+        main_cor_p = 0;
     }
+    pthread_cond_destroy( &m_create_condition );
+    pthread_mutex_destroy( &m_create_mutex );
 }
 
 
@@ -173,7 +189,7 @@ sc_cor*
 sc_cor_pkg_pthread::create( std::size_t stack_size, sc_cor_fn* fn, void* arg )
 {
     sc_cor_pthread* cor_p = new sc_cor_pthread;
-    DEBUGF << &main_cor << ": sc_cor_pkg_pthread::create(" 
+    DEBUGF << m_main_cor_p << ": sc_cor_pkg_pthread::create(" 
 	       << cor_p << ")" << std::endl;
 
 
@@ -210,8 +226,8 @@ sc_cor_pkg_pthread::create( std::size_t stack_size, sc_cor_fn* fn, void* arg )
     // This scheme results in the newly created thread being dormant before
     // the main thread continues execution.
 
-    pthread_mutex_lock( &create_mutex );
-    DEBUGF << &main_cor << ": about to create actual thread " 
+    pthread_mutex_lock( &m_create_mutex );
+    DEBUGF << m_main_cor_p << ": about to create actual thread " 
 	       << cor_p << std::endl;
     if ( pthread_create( &cor_p->m_thread, &attr,
              &sc_cor_pthread::invoke_module_method, (void*)cor_p ) )
@@ -219,14 +235,14 @@ sc_cor_pkg_pthread::create( std::size_t stack_size, sc_cor_fn* fn, void* arg )
         std::fprintf(stderr, "ERROR - could not create thread\n");
     }
 
-    DEBUGF << &main_cor << ": main thread waiting for signal from " 
+    DEBUGF << m_main_cor_p << ": main thread waiting for signal from " 
 	       << cor_p << std::endl;
-    pthread_cond_wait( &create_condition, &create_mutex );
-	DEBUGF << &main_cor << ": main thread signaled by " 
+    pthread_cond_wait( &m_create_condition, &m_create_mutex );
+	DEBUGF << m_main_cor_p << ": main thread signaled by " 
 	       << cor_p << endl;
 	pthread_attr_destroy( &attr ); 
-    pthread_mutex_unlock( &create_mutex );
-    DEBUGF << &main_cor << ": exiting sc_cor_pkg_pthread::create(" 
+    pthread_mutex_unlock( &m_create_mutex );
+    DEBUGF << m_main_cor_p << ": exiting sc_cor_pkg_pthread::create(" 
 	       << cor_p << ")" << std::endl;
 
     return cor_p;
@@ -279,7 +295,7 @@ sc_cor_pkg_pthread::abort( sc_cor* next_cor_p )
 sc_cor*
 sc_cor_pkg_pthread::get_main()
 {
-    return &main_cor;
+    return m_main_cor_p;
 }
 
 } // namespace sc_core
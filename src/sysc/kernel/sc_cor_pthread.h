@@ -35,6 +35,7 @@
 
 #include "sysc/kernel/sc_cor.h"
 #include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/utils/sc_report.h"
 #include <pthread.h>
 
 namespace sc_core {
@@ -117,7 +118,13 @@ public:
 
 private:
 
-    static int instance_count;
+    friend class sc_cor_pthread;
+
+    pthread_cond_t  m_create_condition; // See note 1 of sc_cor_pthread.
+    pthread_mutex_t m_create_mutex;     // See note 1 of sc_cor_pthread.
+    sc_cor_pthread* m_main_cor_p;       // Main coroutine of the host thread.
+    sc_report_handler::thread_state*
+                    m_report_state_p;   // Report state of the host thread.
 
 private:
 
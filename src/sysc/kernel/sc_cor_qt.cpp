@@ -38,21 +38,28 @@
 
 #include "sysc/kernel/sc_cor_qt.h"
 #include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_stack_pool.h"
 #include "sysc/utils/sc_report.h"
 
 namespace sc_core {
 
 // ----------------------------------------------------------------------------
 //  File static variables.
+//
+//  Each host thread runs the coroutines of its own simulation contexts.
 // ----------------------------------------------------------------------------
 
 // main coroutine
 
-static sc_cor_qt main_cor;
+static SC_THREAD_LOCAL_ sc_cor_qt* main_cor = 0;
 
 // current coroutine
 
-static sc_cor_qt* curr_cor = 0;
+static SC_THREAD_LOCAL_ sc_cor_qt* curr_cor = 0;
+
+// number of coroutine packages
+
+static SC_THREAD_LOCAL_ int instance_count = 0;
 
 // ----------------------------------------------------------------------------
 
@@ -72,29 +79,40 @@ static std::size_t sc_pagesize()
     return pagesize;
 }
 
-// ----------------------------------------------------------------------------
-//  CLASS : sc_cor_qt
-//
-//  Coroutine class implemented with QuickThreads.
-// ----------------------------------------------------------------------------
+// align allocated stack memory
 
-sc_cor_qt::~sc_cor_qt()
+static inline void*
+stack_align( void* buf, std::size_t* stack_size )
 {
-    std::free( m_stack );
+#ifdef SC_HAVE_POSIX_MEMALIGN
+    (void)stack_size;
+    return buf;
+#else
+    const std::size_t alignment     = sc_pagesize();
+    const std::size_t round_up_mask = alignment - 1;
+    std::size_t sp_addr = reinterpret_cast<std::size_t>( buf );
+    if( sp_addr & round_up_mask ) // misaligned allocation
+    {
+        sc_assert( *stack_size > (alignment * 2) );
+        sp_addr = (sp_addr + round_up_mask) & ~round_up_mask;
+        *stack_size -= alignment;
+    }
+    return reinterpret_cast<void*>( sp_addr );
+#endif
 }
 
-// switch stack protection on/off
+// switch the protection of the red zone of a stack on/off
 
-void
-sc_cor_qt::stack_protect( bool enable )
+static void
+stack_redzone_protect( void* buf, std::size_t stack_size, bool enable )
 {
     // Code needs to be tested on HP-UX and disabled if it doesn't work there
     // Code still needs to be ported to WIN32
 
     const std::size_t pagesize = sc_pagesize();
-    sc_assert( m_stack_size > ( 2 * pagesize ) );
+    sc_assert( stack_size > ( 2 * pagesize ) );
 
-    std::size_t sp_addr = reinterpret_cast<std::size_t>(m_stack);
+    std::size_t sp_addr = reinterpret_cast<std::size_t>( buf );
 #ifndef SC_HAVE_POSIX_MEMALIGN
     const std::size_t round_up_mask = pagesize - 1;
     if( sp_addr & round_up_mask ) { // misaligned allocation
@@ -107,7 +125,7 @@ sc_cor_qt::stack_protect( bool enable )
     caddr_t redzone = caddr_t( sp_addr );
 #else
     // Stacks grow from low address up to high address
-    caddr_t redzone = caddr_t( sp_addr + m_stack_size - pagesize );
+    caddr_t redzone = caddr_t( sp_addr + stack_size - pagesize );
 #endif
 
     int ret;
@@ -145,6 +163,90 @@ sc_cor_qt::stack_protect( bool enable )
     }
 }
 
+// free a stack of the stack pool, its red zone is protected
+
+static void
+stack_free( void* buf, std::size_t pool_size )
+{
+    std::size_t stack_size = pool_size;
+    stack_align( buf, &stack_size );
+    stack_redzone_protect( buf, stack_size, false );
+    std::free( buf );
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_cor_qt
+//
+//  Coroutine class implemented with QuickThreads.
+// ----------------------------------------------------------------------------
+
+// The stack is returned to the stack pool with its red zone still
+// protected, so that it can be reused without any system call.
+
+sc_cor_qt::~sc_cor_qt()
+{
+    if( m_stack == 0 )
+        return;
+
+    if( m_protected &&
+        sc_stack_pool::instance().release( m_stack, m_pool_size ) )
+        return;
+
+    stack_protect( false );
+    std::free( m_stack );
+    sc_stack_pool::instance().freed();
+}
+
+// switch stack protection on/off
+
+void
+sc_cor_qt::stack_protect( bool enable )
+{
+    if( enable == m_protected )
+        return;
+
+    stack_redzone_protect( m_stack, m_stack_size, enable );
+    m_protected = enable;
+}
+
+// The stack is painted between the red zone and the initial stack pointer,
+// before the coroutine runs for the first time. The peak usage is the part
+// of the stack above the lowest overwritten byte. Stacks growing up are
+// not measured.
+
+static const unsigned char stack_paint_pattern = 0xa5;
+
+void
+sc_cor_qt::stack_paint()
+{
+#ifdef QUICKTHREADS_GROW_DOWN
+    std::size_t stack_size = m_pool_size;
+    char* base = static_cast<char*>( stack_align( m_stack, &stack_size ) );
+    char* low  = base + sc_pagesize();
+    char* high = reinterpret_cast<char*>( m_sp );
+    if( high > low ) {
+        std::memset( low, stack_paint_pattern, high - low );
+        m_painted = true;
+    }
+#endif
+}
+
+std::size_t
+sc_cor_qt::stack_usage() const
+{
+    if( !m_painted )
+        return 0;
+
+    std::size_t stack_size = m_pool_size;
+    const unsigned char* base = static_cast<const unsigned char*>(
+      stack_align( m_stack, &stack_size ) );
+    const unsigned char* end = base + stack_size;
+    const unsigned char* p   = base + sc_pagesize();
+    while( p < end && *p == stack_paint_pattern )
+        ++p;
+    return end - p;
+}
+
 
 // ----------------------------------------------------------------------------
 //  CLASS : sc_cor_pkg_qt
@@ -152,37 +254,34 @@ sc_cor_qt::stack_protect( bool enable )
 //  Coroutine package class implemented with QuickThreads.
 // ----------------------------------------------------------------------------
 
-int sc_cor_pkg_qt::instance_count = 0;
-
 // support functions
 
-// allocate aligned stack memory
-static inline void*
-stack_alloc( void** buf, std::size_t* stack_size )
+// round up a stack size to a multiple of the page size
+
+static inline std::size_t
+stack_round_up( std::size_t stack_size )
 {
     const std::size_t alignment     = sc_pagesize();
     const std::size_t round_up_mask = alignment - 1;
     sc_assert( 0 == ( alignment & round_up_mask ) ); // power of 2
-    sc_assert( buf );
 
-    // round up to multiple of alignment
-    *stack_size = (*stack_size + round_up_mask) & ~round_up_mask;
+    return (stack_size + round_up_mask) & ~round_up_mask;
+}
+
+// allocate aligned stack memory
+static inline void*
+stack_alloc( void** buf, std::size_t* stack_size )
+{
+    sc_assert( buf );
 
 #ifdef SC_HAVE_POSIX_MEMALIGN
-    if( 0 != posix_memalign( buf, alignment, *stack_size ) ) {
+    if( 0 != posix_memalign( buf, sc_pagesize(), *stack_size ) ) {
         *buf = NULL; // allocation failed
     }
     return *buf;
 #else
     *buf = std::malloc( *stack_size );
-    std::size_t sp_addr = reinterpret_cast<std::size_t>( *buf );
-    if( sp_addr & round_up_mask ) // misaligned allocation
-    {
-        sc_assert( *stack_size > (alignment * 2) );
-        sp_addr = (sp_addr + round_up_mask) & ~round_up_mask;
-        *stack_size -= alignment;
-    }
-    return reinterpret_cast<void*>( sp_addr );
+    return stack_align( *buf, stack_size );
 #endif
 }
 
@@ -194,7 +293,9 @@ sc_cor_pkg_qt::sc_cor_pkg_qt( sc_simcontext* simc )
     if( ++ instance_count == 1 ) {
 	// initialize the current coroutine
 	sc_assert( curr_cor == 0 );
-	curr_cor = &main_cor;
+	main_cor = new sc_cor_qt;
+	curr_cor = main_cor;
+	sc_stack_pool::instance().set_free_function( &stack_free );
     }
 }
 
@@ -206,6 +307,8 @@ sc_cor_pkg_qt::~sc_cor_pkg_qt()
     if( -- instance_count == 0 ) {
 	// cleanup the current coroutine
 	curr_cor = 0;
+	delete main_cor;
+	main_cor = 0;
     }
 }
 
@@ -227,14 +330,28 @@ sc_cor_pkg_qt::create( std::size_t stack_size, sc_cor_fn* fn, void* arg )
 {
     sc_cor_qt* cor = new sc_cor_qt();
     cor->m_pkg = this;
-    cor->m_stack_size = stack_size;
+    cor->m_pool_size = stack_round_up( stack_size );
+    cor->m_stack_size = cor->m_pool_size;
 
-    void* aligned_sp = stack_alloc( &cor->m_stack, &cor->m_stack_size );
-    if( aligned_sp == NULL )
+    // reuse a stack of a deleted coroutine, its red zone is protected
+
+    void* aligned_sp;
+    cor->m_stack = sc_stack_pool::instance().acquire( cor->m_pool_size );
+    if( cor->m_stack != NULL )
+    {
+        aligned_sp = stack_align( cor->m_stack, &cor->m_stack_size );
+        cor->m_protected = true;
+    }
+    else
     {
-        SC_REPORT_ERROR( SC_ID_STACK_SETUP_FAILED_
-                       , "failed to allocate stack memory" );
-        sc_abort();
+        aligned_sp = stack_alloc( &cor->m_stack, &cor->m_stack_size );
+        if( aligned_sp == NULL )
+        {
+            SC_REPORT_ERROR( SC_ID_STACK_SETUP_FAILED_
+                           , "failed to allocate stack memory" );
+            sc_abort();
+        }
+        sc_stack_pool::instance().allocated();
     }
     cor->m_sp = QUICKTHREADS_SP( aligned_sp, cor->m_stack_size );
     cor->m_sp = QUICKTHREADS_ARGS( cor->m_sp, arg, cor, (qt_userf_t*) fn,
@@ -287,7 +404,7 @@ sc_cor_pkg_qt::abort( sc_cor* next_cor )
 sc_cor*
 sc_cor_pkg_qt::get_main()
 {
-    return &main_cor;
+    return main_cor;
 }
 
 } // namespace sc_core
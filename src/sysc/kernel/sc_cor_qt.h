@@ -54,7 +54,8 @@ public:
 
     // constructor
     sc_cor_qt()
-	: m_stack_size( 0 ), m_stack( 0 ), m_sp( 0 ), m_pkg( 0 )
+	: m_stack_size( 0 ), m_stack( 0 ), m_pool_size( 0 ), m_protected( false )
+	, m_painted( false ), m_sp( 0 ), m_pkg( 0 )
 	{}
 
     // destructor
@@ -63,10 +64,19 @@ public:
     // switch stack protection on/off
     virtual void stack_protect( bool enable );
 
+    // fill the unused part of the stack with a pattern
+    virtual void stack_paint();
+
+    // peak stack usage since stack_paint()
+    virtual std::size_t stack_usage() const;
+
 public:
 
     std::size_t    m_stack_size;  // stack size
     void*          m_stack;       // stack
+    std::size_t    m_pool_size;   // size class in the stack pool
+    bool           m_protected;   // red zone of the stack is protected
+    bool           m_painted;     // unused stack is filled with a pattern
     qt_t*          m_sp;          // stack pointer
 
     sc_cor_pkg_qt* m_pkg;         // the creating coroutine package
@@ -108,10 +118,6 @@ public:
     // get the main coroutine
     virtual sc_cor* get_main();
 
-private:
-
-    static int instance_count;
-
 private:
 
     // disabled
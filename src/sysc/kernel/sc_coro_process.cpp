@@ -0,0 +1,174 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_coro_process.cpp -- Thread-like processes based on C++20 coroutines.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_coro_process.h"
+
+#if defined(SC_HAS_COROUTINES_)
+
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/kernel/sc_wait.h"
+
+#include <sstream>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_co_wait
+// ----------------------------------------------------------------------------
+
+sc_co_wait::sc_co_wait( int n )
+  : m_kind( STATIC ), m_n( n ), m_event_p( 0 ), m_time()
+{
+    if( n <= 0 ) {
+        std::stringstream msg;
+        msg << "n = " << n;
+        SC_REPORT_ERROR( SC_ID_WAIT_N_INVALID_, msg.str().c_str() );
+        m_n = 1;
+    }
+}
+
+void
+sc_co_wait::arm( int& wait_n ) const
+{
+    switch( m_kind ) {
+      case STATIC:
+        next_trigger();
+        wait_n = m_n - 1;
+        break;
+      case EVENT:
+        next_trigger( *static_cast<const sc_event*>( m_event_p ) );
+        break;
+      case OR_LIST:
+        next_trigger( *static_cast<const sc_event_or_list*>( m_event_p ) );
+        break;
+      case AND_LIST:
+        next_trigger( *static_cast<const sc_event_and_list*>( m_event_p ) );
+        break;
+      case TIME:
+        next_trigger( m_time );
+        break;
+      case TIME_EVENT:
+        next_trigger( m_time, *static_cast<const sc_event*>( m_event_p ) );
+        break;
+      case TIME_OR_LIST:
+        next_trigger( m_time,
+                      *static_cast<const sc_event_or_list*>( m_event_p ) );
+        break;
+      case TIME_AND_LIST:
+        next_trigger( m_time,
+                      *static_cast<const sc_event_and_list*>( m_event_p ) );
+        break;
+    }
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coro_process_host
+// ----------------------------------------------------------------------------
+
+sc_coro_process_host::sc_coro_process_host()
+  : m_handle(), m_started( false )
+{}
+
+sc_coro_process_host::~sc_coro_process_host()
+{
+    if( m_handle )
+        m_handle.destroy();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_coro_process_host::semantics"
+// |
+// | This method is executed whenever the coroutine process is triggered. It
+// | creates the coroutine on the first execution and resumes it afterwards,
+// | unless the coroutine waits for further static triggers. When the
+// | coroutine has finished, its frame is destroyed and the process is
+// | terminated, like a thread process returning from its function. An
+// | exception thrown by the coroutine is passed on to the kernel.
+// +----------------------------------------------------------------------------
+void
+sc_coro_process_host::semantics()
+{
+    if( !m_started ) {
+        m_handle = create().release();
+        m_started = true;
+    }
+    else if( !m_handle ) {
+        return;
+    }
+    else if( m_handle.promise().m_wait_n > 0 ) {
+        m_handle.promise().m_wait_n--;
+        return;
+    }
+
+    m_handle.resume();
+    if( !m_handle.done() )
+        return;
+
+    std::exception_ptr exception = m_handle.promise().m_exception;
+    m_handle.destroy();
+    m_handle = nullptr;
+    if( exception )
+        std::rethrow_exception( exception );
+    sc_get_current_process_handle().kill();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_create_coro_process"
+// |
+// | This function creates the method process executing a coroutine process.
+// | The spawn options define its static sensitivity and whether it is
+// | initialized.
+// |
+// | Arguments:
+// |     name_p -> name of the process, or zero.
+// |     host_p -> host of the coroutine, deleted with the process.
+// |     opt_p  -> spawn options, or zero.
+// +----------------------------------------------------------------------------
+sc_process_handle
+sc_create_coro_process( const char* name_p, sc_coro_process_host* host_p,
+                        const sc_spawn_options* opt_p )
+{
+    return sc_get_curr_simcontext()->create_method_process(
+        name_p, true, SC_MAKE_FUNC_PTR( sc_coro_process_host, semantics ),
+        host_p, opt_p );
+}
+
+} // namespace sc_core
+
+#endif // SC_HAS_COROUTINES_
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,265 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_coro_process.h -- Thread-like processes based on C++20 coroutines.
+
+  A coroutine process is written like a thread process, but its body is a
+  C++20 coroutine returning sc_coro_thread, which suspends itself with
+  co_await sc_co_wait(...) instead of calling wait(...). The coroutine
+  frame is allocated on the heap and holds only the variables living
+  across a suspension, so no stack and no context switch of sc_cor_qt are
+  needed. The process is executed by the kernel like a method process:
+  each co_await sets the next trigger of the process, and the coroutine
+  is resumed when the process is triggered.
+
+  Coroutine processes are created with SC_CORO_THREAD in a module, or with
+  sc_spawn for a function object returning sc_coro_thread, in which case
+  the sc_spawn_options define the static sensitivity and initialization.
+  A reset of a coroutine process does not restart its coroutine. When the
+  process is killed, its coroutine frame is destroyed with the process.
+
+  Only available if the library and the application are compiled with
+  C++20 coroutine support, in which case SC_HAS_COROUTINES_ is defined.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_CORO_PROCESS_H_INCLUDED_
+#define SC_CORO_PROCESS_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#if SC_CPLUSPLUS >= 202002L && defined(__cpp_impl_coroutine)
+#  define SC_HAS_COROUTINES_ 1
+#endif
+
+#if defined(SC_HAS_COROUTINES_)
+
+#include "sysc/kernel/sc_process.h"
+#include "sysc/kernel/sc_process_handle.h"
+#include "sysc/kernel/sc_time.h"
+
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+
+namespace sc_core {
+
+class sc_event;
+class sc_event_and_list;
+class sc_event_or_list;
+class sc_spawn_options;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coro_thread
+//
+//  Return type of the coroutine of a coroutine process.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_coro_thread
+{
+public:
+
+    struct promise_type
+    {
+        promise_type() : m_wait_n( 0 ), m_exception() {}
+
+        sc_coro_thread get_return_object()
+            { return sc_coro_thread( handle_type::from_promise( *this ) ); }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        void return_void() {}
+        void unhandled_exception() { m_exception = std::current_exception(); }
+
+        int                m_wait_n;    // static triggers still to be skipped.
+        std::exception_ptr m_exception; // thrown by the coroutine.
+    };
+
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    sc_coro_thread( sc_coro_thread&& other ) noexcept
+      : m_handle( other.release() ) {}
+
+    ~sc_coro_thread()
+        { if ( m_handle ) m_handle.destroy(); }
+
+    // transfer the ownership of the coroutine frame
+    handle_type release() noexcept
+    {
+        handle_type handle = m_handle;
+        m_handle = nullptr;
+        return handle;
+    }
+
+private:
+    explicit sc_coro_thread( handle_type handle ) : m_handle( handle ) {}
+
+    sc_coro_thread( const sc_coro_thread& ) = delete;
+    sc_coro_thread& operator = ( const sc_coro_thread& ) = delete;
+
+private:
+    handle_type m_handle;
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_co_wait
+//
+//  Awaitable suspending a coroutine process, with the arguments of wait().
+//  Event lists are referenced, they must live until the co_await ends.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_co_wait
+{
+    enum wait_kind { STATIC, EVENT, OR_LIST, AND_LIST, TIME,
+                     TIME_EVENT, TIME_OR_LIST, TIME_AND_LIST };
+
+public:
+
+    // static sensitivity
+    sc_co_wait() : m_kind( STATIC ), m_n( 1 ), m_event_p( 0 ), m_time() {}
+
+    // static sensitivity, n times
+    explicit sc_co_wait( int n );
+
+    // dynamic sensitivity
+    sc_co_wait( const sc_event& e )
+      : m_kind( EVENT ), m_n( 0 ), m_event_p( &e ), m_time() {}
+    sc_co_wait( const sc_event_or_list& el )
+      : m_kind( OR_LIST ), m_n( 0 ), m_event_p( &el ), m_time() {}
+    sc_co_wait( const sc_event_and_list& el )
+      : m_kind( AND_LIST ), m_n( 0 ), m_event_p( &el ), m_time() {}
+    sc_co_wait( const sc_time& t )
+      : m_kind( TIME ), m_n( 0 ), m_event_p( 0 ), m_time( t ) {}
+    sc_co_wait( double v, sc_time_unit tu )
+      : m_kind( TIME ), m_n( 0 ), m_event_p( 0 ), m_time( v, tu ) {}
+    sc_co_wait( const sc_time& t, const sc_event& e )
+      : m_kind( TIME_EVENT ), m_n( 0 ), m_event_p( &e ), m_time( t ) {}
+    sc_co_wait( double v, sc_time_unit tu, const sc_event& e )
+      : m_kind( TIME_EVENT ), m_n( 0 ), m_event_p( &e ), m_time( v, tu ) {}
+    sc_co_wait( const sc_time& t, const sc_event_or_list& el )
+      : m_kind( TIME_OR_LIST ), m_n( 0 ), m_event_p( &el ), m_time( t ) {}
+    sc_co_wait( double v, sc_time_unit tu, const sc_event_or_list& el )
+      : m_kind( TIME_OR_LIST ), m_n( 0 ), m_event_p( &el ), m_time( v, tu ) {}
+    sc_co_wait( const sc_time& t, const sc_event_and_list& el )
+      : m_kind( TIME_AND_LIST ), m_n( 0 ), m_event_p( &el ), m_time( t ) {}
+    sc_co_wait( double v, sc_time_unit tu, const sc_event_and_list& el )
+      : m_kind( TIME_AND_LIST ), m_n( 0 ), m_event_p( &el ), m_time( v, tu ) {}
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend( sc_coro_thread::handle_type handle )
+        { arm( handle.promise().m_wait_n ); }
+    void await_resume() const noexcept {}
+
+private:
+
+    // set the next trigger of the current process
+    void arm( int& wait_n ) const;
+
+private:
+    wait_kind   m_kind;
+    int         m_n;
+    const void* m_event_p;  // event or event list.
+    sc_time     m_time;
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coro_process_host
+//
+//  Executes a coroutine as the semantics of a method process.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_coro_process_host : public sc_process_host
+{
+public:
+    sc_coro_process_host();
+    virtual ~sc_coro_process_host();
+
+    void semantics();
+
+protected:
+    // create the coroutine, on the first execution of the process
+    virtual sc_coro_thread create() = 0;
+
+private:
+    sc_coro_thread::handle_type m_handle;
+    bool                        m_started;
+
+private:
+    // disabled
+    sc_coro_process_host( const sc_coro_process_host& );
+    sc_coro_process_host& operator = ( const sc_coro_process_host& );
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_coro_spawn_object<T>
+//
+//  Coroutine process host calling a function object returning
+//  sc_coro_thread.
+// ----------------------------------------------------------------------------
+
+template< typename T >
+class sc_coro_spawn_object : public sc_coro_process_host
+{
+public:
+    explicit sc_coro_spawn_object( T object ) : m_object( object ) {}
+
+protected:
+    virtual sc_coro_thread create() { return m_object(); }
+
+private:
+    T m_object;
+};
+
+// create a coroutine process, the host is deleted with the process
+extern SC_API sc_process_handle
+sc_create_coro_process( const char* name_p, sc_coro_process_host* host_p,
+                        const sc_spawn_options* opt_p );
+
+// spawn a coroutine process, for function objects returning sc_coro_thread
+template< typename T >
+    requires std::is_same_v< std::invoke_result_t<T&>, sc_coro_thread >
+inline sc_process_handle
+sc_spawn( T object,
+          const char* name_p = 0,
+          const sc_spawn_options* opt_p = 0 )
+{
+    return sc_create_coro_process( name_p,
+                                   new sc_coro_spawn_object<T>( object ),
+                                   opt_p );
+}
+
+} // namespace sc_core
+
+#endif // SC_HAS_COROUTINES_
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_CORO_PROCESS_H_INCLUDED_
+// Taf!
@@ -26,11 +26,13 @@
  CHANGE LOG APPEARS AT THE END OF THE FILE
  *****************************************************************************/
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/kernel/sc_phase_callback_registry.h"
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_process_handle.h"
@@ -65,6 +67,11 @@ sc_event::basename() const
 void
 sc_event::cancel()
 {
+    if( SC_UNLIKELY_( m_simc->evaluating_in_parallel() ) ) {
+        sc_parallel_evaluator::defer( sc_parallel_evaluator::op_cancel, this );
+        return;
+    }
+
     // cancel a delta or timed notification
     switch( m_notify_type ) {
     case DELTA: {
@@ -76,7 +83,7 @@ sc_event::cancel()
     case TIMED: {
         // remove this event from the timed events set
         sc_assert( m_timed != 0 );
-        m_timed->m_event = 0;
+        m_simc->remove_timed_event( m_timed );
         m_timed = 0;
         m_notify_type = NONE;
         break;
@@ -90,6 +97,11 @@ sc_event::cancel()
 void
 sc_event::notify()
 {
+    if( SC_UNLIKELY_( m_simc->evaluating_in_parallel() ) ) {
+        sc_parallel_evaluator::defer( sc_parallel_evaluator::op_notify, this );
+        return;
+    }
+
     // immediate notification
     if( !m_simc->evaluation_phase() )
         // coming from
@@ -107,6 +119,11 @@ sc_event::notify()
 void
 sc_event::notify( const sc_time& t )
 {
+    if( SC_UNLIKELY_( m_simc->evaluating_in_parallel() ) ) {
+        sc_parallel_evaluator::defer( sc_parallel_evaluator::op_notify_time,
+                                      this, t );
+        return;
+    }
     if( m_notify_type == DELTA ) {
         return;
     }
@@ -127,7 +144,7 @@ sc_event::notify( const sc_time& t )
         if( m_notify_type == TIMED ) {
             // remove this event from the timed events set
             sc_assert( m_timed != 0 );
-            m_timed->m_event = 0;
+            m_simc->remove_timed_event( m_timed );
             m_timed = 0;
         }
         // add this event to the delta events set
@@ -154,7 +171,7 @@ sc_event::notify( const sc_time& t )
             return;
         }
         // remove this event from the timed events set
-        m_timed->m_event = 0;
+        m_simc->remove_timed_event( m_timed );
         m_timed = 0;
     }
     // add this event to the timed events set
@@ -178,6 +195,11 @@ static void sc_warn_notify_delayed()
 void
 sc_event::notify_delayed()
 {
+    if( SC_UNLIKELY_( m_simc->evaluating_in_parallel() ) ) {
+        sc_parallel_evaluator::defer(
+            sc_parallel_evaluator::op_notify_delayed, this );
+        return;
+    }
     sc_warn_notify_delayed();
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, 0 );
@@ -190,6 +212,11 @@ sc_event::notify_delayed()
 void
 sc_event::notify_delayed( const sc_time& t )
 {
+    if( SC_UNLIKELY_( m_simc->evaluating_in_parallel() ) ) {
+        sc_parallel_evaluator::defer(
+            sc_parallel_evaluator::op_notify_delayed_time, this, t );
+        return;
+    }
     sc_warn_notify_delayed();
     if( m_notify_type != NONE ) {
         SC_REPORT_ERROR( SC_ID_NOTIFY_DELAYED_, 0 );
@@ -208,6 +235,41 @@ sc_event::notify_delayed( const sc_time& t )
     }
 }
 
+// Timed notification of the timeout event of a process, which owns the
+// timer slot slot_p: the record is allocated by the first timed wait of
+// the process, and re-armed by the following ones instead of allocating
+// and inserting a new record (see sc_timing_wheel::rearm).
+
+void
+sc_event::notify_internal( const sc_time& t, sc_event_timed*& slot_p )
+{
+    if( SC_UNLIKELY_( m_simc->evaluating_in_parallel() ) ||
+        t == SC_ZERO_TIME || m_notify_type != NONE ) {
+        notify_internal( t );
+        return;
+    }
+    if( slot_p == 0 ) {
+        slot_p = new sc_event_timed( 0, SC_ZERO_TIME, true );
+    }
+    if( ! m_simc->rearm_timed_event( slot_p, this, m_simc->time_stamp() + t ) )
+    {
+        // the slot is still queued at a later time
+        notify_internal( t );
+        return;
+    }
+    m_timed = slot_p;
+    m_notify_type = TIMED;
+}
+
+// record a notification of a method executed by a parallel evaluation worker
+
+void
+sc_event::defer_notify_internal( const sc_time& t )
+{
+    sc_parallel_evaluator::defer( sc_parallel_evaluator::op_notify_internal,
+                                  this, t );
+}
+
 #define SC_KERNEL_EVENT_PREFIX "$$$$kernel_event$$$$_"
 sc_event::kernel_tag sc_event::kernel_event;
 
@@ -254,7 +316,7 @@ sc_event::register_event( const char* leaf_name, bool is_kernel_event /* = false
 
     if ( !is_kernel_event )
     {
-	object_manager->insert_event(m_name, this);
+	object_manager->insert_event(m_name.c_str(), this);
 	if ( m_parent_p )
 	    m_parent_p->add_child_event( this );
 	else
@@ -295,7 +357,8 @@ sc_event::sc_event( const char* name ) :
     m_methods_static(),
     m_methods_dynamic(),
     m_threads_static(),
-    m_threads_dynamic()
+    m_threads_dynamic(),
+    m_static_slice( 0 )
 {
     register_event( name );
 }
@@ -318,7 +381,8 @@ sc_event::sc_event() :
     m_methods_static(),
     m_methods_dynamic(),
     m_threads_static(),
-    m_threads_dynamic()
+    m_threads_dynamic(),
+    m_static_slice( 0 )
 {
     register_event( NULL );
 }
@@ -341,7 +405,8 @@ sc_event::sc_event( kernel_tag, const char* name ) :
     m_methods_static(),
     m_methods_dynamic(),
     m_threads_static(),
-    m_threads_dynamic()
+    m_threads_dynamic(),
+    m_static_slice( 0 )
 {
     register_event( name, /* is_kernel_event = */ true );
 }
@@ -359,7 +424,7 @@ sc_event::~sc_event()
     if ( m_name.length() != 0 )
     {
 	sc_object_manager* object_manager_p = m_simc->get_object_manager();
-	object_manager_p->remove_event( m_name );
+	object_manager_p->remove_event( m_name.c_str(), this );
     }
 
     for(size_t i = 0; i < m_threads_dynamic.size(); ++i ) {
@@ -389,14 +454,21 @@ sc_event::trigger()
 
     int       last_i; // index of last element in vector now accessing.
     int       size;   // size of vector now accessing.
+    int       static_methods = m_methods_static.size();
 
+    // trigger the static sensitive methods, from the sensitivity table if
+    // laid out there, in the same order as from the vector
 
-    // trigger the static sensitive methods
-
-    if( ( size = m_methods_static.size() ) != 0 )
+    if( m_static_slice )
+    {
+        sc_process_b* const* l_static = m_static_slice;
+        for( int i = 0; i < static_methods; ++i )
+            static_cast<sc_method_handle>( l_static[i] )->trigger_static();
+    }
+    else if( static_methods != 0 )
     {
         sc_method_handle* l_methods_static = &m_methods_static[0];
-        int i = size - 1;
+        int i = static_methods - 1;
         do {
             sc_method_handle method_h = l_methods_static[i];
             method_h->trigger_static();
@@ -426,7 +498,14 @@ sc_event::trigger()
 
     // trigger the static sensitive threads
 
-    if( ( size = m_threads_static.size() ) != 0 )
+    if( m_static_slice )
+    {
+        sc_process_b* const* l_static = m_static_slice + static_methods;
+        size = m_threads_static.size();
+        for( int i = 0; i < size; ++i )
+            static_cast<sc_thread_handle>( l_static[i] )->trigger_static();
+    }
+    else if( ( size = m_threads_static.size() ) != 0 )
     {
         sc_thread_handle* l_threads_static = &m_threads_static[0];
         int i = size - 1;
@@ -469,6 +548,7 @@ sc_event::remove_static( sc_method_handle method_h_ ) const
       sc_method_handle* l_methods_static = &m_methods_static[0];
       for( int i = size - 1; i >= 0; -- i ) {
           if( l_methods_static[i] == method_h_ ) {
+              m_static_slice = 0;
               l_methods_static[i] = l_methods_static[size - 1];
               m_methods_static.resize(size-1);
               return true;
@@ -486,6 +566,7 @@ sc_event::remove_static( sc_thread_handle thread_h_ ) const
       sc_thread_handle* l_threads_static = &m_threads_static[0];
       for( int i = size - 1; i >= 0; -- i ) {
           if( l_threads_static[i] == thread_h_ ) {
+              m_static_slice = 0;
               l_threads_static[i] = l_threads_static[size - 1];
               m_threads_static.resize(size-1);
               return true;
@@ -529,6 +610,35 @@ sc_event::remove_dynamic( sc_thread_handle thread_h_ ) const
     return false;
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_event::observed"
+// |
+// | This method returns true if a notification of this event would trigger
+// | a process: a process waiting on it dynamically, or a live process that
+// | is statically sensitive to it and waiting on its static sensitivity.
+// +----------------------------------------------------------------------------
+bool
+sc_event::observed() const
+{
+    if( !m_methods_dynamic.empty() || !m_threads_dynamic.empty() )
+        return true;
+    for( size_t i = 0; i < m_methods_static.size(); ++i ) {
+        sc_method_handle method_h = m_methods_static[i];
+        if( method_h->m_trigger_type == sc_process_b::STATIC &&
+            !( method_h->m_state & sc_process_b::ps_bit_disabled ) &&
+            !method_h->terminated() )
+            return true;
+    }
+    for( size_t i = 0; i < m_threads_static.size(); ++i ) {
+        sc_thread_handle thread_h = m_threads_static[i];
+        if( thread_h->m_trigger_type == sc_process_b::STATIC &&
+            !( thread_h->m_state & sc_process_b::ps_bit_disabled ) &&
+            !thread_h->terminated() )
+            return true;
+    }
+    return false;
+}
+
 
 // ----------------------------------------------------------------------------
 //  CLASS : sc_event_timed
@@ -536,7 +646,10 @@ sc_event::remove_dynamic( sc_thread_handle thread_h_ ) const
 //  Class for storing the time to notify a timed event.
 // ----------------------------------------------------------------------------
 
-// dedicated memory management; not MT-Safe
+// dedicated memory management; each host thread has a free list of its
+// own, so that simulations may run on several host threads. The records
+// have the same size everywhere, so a record may be released to the free
+// list of another thread.
 
 union sc_event_timed_u
 {
@@ -544,7 +657,7 @@ union sc_event_timed_u
     char              dummy[sizeof( sc_event_timed )];
 };
 
-static
+static SC_THREAD_LOCAL_
 sc_event_timed_u* free_list = 0;
 
 void*
@@ -577,6 +690,35 @@ sc_event_timed::deallocate( void* p )
     }
 }
 
+void
+sc_event_timed::retire( sc_event_timed* et )
+{
+    if( ! et->m_slot ) {
+        delete et;
+        return;
+    }
+    if( et->m_event != 0 ) {
+        et->m_event->m_timed = 0;
+        et->m_event = 0;
+    }
+    et->m_queued = false;
+}
+
+// a slot that is still queued is deleted when it is taken from the queue
+
+void
+sc_event_timed::delete_slot( sc_event_timed* et )
+{
+    if( et == 0 ) {
+        return;
+    }
+    if( et->m_queued ) {
+        et->m_slot = false;
+    } else {
+        delete et;
+    }
+}
+
 
 // ----------------------------------------------------------------------------
 //  CLASS : sc_event_list
@@ -588,81 +730,186 @@ void
 sc_event_list::push_back( const sc_event& e )
 {
     // make sure e is not already in the list
-    if ( m_events.size() != 0 ) {
-      const sc_event** l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          if( &e == l_events[i] ) {
-              // event already in the list; ignore
-              return;
-          }
-      }
+    const sc_event** l_events = m_events;
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        if( &e == l_events[i] ) {
+            // event already in the list; ignore
+            return;
+        }
     }
-    m_events.push_back( &e );
+    if( m_size == m_capacity ) {
+        reserve( 2 * m_capacity );
+    }
+    m_events[m_size ++] = &e;
 }
 
 void
 sc_event_list::push_back( const sc_event_list& el )
 {
-    m_events.reserve( size() + el.size() );
-    for ( int i = el.m_events.size() - 1; i >= 0; --i )
+    reserve( size() + el.size() );
+    for ( int i = el.m_size - 1; i >= 0; --i )
     {
         push_back( *el.m_events[i] );
     }
     el.auto_delete();
 }
 
+// The events are kept in the list object itself up to inline_capacity,
+// and on the heap beyond that. A temporary list that grew keeps its heap
+// storage when it is reused.
+
+void
+sc_event_list::reserve( int n )
+{
+    if( n <= m_capacity ) {
+        return;
+    }
+    const sc_event** events = new const sc_event*[n];
+    std::copy( m_events, m_events + m_size, events );
+    if( m_events != m_inline_events ) {
+        delete [] m_events;
+    }
+    m_events = events;
+    m_capacity = n;
+}
+
+void
+sc_event_list::assign( const sc_event_list& that )
+{
+    reserve( that.m_size );
+    std::copy( that.m_events, that.m_events + that.m_size, m_events );
+    m_size = that.m_size;
+}
+
+void
+sc_event_list::swap( sc_event_list& that )
+{
+    if( busy() || that.busy() )
+        report_invalid_modification();
+
+    if( m_events == m_inline_events || that.m_events == that.m_inline_events )
+    {
+        // exchange the inline events, and hand over the heap storage of
+        // the other list, if any
+        sc_event_list* inline_p = m_events == m_inline_events ? this : &that;
+        sc_event_list* other_p  = inline_p == this ? &that : this;
+        const sc_event* events[inline_capacity];
+        std::copy( inline_p->m_events, inline_p->m_events + inline_p->m_size,
+                   events );
+        if( other_p->m_events == other_p->m_inline_events ) {
+            std::copy( other_p->m_events, other_p->m_events + other_p->m_size,
+                       inline_p->m_inline_events );
+        } else {
+            inline_p->m_events = other_p->m_events;
+            other_p->m_events = other_p->m_inline_events;
+        }
+        std::copy( events, events + inline_p->m_size,
+                   other_p->m_inline_events );
+    } else {
+        std::swap( m_events, that.m_events );
+    }
+    std::swap( m_size, that.m_size );
+    std::swap( m_capacity, that.m_capacity );
+}
+
+// Temporary lists, created by event expressions like e1 | e2, live until
+// the wait on them is over. Instead of being deleted, they are kept by the
+// process that waited on them (or the process running at that time), and
+// reused by the next event expression of that process, so that a process
+// waiting on event expressions in a loop does not allocate. Outside of
+// processes they are allocated as usual.
+
+sc_event_list*
+sc_event_list::take_temporary( bool and_list_ )
+{
+    sc_process_b* proc_p =
+      sc_get_curr_simcontext()->get_curr_proc_info()->process_handle;
+    sc_event_list* list_p =
+      proc_p ? proc_p->take_spare_event_list( and_list_ ) : 0;
+    if( list_p ) {
+        list_p->clear();
+        list_p->m_waiter_p = 0;
+    }
+    return list_p;
+}
+
+void
+sc_event_list::release_temporary() const
+{
+    sc_event_list* list_p = const_cast<sc_event_list*>( this );
+    sc_process_b* proc_p = m_waiter_p ? m_waiter_p :
+      sc_get_curr_simcontext()->get_curr_proc_info()->process_handle;
+    if( ! proc_p || ! proc_p->keep_spare_event_list( list_p ) ) {
+        delete list_p;
+    }
+}
+
+sc_event_and_list*
+sc_event_and_list::new_temporary()
+{
+    sc_event_list* list_p = sc_event_list::take_temporary( true );
+    return list_p ? static_cast<sc_event_and_list*>( list_p )
+                  : new sc_event_and_list( true );
+}
+
+sc_event_or_list*
+sc_event_or_list::new_temporary()
+{
+    sc_event_list* list_p = sc_event_list::take_temporary( false );
+    return list_p ? static_cast<sc_event_or_list*>( list_p )
+                  : new sc_event_or_list( true );
+}
+
 void
 sc_event_list::add_dynamic( sc_method_handle method_h ) const
 {
     m_busy++;
-    if ( m_events.size() != 0 ) {
-      const sc_event* const * l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          l_events[i]->add_dynamic( method_h );
-      }
-  }
+    if( m_auto_delete ) {
+        m_waiter_p = method_h;
+    }
+    const sc_event* const * l_events = m_events;
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        l_events[i]->add_dynamic( method_h );
+    }
 }
 
 void
 sc_event_list::add_dynamic( sc_thread_handle thread_h ) const
 {
     m_busy++;
-    if ( m_events.size() != 0 ) {
-      const sc_event* const* l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          l_events[i]->add_dynamic( thread_h );
-      }
-  }
+    if( m_auto_delete ) {
+        m_waiter_p = thread_h;
+    }
+    const sc_event* const* l_events = m_events;
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        l_events[i]->add_dynamic( thread_h );
+    }
 }
 
 void
 sc_event_list::remove_dynamic( sc_method_handle method_h,
                                const sc_event* e_not ) const
 {
-    if ( m_events.size() != 0 ) {
-      const sc_event* const* l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          const sc_event* e = l_events[i];
-          if( e != e_not ) {
-              e->remove_dynamic( method_h );
-          }
-      }
-  }
+    const sc_event* const* l_events = m_events;
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        const sc_event* e = l_events[i];
+        if( e != e_not ) {
+            e->remove_dynamic( method_h );
+        }
+    }
 }
 
 void
 sc_event_list::remove_dynamic( sc_thread_handle thread_h,
                                const sc_event* e_not ) const
 {
-    if ( m_events.size() != 0 ) {
-      const sc_event* const* l_events = &m_events[0];
-      for( int i = m_events.size() - 1; i >= 0; -- i ) {
-          const sc_event* e = l_events[i];
-          if( e != e_not ) {
-              e->remove_dynamic( thread_h );
-          }
-      }
-  }
+    const sc_event* const* l_events = m_events;
+    for( int i = m_size - 1; i >= 0; -- i ) {
+        const sc_event* e = l_events[i];
+        if( e != e_not ) {
+            e->remove_dynamic( thread_h );
+        }
+    }
 }
 
 void
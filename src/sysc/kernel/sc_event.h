@@ -49,6 +49,8 @@ class sc_event_list;
 class sc_event_or_list;
 class sc_event_and_list;
 class sc_object;
+class sc_process_b;
+class sc_signal_bank_base;
 class sc_signal_channel;
 
 // friend function declarations
@@ -70,7 +72,7 @@ class sc_event_expr
     typedef T type;
 
     inline sc_event_expr()
-       : m_expr( new T(true) )
+       : m_expr( T::new_temporary() )
     {}
 
 public:
@@ -107,7 +109,8 @@ public:
 
     ~sc_event_expr()
     {
-        delete m_expr;
+        if( m_expr )
+            m_expr->auto_delete();
     }
 
 private:
@@ -125,6 +128,7 @@ private:
 
 class SC_API sc_event_list
 {
+    friend class sc_parallel_evaluator;
     friend class sc_process_b;
     friend class sc_method_process;
     friend class sc_thread_process;
@@ -166,15 +170,33 @@ protected:
     bool temporary()   const;
     void auto_delete() const;
 
+    // temporary lists are kept by the current process for reuse
+    static sc_event_list* take_temporary( bool and_list_ );
+    void release_temporary() const;
+
     void report_premature_destruction() const;
     void report_invalid_modification()  const;
 
 private:
 
-    std::vector<const sc_event*> m_events;
+    void reserve( int n );
+    void assign( const sc_event_list& );
+    void clear()
+      { m_size = 0; }
+
+private:
+
+    // events stored in the list itself, no allocation below this size
+    enum { inline_capacity = 4 };
+
+    const sc_event**             m_events;    // m_inline_events or heap.
+    int                          m_size;
+    int                          m_capacity;
+    const sc_event*              m_inline_events[inline_capacity];
     bool                         m_and_list;
     bool                         m_auto_delete;
     mutable unsigned             m_busy;
+    mutable sc_process_b*        m_waiter_p;  // waiting on a temporary.
 };
 
 
@@ -189,6 +211,8 @@ class SC_API sc_event_and_list
 {
     friend class sc_event;
     friend class sc_event_expr<sc_event_and_list>;
+    friend class sc_event_list;
+    friend class sc_parallel_evaluator;
     friend class sc_process_b;
     friend class sc_method_process;
     friend class sc_thread_process;
@@ -198,6 +222,9 @@ protected:
     explicit
     sc_event_and_list( bool auto_delete_ );
 
+    // new or reused list, deleted by auto_delete()
+    static sc_event_and_list* new_temporary();
+
 public:
 
     sc_event_and_list();
@@ -224,6 +251,8 @@ class SC_API sc_event_or_list
 {
     friend class sc_event;
     friend class sc_event_expr<sc_event_or_list>;
+    friend class sc_event_list;
+    friend class sc_parallel_evaluator;
     friend class sc_process_b;
     friend class sc_method_process;
     friend class sc_thread_process;
@@ -233,6 +262,9 @@ protected:
     explicit
     sc_event_or_list( bool auto_delete_ );
 
+    // new or reused list, deleted by auto_delete()
+    static sc_event_or_list* new_temporary();
+
 public:
     sc_event_or_list();
     sc_event_or_list( const sc_event& );
@@ -253,10 +285,14 @@ typedef sc_event_expr<sc_event_or_list> sc_event_or_expr;
 
 class SC_API sc_event
 {
+    friend class sc_checkpoint;
     friend class sc_event_list;
     friend class sc_event_timed;
     friend class sc_simcontext;
     friend class sc_object;
+    friend class sc_method_levelizer;
+    friend class sc_parallel_evaluator;
+    friend class sc_sensitivity_table;
     friend class sc_process_b;
     friend class sc_process_handle;
     friend class sc_method_process;
@@ -264,8 +300,13 @@ class SC_API sc_event
     friend void sc_thread_cor_fn( void* arg );
     friend class sc_clock;
     friend class sc_event_queue;
+    friend class sc_signal_bank_base;
     friend class sc_signal_channel;
     template<typename IF> friend class sc_fifo;
+    template<typename IF> friend class sc_async_fifo;
+    friend class sc_pdes_inbox_base;
+    friend class sc_pdes_outbox_base;
+    friend class sc_shm_channel_base;
     friend class sc_semaphore;
     friend class sc_mutex;
     friend class sc_join;
@@ -311,13 +352,18 @@ private:
     void add_dynamic( sc_thread_handle ) const;
 
     void notify_internal( const sc_time& );
+    void notify_internal( const sc_time&, sc_event_timed*& slot_p );
     void notify_next_delta();
+    void defer_notify_internal( const sc_time& );
 
     bool remove_static( sc_method_handle ) const;
     bool remove_static( sc_thread_handle ) const;
     bool remove_dynamic( sc_method_handle ) const;
     bool remove_dynamic( sc_thread_handle ) const;
 
+    // would a notification trigger a process?
+    bool observed() const;
+
     void register_event( const char* name, bool is_kernel_event = false );
     void reset();
 
@@ -340,6 +386,9 @@ private:
     mutable std::vector<sc_thread_handle> m_threads_static;
     mutable std::vector<sc_thread_handle> m_threads_dynamic;
 
+    // static methods and threads in the sensitivity table, or null
+    mutable sc_process_b* const*          m_static_slice;
+
 private:
     static struct kernel_tag {} kernel_event;
     explicit sc_event( kernel_tag, const char* name = NULL );
@@ -357,15 +406,20 @@ private:
 
 class SC_API sc_event_timed
 {
+    friend class sc_checkpoint;
     friend class sc_event;
     friend class sc_simcontext;
+    friend class sc_timing_wheel;
+    friend class sc_clock;
+    friend class sc_process_b;
 
     friend SC_API int sc_notify_time_compare( const void*, const void* );
 
 private:
 
-    sc_event_timed( sc_event* e, const sc_time& t )
-        : m_event( e ), m_notify_time( t )
+    sc_event_timed( sc_event* e, const sc_time& t, bool slot = false )
+        : m_event( e ), m_notify_time( t ), m_rekey_time()
+        , m_slot( slot ), m_queued( false ), m_rekey( false )
         {}
 
     ~sc_event_timed()
@@ -375,8 +429,19 @@ private:
         { return m_event; }
 
     const sc_time& notify_time() const
+        { return m_rekey ? m_rekey_time : m_notify_time; }
+
+    // time the queue is ordered by, earlier than the notification time
+    // while a re-armed timer slot waits to be moved (see sc_timing_wheel)
+    const sc_time& key_time() const
         { return m_notify_time; }
 
+    // delete a record taken from the queue, unless it is a timer slot
+    static void retire( sc_event_timed* );
+
+    // delete the timer slot of a process, or leave it to the queue
+    static void delete_slot( sc_event_timed* );
+
     static void* operator new( std::size_t )
         { return allocate(); }
 
@@ -393,6 +458,10 @@ private:
 
     sc_event* m_event;
     sc_time   m_notify_time;
+    sc_time   m_rekey_time;   // time a re-armed slot is moved to.
+    bool      m_slot;         // timer slot of a process, not deleted.
+    bool      m_queued;       // in the queue, possibly cancelled.
+    bool      m_rekey;        // re-armed slot, queued at an earlier key.
 
 private:
 
@@ -417,7 +486,9 @@ inline
 void
 sc_event::notify_internal( const sc_time& t )
 {
-    if( t == SC_ZERO_TIME ) {
+    if( SC_UNLIKELY_( m_simc->evaluating_in_parallel() ) ) {
+        defer_notify_internal( t );
+    } else if( t == SC_ZERO_TIME ) {
         // add this event to the delta events set
         m_delta_event_index = m_simc->add_delta_event( this );
         m_notify_type = DELTA;
@@ -454,6 +525,7 @@ inline
 void
 sc_event::add_static( sc_method_handle method_h ) const
 {
+    m_static_slice = 0;
     m_methods_static.push_back( method_h );
 }
 
@@ -461,6 +533,7 @@ inline
 void
 sc_event::add_static( sc_thread_handle thread_h ) const
 {
+    m_static_slice = 0;
     m_threads_static.push_back( thread_h );
 }
 
@@ -492,10 +565,13 @@ extern void notify( double v, sc_time_unit tu, sc_event& e );
 
 inline
 sc_event_list::sc_event_list( bool and_list_, bool auto_delete_ ) 
-  : m_events() 
+  : m_events( m_inline_events ) 
+  , m_size( 0 ) 
+  , m_capacity( inline_capacity ) 
   , m_and_list( and_list_ ) 
   , m_auto_delete( auto_delete_ ) 
   , m_busy( 0 )
+  , m_waiter_p( 0 )
 {
 }
 
@@ -503,20 +579,26 @@ inline
 sc_event_list::sc_event_list( const sc_event& e,
                               bool and_list_,
                               bool auto_delete_ )
-  : m_events()
+  : m_events( m_inline_events )
+  , m_size( 1 )
+  , m_capacity( inline_capacity )
   , m_and_list( and_list_ )
   , m_auto_delete( auto_delete_ )
   , m_busy(0)
+  , m_waiter_p( 0 )
 {
-    m_events.push_back( &e );
+    m_inline_events[0] = &e;
 }
 
 inline
 sc_event_list::sc_event_list( sc_event_list const & that )
-  : m_events()
+  : m_events( m_inline_events )
+  , m_size( 0 )
+  , m_capacity( inline_capacity )
   , m_and_list( that.m_and_list )
   , m_auto_delete( false )
   , m_busy( 0 )
+  , m_waiter_p( 0 )
 {
     move_from( that );
     that.auto_delete(); // free automatic lists
@@ -542,15 +624,8 @@ sc_event_list::~sc_event_list()
 {
     if( m_busy )
         report_premature_destruction();
-}
-
-inline
-void
-sc_event_list::swap( sc_event_list& that )
-{
-    if( busy() || that.busy() )
-        report_invalid_modification();
-    m_events.swap( that.m_events );
+    if( m_events != m_inline_events )
+        delete [] m_events;
 }
 
 inline
@@ -560,7 +635,7 @@ sc_event_list::move_from( sc_event_list const&  that )
     if( that.temporary() ) {
         swap( const_cast<sc_event_list&>(that) ); // move from source
     } else {
-        m_events = that.m_events;                 // copy from source
+        assign( that );                           // copy from source
     }
 }
 
@@ -568,7 +643,7 @@ inline
 int
 sc_event_list::size() const
 {
-    return static_cast<int>(m_events.size());
+    return m_size;
 }
 
 inline
@@ -602,7 +677,7 @@ sc_event_list::auto_delete() const
         --m_busy;
     }
     if( ! m_busy && m_auto_delete ) {
-        delete this;
+        release_temporary();
     }
 }
 
@@ -201,6 +201,20 @@ SC_DEFINE_MESSAGE(SC_ID_RESET_PROCESS_WHILE_NOT_RUNNING_  , 573,
         "a process may not be asynchronously reset while the simulation is not running" )
 SC_DEFINE_MESSAGE(SC_ID_THROW_IT_WHILE_NOT_RUNNING_  , 574,
         "throw_it not allowed unless simulation is running " )
+SC_DEFINE_MESSAGE(SC_ID_SET_PARTITION_  , 575,
+        "set_partition() is only allowed for SC_METHODs" )
+SC_DEFINE_MESSAGE(SC_ID_PARALLEL_EVALUATION_  , 576,
+        "parallel evaluation of SC_METHODs" )
+SC_DEFINE_MESSAGE(SC_ID_LEVELIZED_METHODS_  , 577,
+        "levelized execution of SC_METHODs" )
+SC_DEFINE_MESSAGE(SC_ID_KERNEL_PROFILE_  , 578,
+        "kernel profile" )
+SC_DEFINE_MESSAGE(SC_ID_STACK_PROFILE_  , 579,
+        "stack profile" )
+SC_DEFINE_MESSAGE(SC_ID_CHECKPOINT_  , 580,
+        "simulation checkpoint" )
+SC_DEFINE_MESSAGE(SC_ID_PDES_  , 581,
+        "distributed simulation" )
 
 
 /*****************************************************************************
@@ -0,0 +1,368 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_kernel_profiler.cpp -- Profiling of processes and scheduler queues.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_INCLUDE_WINDOWS_H
+#  define SC_INCLUDE_WINDOWS_H // include Windows.h, if needed
+#endif
+#include "sysc/kernel/sc_kernel_profiler.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_method_process.h"
+#include "sysc/kernel/sc_runnable_int.h"
+#include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/kernel/sc_thread_process.h"
+#include "sysc/kernel/sc_timing_wheel.h"
+#include "sysc/communication/sc_prim_channel.h"
+
+#include <fstream>
+#include <iomanip>
+
+#if SC_CPLUSPLUS >= 201103L
+#  include <chrono>
+#elif !defined(WIN32) && !defined(_WIN32)
+#  include <time.h>
+#endif
+
+namespace sc_core {
+
+// monotonic host time in nanoseconds
+
+static sc_dt::uint64
+sc_profile_host_time()
+{
+#if SC_CPLUSPLUS >= 201103L
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch() ).count();
+#elif !defined(WIN32) && !defined(_WIN32)
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return static_cast<sc_dt::uint64>( ts.tv_sec ) * 1000000000u + ts.tv_nsec;
+#else
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter( &count );
+    QueryPerformanceFrequency( &freq );
+    return static_cast<sc_dt::uint64>(
+             count.QuadPart / freq.QuadPart * 1000000000u
+           + count.QuadPart % freq.QuadPart * 1000000000u / freq.QuadPart );
+#endif
+}
+
+static double
+sc_profile_seconds( sc_dt::uint64 ns )
+{
+    return static_cast<double>( ns ) * 1e-9;
+}
+
+// ----------------------------------------------------------------------------
+//  STRUCT : sc_process_profile
+// ----------------------------------------------------------------------------
+
+void
+sc_process_profile::begin( bool switched )
+{
+    activations++;
+    if ( switched )
+        switches++;
+    start_time = sc_profile_host_time();
+}
+
+void
+sc_process_profile::end()
+{
+    if ( start_time == 0 )
+        return;
+    host_time += sc_profile_host_time() - start_time;
+    start_time = 0;
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_kernel_profiler
+// ----------------------------------------------------------------------------
+
+sc_kernel_profiler::sc_kernel_profiler( sc_simcontext& simc,
+                                        const std::string& file_name )
+  : m_simc( &simc )
+  , m_file_name( file_name )
+  , m_written( false )
+  , m_processes()
+  , m_samples()
+  , m_current()
+  , m_deltas( 0 )
+  , m_timesteps( 0 )
+  , m_step_deltas( 0 )
+  , m_max_step_deltas( 0 )
+  , m_max()
+  , m_start_time( sc_profile_host_time() )
+{}
+
+sc_kernel_profiler::~sc_kernel_profiler()
+{
+    for ( std::size_t proc_i = 0; proc_i < m_processes.size(); proc_i++ )
+        delete m_processes[proc_i];
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_kernel_profiler::attach"
+// |
+// | This method creates the profile of a process, unless it already has
+// | one. It is called for all processes at the start of simulation and
+// | for the processes created afterwards. The profile is owned by the
+// | profiler, so that it is still available after the process has been
+// | deleted.
+// |
+// | Arguments:
+// |     process_p -> process to be profiled.
+// +----------------------------------------------------------------------------
+void
+sc_kernel_profiler::attach( sc_process_b* process_p )
+{
+    if ( process_p->m_profile_p )
+        return;
+
+    sc_process_profile* profile_p = new sc_process_profile;
+    profile_p->name = process_p->name();
+    profile_p->kind = process_p->kind();
+    profile_p->activations = 0;
+    profile_p->switches = 0;
+    profile_p->host_time = 0;
+    profile_p->start_time = 0;
+    m_processes.push_back( profile_p );
+    process_p->m_profile_p = profile_p;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_kernel_profiler::begin_delta"
+// |
+// | This method counts the runnable processes at the beginning of the
+// | evaluation phase of a delta cycle.
+// +----------------------------------------------------------------------------
+void
+sc_kernel_profiler::begin_delta()
+{
+    const sc_runnable* runnable_p = m_simc->m_runnable;
+    m_current.methods = static_cast<unsigned>( runnable_p->method_count() );
+    m_current.threads = static_cast<unsigned>( runnable_p->thread_count() );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_kernel_profiler::end_delta"
+// |
+// | This method records a sample of the delta cycle whose evaluation phase
+// | has just been completed, before the update requests are performed.
+// +----------------------------------------------------------------------------
+void
+sc_kernel_profiler::end_delta()
+{
+    unsigned updates = 0;
+    for ( sc_prim_channel* channel_p =
+              m_simc->m_prim_channel_registry->m_update_list_p;
+          channel_p != (sc_prim_channel*)sc_prim_channel::list_end;
+          channel_p = channel_p->m_update_next_p )
+    {
+        updates++;
+    }
+    for ( sc_update_batch* batch_p =
+              m_simc->m_prim_channel_registry->m_batch_list_p;
+          batch_p != 0; batch_p = batch_p->m_next_p )
+    {
+        updates += static_cast<unsigned>( batch_p->m_channels.size() );
+    }
+
+    m_current.time = m_simc->m_curr_time.value();
+    m_current.delta = m_simc->m_delta_count;
+    m_current.updates = updates;
+    m_current.timed = static_cast<unsigned>( m_simc->m_timed_events->size() );
+
+    if ( m_current.methods > m_max.methods ) m_max.methods = m_current.methods;
+    if ( m_current.threads > m_max.threads ) m_max.threads = m_current.threads;
+    if ( m_current.updates > m_max.updates ) m_max.updates = m_current.updates;
+    if ( m_current.timed > m_max.timed )     m_max.timed = m_current.timed;
+
+    if ( m_samples.size() < max_samples )
+        m_samples.push_back( m_current );
+    m_deltas++;
+    if ( ++m_step_deltas > m_max_step_deltas )
+        m_max_step_deltas = m_step_deltas;
+}
+
+void
+sc_kernel_profiler::timestep()
+{
+    m_timesteps++;
+    m_step_deltas = 0;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_kernel_profiler::write"
+// |
+// | This method writes the profile file. For CSV files, the delta cycle
+// | samples are written to a second file, whose name has the suffix
+// | "_deltas.csv" instead of ".csv".
+// +----------------------------------------------------------------------------
+void
+sc_kernel_profiler::write()
+{
+    if ( m_written )
+        return;
+    m_written = true;
+
+    // the active process is still running
+
+    sc_process_b* active_p = m_simc->get_curr_proc_info()->process_handle;
+    if ( active_p && active_p->m_profile_p )
+    {
+        active_p->m_profile_p->end();
+        active_p->m_profile_p->start_time = sc_profile_host_time();
+    }
+
+    const std::string& name = m_file_name;
+    bool json = name.size() >= 5 &&
+                name.compare( name.size() - 5, 5, ".json" ) == 0;
+
+    std::ofstream out( name.c_str() );
+    if ( !out )
+    {
+        SC_REPORT_WARNING( SC_ID_KERNEL_PROFILE_, name.c_str() );
+        return;
+    }
+    if ( json )
+    {
+        write_json( out );
+        return;
+    }
+
+    std::string deltas_name( name );
+    if ( name.size() >= 4 && name.compare( name.size() - 4, 4, ".csv" ) == 0 )
+        deltas_name.erase( name.size() - 4 );
+    deltas_name += "_deltas.csv";
+
+    std::ofstream deltas_out( deltas_name.c_str() );
+    if ( !deltas_out )
+    {
+        SC_REPORT_WARNING( SC_ID_KERNEL_PROFILE_, deltas_name.c_str() );
+        return;
+    }
+    write_csv( out, deltas_out );
+}
+
+void
+sc_kernel_profiler::write_csv( std::ostream& processes,
+                               std::ostream& deltas ) const
+{
+    processes << std::setprecision( 9 )
+              << "name,kind,activations,switches,host_time" << std::endl;
+    for ( std::size_t proc_i = 0; proc_i < m_processes.size(); proc_i++ )
+    {
+        const sc_process_profile& profile = *m_processes[proc_i];
+        processes << profile.name << ',' << profile.kind << ','
+                  << profile.activations << ',' << profile.switches << ','
+                  << sc_profile_seconds( profile.host_time ) << std::endl;
+    }
+
+    deltas << std::setprecision( 17 )
+           << "time,delta,runnable_methods,runnable_threads,updates,"
+              "timed_notifications" << std::endl;
+    for ( std::size_t sample_i = 0; sample_i < m_samples.size(); sample_i++ )
+    {
+        const delta_sample& sample = m_samples[sample_i];
+        deltas << sc_time::from_value( sample.time ).to_seconds() << ','
+               << sample.delta << ',' << sample.methods << ','
+               << sample.threads << ',' << sample.updates << ','
+               << sample.timed << std::endl;
+    }
+}
+
+// write a JSON string, object names do not contain control characters
+
+static void
+sc_profile_json_string( std::ostream& os, const std::string& s )
+{
+    os << '"';
+    for ( std::size_t char_i = 0; char_i < s.size(); char_i++ )
+    {
+        if ( s[char_i] == '"' || s[char_i] == '\\' )
+            os << '\\';
+        os << s[char_i];
+    }
+    os << '"';
+}
+
+void
+sc_kernel_profiler::write_json( std::ostream& os ) const
+{
+    os << std::setprecision( 17 ) << "{\n  \"simulation\": {\n"
+       << "    \"time\": " << m_simc->m_curr_time.to_seconds() << ",\n"
+       << "    \"host_time\": "
+       << sc_profile_seconds( sc_profile_host_time() - m_start_time ) << ",\n"
+       << "    \"deltas\": " << m_deltas << ",\n"
+       << "    \"timesteps\": " << m_timesteps << ",\n"
+       << "    \"max_deltas_per_timestep\": " << m_max_step_deltas << ",\n"
+       << "    \"max_runnable_methods\": " << m_max.methods << ",\n"
+       << "    \"max_runnable_threads\": " << m_max.threads << ",\n"
+       << "    \"max_updates\": " << m_max.updates << ",\n"
+       << "    \"max_timed_notifications\": " << m_max.timed << ",\n"
+       << "    \"dropped_samples\": " << m_deltas - m_samples.size() << "\n"
+       << "  },\n  \"processes\": [";
+
+    for ( std::size_t proc_i = 0; proc_i < m_processes.size(); proc_i++ )
+    {
+        const sc_process_profile& profile = *m_processes[proc_i];
+        os << ( proc_i ? ",\n" : "\n" ) << "    { \"name\": ";
+        sc_profile_json_string( os, profile.name );
+        os << ", \"kind\": \"" << profile.kind << "\""
+           << ", \"activations\": " << profile.activations
+           << ", \"switches\": " << profile.switches
+           << ", \"host_time\": " << sc_profile_seconds( profile.host_time )
+           << " }";
+    }
+
+    os << "\n  ],\n  \"deltas\": [";
+    for ( std::size_t sample_i = 0; sample_i < m_samples.size(); sample_i++ )
+    {
+        const delta_sample& sample = m_samples[sample_i];
+        os << ( sample_i ? ",\n" : "\n" )
+           << "    { \"time\": "
+           << sc_time::from_value( sample.time ).to_seconds()
+           << ", \"delta\": " << sample.delta
+           << ", \"runnable_methods\": " << sample.methods
+           << ", \"runnable_threads\": " << sample.threads
+           << ", \"updates\": " << sample.updates
+           << ", \"timed_notifications\": " << sample.timed << " }";
+    }
+    os << "\n  ]\n}" << std::endl;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,147 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_kernel_profiler.h -- Profiling of processes and scheduler queues.
+
+  If a profile file is set, each process records its activations, the
+  host time spent in it and, for thread processes, the number of context
+  switches to it. For each delta cycle, the number of runnable processes
+  at its beginning, the number of update requests and the number of
+  pending timed notifications are sampled. The profile is written when
+  the simulation ends, as JSON if the file name ends with ".json" and as
+  CSV otherwise.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_KERNEL_PROFILER_H_INCLUDED_
+#define SC_KERNEL_PROFILER_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace sc_core {
+
+class sc_process_b;
+class sc_runnable;
+class sc_simcontext;
+
+// ----------------------------------------------------------------------------
+//  STRUCT : sc_process_profile
+//
+//  Counters of a single process. They are only modified by the process
+//  itself, so method processes executed concurrently need no locking.
+// ----------------------------------------------------------------------------
+
+struct SC_API sc_process_profile
+{
+    // the process starts or resumes execution
+    void begin( bool switched );
+
+    // the process returns or suspends itself
+    void end();
+
+    std::string   name;
+    const char*   kind;
+    sc_dt::uint64 activations;
+    sc_dt::uint64 switches;    // context switches to a thread process.
+    sc_dt::uint64 host_time;   // in nanoseconds.
+    sc_dt::uint64 start_time;  // of the current activation, 0 if none.
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_kernel_profiler
+//
+//  Collects the process profiles and the delta cycle samples of a
+//  simulation context and writes them to the profile file.
+// ----------------------------------------------------------------------------
+
+class sc_kernel_profiler
+{
+    friend class sc_simcontext;
+
+    // sample of a delta cycle
+    struct delta_sample
+    {
+        sc_dt::uint64 time;     // simulation time, in time resolution units.
+        sc_dt::uint64 delta;    // delta count at the end of the cycle.
+        unsigned      methods;  // runnable method processes.
+        unsigned      threads;  // runnable thread processes.
+        unsigned      updates;  // update requests.
+        unsigned      timed;    // pending timed notifications.
+    };
+
+    enum { max_samples = 1 << 20 }; // further samples are only summarized.
+
+private:
+
+    sc_kernel_profiler( sc_simcontext& simc, const std::string& file_name );
+    ~sc_kernel_profiler();
+
+    // create the profile of a process
+    void attach( sc_process_b* );
+
+    void begin_delta();
+    void end_delta();
+    void timestep();
+
+    // write the profile file, only once
+    void write();
+    void write_csv( std::ostream& processes, std::ostream& deltas ) const;
+    void write_json( std::ostream& ) const;
+
+private:
+    sc_simcontext*                   m_simc;
+    std::string                      m_file_name;
+    bool                             m_written;
+    std::vector<sc_process_profile*> m_processes;
+    std::vector<delta_sample>        m_samples;
+    delta_sample                     m_current;     // delta being executed.
+    sc_dt::uint64                    m_deltas;      // recorded delta cycles.
+    sc_dt::uint64                    m_timesteps;
+    sc_dt::uint64                    m_step_deltas; // of the current time.
+    sc_dt::uint64                    m_max_step_deltas;
+    delta_sample                     m_max;         // maxima of the samples.
+    sc_dt::uint64                    m_start_time;  // host time at start.
+
+private:
+    // disabled
+    sc_kernel_profiler( const sc_kernel_profiler& );
+    sc_kernel_profiler& operator = ( const sc_kernel_profiler& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_KERNEL_PROFILER_H_INCLUDED_
+// Taf!
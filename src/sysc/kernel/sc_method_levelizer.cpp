@@ -0,0 +1,704 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_method_levelizer.cpp -- Levelized execution of method process networks.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_method_levelizer.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_method_process.h"
+#include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/communication/sc_port.h"
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/communication/sc_signal.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace sc_core {
+
+sc_method_levelizer::sc_method_levelizer( sc_simcontext& simc )
+  : m_simc( &simc )
+  , m_nodes()
+  , m_readers()
+  , m_relevelize( false )
+  , m_levels()
+  , m_batch()
+  , m_lowest( 0 )
+  , m_queued( 0 )
+  , m_triggered()
+{}
+
+sc_method_levelizer::~sc_method_levelizer()
+{}
+
+// +----------------------------------------------------------------------------
+// |"sc_method_levelizer::run_methods"
+// |
+// | This method executes the runnable method processes of the current
+// | evaluation phase. Levelized method processes are queued by level and
+// | the lowest level is executed whenever the run queue is empty. Other
+// | method processes are executed in the order of the run queue.
+// |
+// | Arguments:
+// |     empty_eval_phase = set to false if a process was executed.
+// | Result is false if an unfielded exception occurred, true if not.
+// +----------------------------------------------------------------------------
+bool
+sc_method_levelizer::run_methods( bool& empty_eval_phase )
+{
+    sc_runnable* runnable_p = m_simc->m_runnable;
+    bool         result = true;
+
+    // the writes are observed in the update list, so no update batches
+    m_simc->m_levelizing = true;
+    m_simc->m_prim_channel_registry->m_batch_updates = false;
+    for ( ;; )
+    {
+        sc_method_handle method_h = runnable_p->pop_method();
+        if ( !method_h )
+        {
+            runnable_p->toggle_methods();
+            method_h = runnable_p->pop_method();
+        }
+
+        if ( method_h )
+        {
+            if ( method_h->m_level >= 0 )
+            {
+                queue( method_h );
+                continue;
+            }
+            empty_eval_phase = false;
+            if ( !execute( method_h ) )
+            {
+                result = false;
+                break;
+            }
+            continue;
+        }
+
+        if ( m_queued == 0 )
+            break;
+
+        if ( m_relevelize )
+        {
+            relevelize();
+            continue;
+        }
+
+        // EXECUTE THE LOWEST QUEUED LEVEL:
+        //
+        // Processes triggered during the execution of the batch are queued
+        // separately, they have a higher level unless the levels are stale.
+
+        while ( m_levels[m_lowest].empty() )
+            m_lowest++;
+        m_batch.swap( m_levels[m_lowest] );
+        m_queued -= m_batch.size();
+        empty_eval_phase = false;
+
+        std::size_t batch_i = 0;
+        while ( batch_i < m_batch.size() )
+        {
+            method_h = m_batch[batch_i++];
+            method_h->m_level_queued = false;
+
+            // killed or suspended after being queued
+            if ( method_h->m_state & sc_method_process::ps_bit_zombie )
+                continue;
+            if ( method_h->m_state & sc_method_process::ps_bit_suspended )
+            {
+                method_h->m_state |= sc_method_process::ps_bit_ready_to_run;
+                continue;
+            }
+            if ( method_h->is_runnable() ) // triggered before being queued
+                m_simc->remove_runnable_method( method_h );
+
+            if ( !execute( method_h ) )
+            {
+                result = false;
+                break;
+            }
+        }
+        m_batch.erase( m_batch.begin(), m_batch.begin() + batch_i );
+
+        if ( !result ||
+             ( m_simc->m_forced_stop && sc_get_stop_mode() == SC_STOP_IMMEDIATE ) )
+            break;
+    }
+    m_simc->m_levelizing = false;
+    m_simc->m_prim_channel_registry->m_batch_updates = true;
+
+    if ( m_queued != 0 || !m_batch.empty() )
+        requeue();
+    m_lowest = m_levels.size();
+    return result;
+}
+
+bool
+sc_method_levelizer::execute( sc_method_process* method_p )
+{
+    sc_prim_channel* mark_p = m_simc->m_prim_channel_registry->m_update_list_p;
+
+    m_simc->set_curr_proc( method_p );
+    bool result = method_p->run_process();
+    m_simc->reset_curr_proc();
+
+    if ( result && method_p->m_level_node >= 0 )
+        observe_updates( m_nodes[method_p->m_level_node], mark_p );
+    return result;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_method_levelizer::observe_updates"
+// |
+// | This method records the channels written by the method process that
+// | has just been executed. If the process is levelized, the signals among
+// | them are updated, and the resulting delta notifications are triggered
+// | immediately. The update requests issued during the execution are at
+// | the head of the update list.
+// |
+// | Arguments:
+// |     node_  = node of the method process.
+// |     mark_p = head of the update list before the execution.
+// +----------------------------------------------------------------------------
+void
+sc_method_levelizer::observe_updates( node& node_, sc_prim_channel* mark_p )
+{
+    std::vector<sc_event*>&       delta_events = m_simc->m_delta_events;
+    std::size_t                   delta_mark = delta_events.size();
+    std::vector<sc_prim_channel*>& writes = node_.writes;
+    bool                          eager = node_.method_p->m_level >= 0;
+
+    sc_prim_channel** link_p = &m_simc->m_prim_channel_registry->m_update_list_p;
+    while ( *link_p != mark_p )
+    {
+        sc_prim_channel* channel_p = *link_p;
+
+        std::vector<sc_prim_channel*>::iterator it =
+            std::lower_bound( writes.begin(), writes.end(), channel_p );
+        if ( it == writes.end() || *it != channel_p )
+        {
+            writes.insert( it, channel_p );
+            if ( m_readers.find( channel_p ) != m_readers.end() )
+                m_relevelize = true;
+
+            // the method behind an sc_out port may read what others write
+            output_map::const_iterator out_it = m_outputs.find( channel_p );
+            if ( out_it != m_outputs.end() &&
+                 out_it->second != node_.method_p )
+                channel_p->m_eager_update = false;
+        }
+
+        if ( eager && channel_p->m_eager_update )
+        {
+            *link_p = channel_p->m_update_next_p;
+            channel_p->perform_update();
+        }
+        else
+        {
+            link_p = &channel_p->m_update_next_p;
+        }
+    }
+
+    if ( delta_events.size() == delta_mark )
+        return;
+
+    m_triggered.assign( delta_events.begin() + delta_mark, delta_events.end() );
+    delta_events.resize( delta_mark );
+    for ( std::size_t event_i = m_triggered.size(); event_i-- > 0; )
+        m_triggered[event_i]->trigger();
+}
+
+void
+sc_method_levelizer::queue( sc_method_process* method_p )
+{
+    if ( method_p->m_level_queued )
+        return;
+    method_p->m_level_queued = true;
+
+    std::size_t level = static_cast<std::size_t>( method_p->m_level );
+    m_levels[level].push_back( method_p );
+    m_queued++;
+    if ( level < m_lowest )
+        m_lowest = level;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_method_levelizer::requeue"
+// |
+// | This method puts the queued method processes back into the run queue,
+// | when the evaluation phase is left early.
+// +----------------------------------------------------------------------------
+void
+sc_method_levelizer::requeue()
+{
+    m_levels.push_back( method_vec() );
+    m_levels.back().swap( m_batch );
+    for ( std::size_t level_i = 0; level_i < m_levels.size(); level_i++ )
+    {
+        method_vec& level = m_levels[level_i];
+        for ( std::size_t method_i = 0; method_i < level.size(); method_i++ )
+        {
+            sc_method_handle method_h = level[method_i];
+            method_h->m_level_queued = false;
+            if ( !method_h->is_runnable() )
+                m_simc->m_runnable->push_back_method( method_h );
+        }
+        level.clear();
+    }
+    m_levels.pop_back();
+    m_queued = 0;
+    m_lowest = m_levels.size();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_method_levelizer::relevelize"
+// |
+// | This method computes the levels from the observed writers and the
+// | static readers of the signals. The method processes in cycles get the
+// | regular scheduling, the others are assigned the length of the longest
+// | path leading to them as level. The queued method processes are moved
+// | to their new levels, or to the run queue.
+// +----------------------------------------------------------------------------
+
+namespace {
+
+typedef std::vector<std::vector<std::size_t> > sc_level_graph;
+
+// mark the nodes of the strongly connected components with more than one
+// node (iterative version of Tarjan's algorithm)
+
+void
+sc_level_find_cycles( const sc_level_graph& succ, std::vector<bool>& cyclic )
+{
+    const std::size_t none = static_cast<std::size_t>( -1 );
+    std::size_t       node_n = succ.size();
+    std::size_t       next_index = 0;
+
+    std::vector<std::size_t> index( node_n, none );
+    std::vector<std::size_t> low( node_n, 0 );
+    std::vector<bool>        on_stack( node_n, false );
+    std::vector<std::size_t> stack;
+    std::vector<std::pair<std::size_t, std::size_t> > calls; // node, edge.
+
+    cyclic.assign( node_n, false );
+    for ( std::size_t root = 0; root < node_n; root++ )
+    {
+        if ( index[root] != none )
+            continue;
+
+        calls.push_back( std::make_pair( root, std::size_t(0) ) );
+        while ( !calls.empty() )
+        {
+            std::size_t node_i = calls.back().first;
+            if ( index[node_i] == none )
+            {
+                index[node_i] = low[node_i] = next_index++;
+                stack.push_back( node_i );
+                on_stack[node_i] = true;
+            }
+
+            std::size_t edge_i = calls.back().second;
+            if ( edge_i < succ[node_i].size() )
+            {
+                calls.back().second++;
+                std::size_t next = succ[node_i][edge_i];
+                if ( index[next] == none )
+                    calls.push_back( std::make_pair( next, std::size_t(0) ) );
+                else if ( on_stack[next] && index[next] < low[node_i] )
+                    low[node_i] = index[next];
+                continue;
+            }
+
+            calls.pop_back();
+            if ( !calls.empty() && low[node_i] < low[calls.back().first] )
+                low[calls.back().first] = low[node_i];
+
+            if ( low[node_i] == index[node_i] )
+            {
+                bool        in_cycle = stack.back() != node_i;
+                std::size_t member;
+                do {
+                    member = stack.back();
+                    stack.pop_back();
+                    on_stack[member] = false;
+                    cyclic[member] = in_cycle;
+                } while ( member != node_i );
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+void
+sc_method_levelizer::relevelize()
+{
+    m_relevelize = false;
+
+    method_vec queued;
+    for ( std::size_t level_i = 0; level_i < m_levels.size(); level_i++ )
+    {
+        queued.insert( queued.end(), m_levels[level_i].begin(),
+                       m_levels[level_i].end() );
+        m_levels[level_i].clear();
+    }
+    m_queued = 0;
+
+    // BUILD THE GRAPH, THE EDGES LEAD FROM THE WRITERS TO THE READERS:
+
+    sc_level_graph succ( m_nodes.size() );
+    for ( std::size_t node_i = 0; node_i < m_nodes.size(); node_i++ )
+    {
+        const std::vector<sc_prim_channel*>& writes = m_nodes[node_i].writes;
+        for ( std::size_t write_i = 0; write_i < writes.size(); write_i++ )
+        {
+            reader_map::const_iterator it = m_readers.find( writes[write_i] );
+            if ( it == m_readers.end() )
+                continue;
+            for ( std::size_t reader_i = 0; reader_i < it->second.size();
+                  reader_i++ )
+            {
+                // a method process writing its own input is no cycle
+                if ( it->second[reader_i] != node_i )
+                    succ[node_i].push_back( it->second[reader_i] );
+            }
+        }
+        std::sort( succ[node_i].begin(), succ[node_i].end() );
+        succ[node_i].erase( std::unique( succ[node_i].begin(),
+                                         succ[node_i].end() ),
+                            succ[node_i].end() );
+    }
+
+    // ASSIGN THE LEVELS OF THE ACYCLIC PART:
+
+    std::vector<bool> cyclic;
+    sc_level_find_cycles( succ, cyclic );
+
+    std::vector<int> level( m_nodes.size(), 0 );
+    std::vector<int> pending( m_nodes.size(), 0 );
+    for ( std::size_t node_i = 0; node_i < succ.size(); node_i++ )
+    {
+        m_nodes[node_i].method_p->m_level = -1;
+        if ( cyclic[node_i] ) continue;
+        for ( std::size_t succ_i = 0; succ_i < succ[node_i].size(); succ_i++ )
+            pending[succ[node_i][succ_i]]++;
+    }
+
+    std::vector<std::size_t> ready;
+    for ( std::size_t node_i = 0; node_i < m_nodes.size(); node_i++ )
+    {
+        if ( !cyclic[node_i] && pending[node_i] == 0 )
+            ready.push_back( node_i );
+    }
+
+    int level_n = 0;
+    while ( !ready.empty() )
+    {
+        std::size_t node_i = ready.back();
+        ready.pop_back();
+        m_nodes[node_i].method_p->m_level = level[node_i];
+        if ( level[node_i] >= level_n )
+            level_n = level[node_i] + 1;
+
+        for ( std::size_t succ_i = 0; succ_i < succ[node_i].size(); succ_i++ )
+        {
+            std::size_t next = succ[node_i][succ_i];
+            if ( cyclic[next] ) continue;
+            if ( level[next] <= level[node_i] )
+                level[next] = level[node_i] + 1;
+            if ( --pending[next] == 0 )
+                ready.push_back( next );
+        }
+    }
+    m_levels.resize( level_n );
+    m_lowest = m_levels.size();
+
+    // MOVE THE QUEUED METHOD PROCESSES:
+
+    for ( std::size_t queued_i = 0; queued_i < queued.size(); queued_i++ )
+    {
+        sc_method_handle method_h = queued[queued_i];
+        method_h->m_level_queued = false;
+        if ( method_h->m_level >= 0 )
+            queue( method_h );
+        else if ( !method_h->is_runnable() )
+            m_simc->m_runnable->push_back_method( method_h );
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_method_levelizer::start_simulation"
+// |
+// | This method collects the method processes owned by modules without
+// | thread processes, and the signals they are statically sensitive to.
+// | All of them start on level 0, until their writes are observed.
+// |
+// | A signal is updated eagerly only if each module reading it is
+// | combinational: it has no thread processes, and its method processes
+// | are statically sensitive to all signals it reads. A process triggered
+// | within the delta cycle thus never reads a signal with a pending update
+// | without being triggered again, while e.g. clocked processes keep
+// | reading the values of the previous delta cycle.
+// | An sc_out port can be read as well, so it counts as a read, unless the
+// | module has a single method process: that process reads its output
+// | before writing it, and the signal stays eager as long as no other
+// | process writes it.
+// | Reset signals and clocks are never updated eagerly.
+// +----------------------------------------------------------------------------
+
+template< sc_writer_policy POL >
+bool
+sc_method_levelizer::bool_events( sc_signal_channel* channel_p,
+                                  std::vector<sc_event*>& events,
+                                  bool& regular )
+{
+    sc_signal<bool,POL>* signal_p =
+        dynamic_cast<sc_signal<bool,POL>*>( channel_p );
+    if ( !signal_p )
+        return false;
+
+    if ( sc_signal_channel::edge_events* edges_p =
+             signal_p->m_edge_events_p )
+    {
+        if ( edges_p->posedge_event_p )
+            events.push_back( edges_p->posedge_event_p );
+        if ( edges_p->negedge_event_p )
+            events.push_back( edges_p->negedge_event_p );
+        regular = !edges_p->reset_p;
+    }
+    regular = regular && !signal_p->is_clock();
+    return true;
+}
+
+template< sc_writer_policy POL >
+bool
+sc_method_levelizer::logic_events( sc_signal_channel* channel_p,
+                                   std::vector<sc_event*>& events )
+{
+    sc_signal<sc_dt::sc_logic,POL>* signal_p =
+        dynamic_cast<sc_signal<sc_dt::sc_logic,POL>*>( channel_p );
+    if ( !signal_p )
+        return false;
+
+    if ( sc_signal_channel::edge_events* edges_p =
+             signal_p->m_edge_events_p )
+    {
+        if ( edges_p->posedge_event_p )
+            events.push_back( edges_p->posedge_event_p );
+        if ( edges_p->negedge_event_p )
+            events.push_back( edges_p->negedge_event_p );
+    }
+    return true;
+}
+
+void
+sc_method_levelizer::start_simulation()
+{
+    typedef std::vector<sc_signal_channel*>            signal_vec;
+    typedef std::pair<sc_object*, sc_signal_channel*> access;
+
+    std::vector<sc_method_process*>               methods;
+    std::map<const sc_event*, sc_signal_channel*> signal_of;
+    std::map<sc_signal_channel*, bool>            regular;  // may be eager.
+    std::vector<access>                           accesses; // reading.
+    std::vector<access>                           outputs;  // sc_out.
+    std::map<sc_object*, bool>                    dynamic;  // has threads.
+    bool                                          multiport = false;
+
+    // COLLECT THE METHOD PROCESSES, SIGNALS AND PORT BINDINGS:
+
+    std::vector<sc_object*> objects( sc_get_top_level_objects( m_simc ) );
+    for ( std::size_t obj_i = 0; obj_i < objects.size(); obj_i++ )
+    {
+        const std::vector<sc_object*>& children =
+            objects[obj_i]->get_child_objects();
+        objects.insert( objects.end(), children.begin(), children.end() );
+
+        sc_object* obj_p    = objects[obj_i];
+        sc_object* parent_p = obj_p->get_parent_object();
+
+        if ( sc_method_handle method_p = dynamic_cast<sc_method_handle>(obj_p) )
+        {
+            if ( dynamic_cast<sc_module*>( parent_p ) )
+                methods.push_back( method_p );
+            continue;
+        }
+        if ( dynamic_cast<sc_process_b*>(obj_p) )
+        {
+            if ( parent_p )
+                dynamic[parent_p] = true;
+            continue;
+        }
+
+        if ( sc_signal_channel* signal_p =
+                 dynamic_cast<sc_signal_channel*>(obj_p) )
+        {
+            std::vector<sc_event*> events;
+            bool                   is_regular = true;
+            if ( signal_p->m_change_event_p )
+                events.push_back( signal_p->m_change_event_p );
+            bool_events<SC_ONE_WRITER>( signal_p, events, is_regular ) ||
+            bool_events<SC_MANY_WRITERS>( signal_p, events, is_regular ) ||
+            bool_events<SC_UNCHECKED_WRITERS>( signal_p, events, is_regular ) ||
+            logic_events<SC_ONE_WRITER>( signal_p, events ) ||
+            logic_events<SC_MANY_WRITERS>( signal_p, events ) ||
+            logic_events<SC_UNCHECKED_WRITERS>( signal_p, events );
+
+            for ( std::size_t event_i = 0; event_i < events.size(); event_i++ )
+                signal_of[events[event_i]] = signal_p;
+            regular[signal_p] = is_regular;
+            if ( parent_p )
+                accesses.push_back( access( parent_p, signal_p ) );
+            continue;
+        }
+
+        sc_port_base* port_p = dynamic_cast<sc_port_base*>(obj_p);
+        if ( !port_p || !parent_p )
+            continue;
+
+        sc_signal_channel* signal_p =
+            dynamic_cast<sc_signal_channel*>( port_p->get_interface() );
+        if ( !signal_p )
+            continue;
+        if ( port_p->interface_count() > 1 )
+            multiport = true;
+        if ( std::strcmp( port_p->kind(), "sc_out" ) != 0 )
+            accesses.push_back( access( parent_p, signal_p ) );
+        else
+            outputs.push_back( access( parent_p, signal_p ) );
+    }
+
+    // CREATE THE NODES AND THEIR INPUTS:
+    //
+    // The writes of a module with thread processes cannot be attributed
+    // to its method processes, so the latter are not levelized.
+
+    std::map<sc_object*, std::vector<signal_vec> > module_inputs;
+    std::map<sc_object*, sc_method_process*>       module_method;
+    for ( std::size_t method_i = 0; method_i < methods.size(); method_i++ )
+    {
+        sc_method_handle method_p = methods[method_i];
+        sc_object*       module_p = method_p->get_parent_object();
+        module_method[module_p] = method_p;
+
+        signal_vec inputs;
+        const std::vector<const sc_event*>& events = method_p->m_static_events;
+        for ( std::size_t event_i = 0; event_i < events.size(); event_i++ )
+        {
+            std::map<const sc_event*, sc_signal_channel*>::iterator
+                signal_it = signal_of.find( events[event_i] );
+            if ( signal_it != signal_of.end() )
+                inputs.push_back( signal_it->second );
+        }
+        std::sort( inputs.begin(), inputs.end() );
+        inputs.erase( std::unique( inputs.begin(), inputs.end() ),
+                      inputs.end() );
+        module_inputs[module_p].push_back( inputs );
+
+        if ( dynamic[module_p] )
+            continue;
+
+        node node_ = { method_p, std::vector<sc_prim_channel*>() };
+        method_p->m_level_node = static_cast<int>( m_nodes.size() );
+        method_p->m_level = 0;
+        m_nodes.push_back( node_ );
+
+        for ( std::size_t input_i = 0; input_i < inputs.size(); input_i++ )
+            m_readers[inputs[input_i]].push_back( m_nodes.size() - 1 );
+    }
+    if ( !m_nodes.empty() )
+        m_levels.resize( 1 );
+    m_lowest = m_levels.size();
+
+    // SELECT THE SIGNALS TO BE UPDATED EAGERLY:
+    //
+    // The signals read through a multiport cannot be determined, so nothing
+    // is updated eagerly if there is one.
+
+    if ( multiport )
+        return;
+
+    for ( std::size_t output_i = 0; output_i < outputs.size(); output_i++ )
+    {
+        sc_object*         module_p = outputs[output_i].first;
+        sc_signal_channel* signal_p = outputs[output_i].second;
+
+        if ( dynamic[module_p] || module_inputs[module_p].size() != 1 )
+        {
+            accesses.push_back( outputs[output_i] );
+            continue;
+        }
+
+        // a second module with an sc_out port to the signal reads it
+        std::pair<output_map::iterator, bool> inserted =
+            m_outputs.insert( std::make_pair( signal_p,
+                                              module_method[module_p] ) );
+        if ( !inserted.second )
+            regular[signal_p] = false;
+    }
+
+    std::map<sc_object*, bool> sequential; // reads unlisted signals.
+    for ( std::size_t access_i = 0; access_i < accesses.size(); access_i++ )
+    {
+        sc_object*         module_p = accesses[access_i].first;
+        sc_signal_channel* signal_p = accesses[access_i].second;
+
+        const std::vector<signal_vec>& inputs = module_inputs[module_p];
+        for ( std::size_t method_i = 0; method_i < inputs.size(); method_i++ )
+        {
+            if ( !std::binary_search( inputs[method_i].begin(),
+                                      inputs[method_i].end(), signal_p ) )
+                sequential[module_p] = true;
+        }
+    }
+
+    for ( std::size_t access_i = 0; access_i < accesses.size(); access_i++ )
+    {
+        sc_object* module_p = accesses[access_i].first;
+        if ( dynamic[module_p] || sequential[module_p] )
+            regular[accesses[access_i].second] = false;
+    }
+
+    for ( std::map<sc_signal_channel*, bool>::iterator it = regular.begin();
+          it != regular.end(); ++it )
+    {
+        it->first->m_eager_update = it->second;
+    }
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,138 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_method_levelizer.h -- Levelized execution of method process networks.
+
+  At the start of simulation, the static sensitivity of the method
+  processes is used to determine which method processes read a signal.
+  The processes writing a signal are observed during the simulation: the
+  update requests issued while a method process is executed are its
+  writes. Method processes that are not part of a cycle of the resulting
+  graph get a level, which is larger than the level of all processes
+  writing their inputs. The levels are recomputed whenever a new writer
+  of a signal is observed.
+
+  During the evaluation phase, the runnable levelized method processes are
+  executed in the order of their levels. The signals written by them are
+  updated right after their execution, and the processes sensitive to them
+  are triggered within the same delta cycle. Method processes in cycles,
+  and signals that are accessed by modules with thread processes, keep the
+  regular evaluate-update semantics.
+
+  FOR INTERNAL USE ONLY!
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_METHOD_LEVELIZER_H_INCLUDED_
+#define SC_METHOD_LEVELIZER_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/communication/sc_writer_policy.h"
+
+#include <map>
+#include <vector>
+
+namespace sc_core {
+
+class sc_event;
+class sc_method_process;
+class sc_prim_channel;
+class sc_signal_channel;
+class sc_simcontext;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_method_levelizer
+//
+//  Executes the runnable method processes in topological order and
+//  settles acyclic method networks within a single delta cycle.
+// ----------------------------------------------------------------------------
+
+class sc_method_levelizer
+{
+    friend class sc_simcontext;
+
+private:
+
+    // a method process taking part in the levelization
+    struct node
+    {
+        sc_method_process*            method_p;
+        std::vector<sc_prim_channel*> writes; // observed, sorted.
+    };
+
+    typedef std::vector<sc_method_process*>                     method_vec;
+    typedef std::map<sc_prim_channel*, std::vector<std::size_t> > reader_map;
+    typedef std::map<sc_prim_channel*, sc_method_process*>        output_map;
+
+    explicit sc_method_levelizer( sc_simcontext& simc );
+    ~sc_method_levelizer();
+
+    // collect the method processes and their inputs
+    void start_simulation();
+
+    // execute the runnable method processes, false if an error occurred
+    bool run_methods( bool& empty_eval_phase );
+
+    bool execute( sc_method_process* );
+    void observe_updates( node&, sc_prim_channel* mark_p );
+    void queue( sc_method_process* );
+    void requeue();
+    void relevelize();
+
+    // collect the edge events of a signal, false if of another type
+    template< sc_writer_policy POL >
+    static bool bool_events( sc_signal_channel*, std::vector<sc_event*>&,
+                             bool& regular );
+    template< sc_writer_policy POL >
+    static bool logic_events( sc_signal_channel*, std::vector<sc_event*>& );
+
+private:
+    sc_simcontext*          m_simc;
+    std::vector<node>       m_nodes;
+    reader_map              m_readers;    // nodes sensitive to a channel.
+    output_map              m_outputs;    // sole method behind an sc_out.
+    bool                    m_relevelize; // a new writer was observed.
+    std::vector<method_vec> m_levels;     // queued methods per level.
+    method_vec              m_batch;      // level being executed.
+    std::size_t             m_lowest;     // lowest level with entries.
+    std::size_t             m_queued;     // number of queued methods.
+    std::vector<sc_event*>  m_triggered;  // scratch list.
+
+private:
+    // disabled
+    sc_method_levelizer( const sc_method_levelizer& );
+    sc_method_levelizer& operator = ( const sc_method_levelizer& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_METHOD_LEVELIZER_H_INCLUDED_
+// Taf!
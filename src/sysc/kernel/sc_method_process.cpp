@@ -307,7 +307,8 @@ sc_method_process::sc_method_process( const char* name_p,
     sc_process_b(
         name_p ? name_p : sc_gen_unique_name("method_p"),
         false, free_host, method_p, host_p, opt_p),
-	m_cor(0), m_stack_size(0), m_monitor_q()
+	m_cor(0), m_stack_size(0), m_monitor_q(), m_partition(-1),
+	m_level(-1), m_level_node(-1), m_level_queued(false)
 {
 
     // CHECK IF THIS IS AN sc_module-BASED PROCESS AND SIMUALTION HAS STARTED:
@@ -325,6 +326,7 @@ sc_method_process::sc_method_process( const char* name_p,
     m_process_kind = SC_METHOD_PROC_;
     if (opt_p) {
         m_dont_init = opt_p->m_dont_initialize;
+        m_partition = opt_p->m_partition;
 
         // traverse event sensitivity list
         for (unsigned int i = 0; i < opt_p->m_sensitive_events.size(); i++) {
@@ -47,6 +47,7 @@
 #include "sysc/kernel/sc_cor.h"
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_except.h"
+#include "sysc/kernel/sc_kernel_profiler.h"
 
 
 // DEBUGGING MACROS:
@@ -107,6 +108,8 @@ class sc_method_process : public sc_process_b {
     friend void sc_set_stack_size( sc_method_handle, std::size_t );
     friend class sc_event;
     friend class sc_module;
+    friend class sc_method_levelizer;
+    friend class sc_parallel_evaluator;
     friend class sc_process_table;
     friend class sc_process_handle;
     friend class sc_simcontext;
@@ -172,6 +175,10 @@ class sc_method_process : public sc_process_b {
     sc_cor*                          m_cor;        // Thread's coroutine.
     std::size_t                      m_stack_size; // Thread stack size.
     std::vector<sc_process_monitor*> m_monitor_q;  // Thread monitors.
+    int                              m_partition;  // -1 if none.
+    int                              m_level;      // -1 if not levelized.
+    int                              m_level_node; // -1 if not observed.
+    bool                             m_level_queued; // by the levelizer.
 
   private:
     // may not be deleted manually (called from sc_process_b)
@@ -219,7 +226,7 @@ void
 sc_method_process::next_trigger( const sc_time& t )
 {
     clear_trigger();
-    m_timeout_event_p->notify_internal( t );
+    m_timeout_event_p->notify_internal( t, m_timeout_slot_p );
     m_timeout_event_p->add_dynamic( this );
     m_trigger_type = TIMEOUT;
 }
@@ -229,7 +236,7 @@ void
 sc_method_process::next_trigger( const sc_time& t, const sc_event& e )
 {
     clear_trigger();
-    m_timeout_event_p->notify_internal( t );
+    m_timeout_event_p->notify_internal( t, m_timeout_slot_p );
     m_timeout_event_p->add_dynamic( this );
     e.add_dynamic( this );
     m_event_p = &e;
@@ -241,7 +248,7 @@ void
 sc_method_process::next_trigger( const sc_time& t, const sc_event_or_list& el )
 {
     clear_trigger();
-    m_timeout_event_p->notify_internal( t );
+    m_timeout_event_p->notify_internal( t, m_timeout_slot_p );
     m_timeout_event_p->add_dynamic( this );
     el.add_dynamic( this );
     m_event_list_p = &el;
@@ -253,7 +260,7 @@ void
 sc_method_process::next_trigger( const sc_time& t, const sc_event_and_list& el )
 {
     clear_trigger();
-    m_timeout_event_p->notify_internal( t );
+    m_timeout_event_p->notify_internal( t, m_timeout_slot_p );
     m_timeout_event_p->add_dynamic( this );
     el.add_dynamic( this );
     m_event_list_p = &el;
@@ -298,6 +305,7 @@ inline bool sc_method_process::run_process()
     // Execute this object instance's semantics and catch any exceptions that
     // are generated:
 
+    if ( SC_UNLIKELY_(m_profile_p) ) m_profile_p->begin( false );
     bool restart = false;
     do {
         try {
@@ -313,10 +321,12 @@ inline bool sc_method_process::run_process()
         catch( ... ) {
             sc_report* err_p = sc_handle_exception();
             simcontext()->set_error( err_p );
+            if ( SC_UNLIKELY_(m_profile_p) ) m_profile_p->end();
             return false;
         }
     } while( restart );
 
+    if ( SC_UNLIKELY_(m_profile_p) ) m_profile_p->end();
     return true;
 }
 
@@ -373,6 +373,13 @@ sc_module::gen_unique_name( const char* basename_, bool preserve_first )
     return m_name_gen->gen_unique_name( basename_, preserve_first );
 }
 
+int
+sc_module::gen_unique_names( const char* basename_, int n_ )
+{
+    if( !m_name_gen ) m_name_gen = new sc_name_gen;
+    return m_name_gen->gen_unique_names( basename_, n_ );
+}
+
 
 // called by construction_done 
 
@@ -442,6 +449,16 @@ sc_module::simulation_done()
     end_of_simulation();
 }
 
+// called by sc_save_checkpoint and sc_restore_checkpoint (does nothing)
+
+void
+sc_module::save_state( std::ostream& ) const
+{}
+
+void
+sc_module::restore_state( std::istream& )
+{}
+
 void
 sc_module::set_stack_size( std::size_t size )
 {
@@ -464,6 +481,28 @@ sc_module::set_stack_size( std::size_t size )
     }
 }
 
+void
+sc_module::set_partition( int partition )
+{
+    sc_process_handle  proc_h(
+    	sc_is_running() ?
+	sc_get_current_process_handle() :
+	sc_get_last_created_process_handle()
+    );
+    sc_method_handle method_h;  // Current process as method.
+
+
+    method_h = (sc_method_handle)proc_h;
+    if ( method_h )
+    {
+	method_h->m_partition = partition < 0 ? -1 : partition;
+    }
+    else
+    {
+	SC_REPORT_WARNING( SC_ID_SET_PARTITION_, 0 );
+    }
+}
+
 
 int
 sc_module::append_port( sc_port_base* port_ )
@@ -32,6 +32,7 @@
 #define SC_MODULE_H
 
 #include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_coro_process.h"
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_module_name.h"
 #include "sysc/kernel/sc_sensitive.h"
@@ -79,6 +80,7 @@ extern SC_API const sc_bind_proxy SC_BIND_PROXY_NIL;
 class SC_API sc_module
 : public sc_object, public sc_process_host
 {
+    friend class sc_checkpoint;
     friend class sc_module_name;
     friend class sc_module_registry;
     friend class sc_object;
@@ -93,6 +95,7 @@ public:
 
     // to generate unique names for objects in an MT-Safe way
     const char* gen_unique_name( const char* basename_, bool preserve_first );
+    int gen_unique_names( const char* basename_, int n_ );
 
     virtual const char* kind() const
         { return "sc_module"; }
@@ -119,6 +122,12 @@ protected:
 
     void simulation_done();
 
+    // called by sc_save_checkpoint (saves nothing by default)
+    virtual void save_state( std::ostream& ) const;
+
+    // called by sc_restore_checkpoint with the state saved by save_state
+    virtual void restore_state( std::istream& );
+
     void sc_module_init();
 
     // constructor
@@ -298,6 +307,10 @@ protected:
     // Function to set the stack size of the current (c)thread process.
     void set_stack_size( std::size_t );
 
+    // Function to set the parallel evaluation partition of the current
+    // method process.
+    void set_partition( int );
+
     int append_port( sc_port_base* );
 
 private:
@@ -463,6 +476,27 @@ extern SC_API sc_module* sc_module_dynalloc(sc_module*);
                             SC_CURRENT_USER_MODULE,                           \
                             func )
 
+#if defined(SC_HAS_COROUTINES_)
+
+#define declare_coro_thread_process(handle, name, host_tag, func)   \
+    {                                                               \
+        ::sc_core::sc_process_handle handle =                      \
+             ::sc_core::sc_spawn(                                  \
+                 [this]() { return static_cast<host_tag*>(this)->func(); }, \
+                 name ); \
+        this->sensitive << handle;                                        \
+        this->sensitive_pos << handle;                                    \
+        this->sensitive_neg << handle;                                    \
+    }
+
+#define SC_CORO_THREAD(func)                                                  \
+    declare_coro_thread_process( func ## _handle,                             \
+                                 #func,                                       \
+                                 SC_CURRENT_USER_MODULE,                      \
+                                 func )
+
+#endif // SC_HAS_COROUTINES_
+
 
 
 // ----------------------------------------------------------------------------
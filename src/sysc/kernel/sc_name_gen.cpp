@@ -81,6 +81,25 @@ sc_name_gen::gen_unique_name( const char* basename_, bool preserve_first )
     return m_unique_name.c_str();
 }
 
+int
+sc_name_gen::gen_unique_names( const char* basename_, int n_ )
+{
+    if( basename_ == 0 || *basename_ == 0 ) {
+        SC_REPORT_ERROR( SC_ID_GEN_UNIQUE_NAME_, 0 );
+        basename_ = "unnamed"; // usually not reached
+    }
+    int* c = m_unique_name_map[basename_];
+    if( c == 0 ) {
+        c = new int( n_ - 1 );
+        m_unique_name_map.insert( const_cast<char*>( basename_ ), c );
+        return 0;
+    } else {
+        int first = *c + 1;
+        *c += n_;
+        return first;
+    }
+}
+
 } // namespace sc_core
 
 // $Log: sc_name_gen.cpp,v $
@@ -51,6 +51,10 @@ public:
     const char* gen_unique_name( const char* basename_,
                                  bool preserve_first = false );
 
+    // reserve the n_ names basename__<k> ... basename__<k+n_-1> that n_
+    // calls of gen_unique_name( basename_ ) would return, and return k
+    int gen_unique_names( const char* basename_, int n_ );
+
 private:
 
     sc_strhash<int*> m_unique_name_map;
@@ -83,9 +83,8 @@ sc_object::add_child_object( sc_object* object_ )
 const char*
 sc_object::basename() const
 {
-    std::size_t pos; // position of last SC_HIERARCHY_CHAR.
-    pos = m_name.rfind( (char)SC_HIERARCHY_CHAR );
-    return ( pos == m_name.npos ) ? m_name.c_str() : &(m_name.c_str()[pos+1]);
+    const char* p = std::strrchr( m_name, SC_HIERARCHY_CHAR );
+    return p ? (p + 1) : m_name;
 } 
 
 void
@@ -138,11 +137,11 @@ sc_object::remove_child_event( sc_event* event_p )
 bool
 sc_object::remove_child_object( sc_object* object_p )
 {
-    int size = m_child_objects.size();
-    for( int i = 0; i < size; ++ i ) {
+    // search from the back and keep the order, children are mostly deleted
+    // in the reverse order of their creation (e.g., by sc_vector)
+    for( int i = m_child_objects.size() - 1; i >= 0; -- i ) {
         if( object_p == m_child_objects[i] ) {
-            m_child_objects[i] = m_child_objects[size - 1];
-            m_child_objects.pop_back();
+            m_child_objects.erase( m_child_objects.begin() + i );
 	    object_p->m_parent = NULL;
             return true;
         }
@@ -173,8 +172,14 @@ sc_object::sc_object_init(const char* nm)
 
     // CONSTRUCT PATHNAME TO OBJECT BEING CREATED: 
 
+    // The name is kept in a single pooled buffer, which the object manager
+    // refers to instead of holding a copy.
+
     sc_assert( nm );
-    m_name = object_manager->create_name(nm);
+    std::string name = object_manager->create_name(nm);
+    char* name_p = static_cast<char*>( sc_mempool::allocate(name.size()+1) );
+    std::memcpy( name_p, name.c_str(), name.size()+1 );
+    m_name = name_p;
 
 
     // PLACE THE OBJECT INTO THE HIERARCHY
@@ -187,14 +192,14 @@ sc_object::sc_object_init(const char* nm)
 } 
 
 sc_object::sc_object() : 
-    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(),
+    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(0),
     m_parent(0), m_simc(0)
 {
     sc_object_init( sc_gen_unique_name("object") );
 }
 
 sc_object::sc_object( const sc_object& that ) : 
-    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(),
+    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(0),
     m_parent(0), m_simc(0)
 {
     sc_object_init( sc_gen_unique_name( that.basename() ) );
@@ -208,7 +213,7 @@ object_name_illegal_char(char ch)
 }
 
 sc_object::sc_object(const char* nm) : 
-    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(),
+    m_attr_cltn_p(0), m_child_events(), m_child_objects(), m_name(0),
     m_parent(0), m_simc(0)
 {
     int namebuf_alloc = 0;
@@ -258,6 +263,8 @@ sc_object::~sc_object()
 #endif
     detach();
     delete m_attr_cltn_p;
+    if ( m_name )
+        sc_mempool::release( const_cast<char*>(m_name), std::strlen(m_name)+1 );
 }
 
 //------------------------------------------------------------------------------
@@ -273,7 +280,7 @@ void sc_object::detach()
         // REMOVE OBJECT FROM THE OBJECT MANAGER:
 
         sc_object_manager* object_manager = m_simc->get_object_manager();
-        object_manager->remove_object(m_name);
+        object_manager->remove_object(m_name, this);
 
 		// REMOVE OBJECT FROM PARENT'S LIST OF OBJECTS:
 
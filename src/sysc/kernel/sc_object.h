@@ -71,7 +71,7 @@ public:
     typedef unsigned phase_cb_mask;
 
     const char* name() const
-        { return m_name.c_str(); }
+        { return m_name; }
 
     const char* basename() const;
 
@@ -152,7 +152,7 @@ private:
     mutable sc_attr_cltn*   m_attr_cltn_p;   // attributes for this object.
     std::vector<sc_event*>  m_child_events;  // list of child events.
     std::vector<sc_object*> m_child_objects; // list of child objects.
-    std::string             m_name;          // name of this object.
+    const char*             m_name;          // name of this object.
     sc_object*              m_parent;        // parent for this object.
     sc_simcontext*          m_simc;          // simcontext ptr / empty indicator
 };
@@ -33,6 +33,7 @@
 #include <cctype>
 #include <cstddef>
 #include <cctype>
+#include <cstring>
 #include <algorithm> // pick up std::sort.
 
 #include "sysc/kernel/sc_object.h"
@@ -49,6 +50,23 @@
 
 namespace sc_core {
 
+// FNV-1a hash of a name in the instance table.
+
+static inline unsigned
+hash_name(const char* name)
+{
+    unsigned hash = 2166136261u;
+    for ( ; *name; ++name )
+        hash = (hash ^ static_cast<unsigned char>(*name)) * 16777619u;
+    return hash;
+}
+
+static bool
+object_name_less(const sc_object* a_p, const sc_object* b_p)
+{
+    return std::strcmp(a_p->name(), b_p->name()) < 0;
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_object_manager
 //
@@ -56,11 +74,11 @@ namespace sc_core {
 // ----------------------------------------------------------------------------
 
 sc_object_manager::sc_object_manager() :
-    m_event_it(),
-    m_event_walk_ok(0),
+    m_instance_n(0),
     m_instance_table(),
     m_module_name_stack(0),
-    m_object_it(),
+    m_object_walk(),
+    m_object_walk_i(0),
     m_object_stack(),
     m_object_walk_ok()
 {
@@ -71,17 +89,18 @@ sc_object_manager::sc_object_manager() :
 // | 
 // | This is the object instance destructor for this class. It goes through
 // | each sc_object instance in the instance table and sets its m_simc field
-// | to NULL.
+// | to NULL, and deletes the copies of the external names.
 // +----------------------------------------------------------------------------
 sc_object_manager::~sc_object_manager()
 {
-    instance_table_t::iterator it;     // instance table iterator.
-
-    for ( it = m_instance_table.begin(); it != m_instance_table.end(); it++) 
+    for ( std::size_t i = 0; i < m_instance_table.size(); i++ )
     {
-        if(it->second.m_name_origin == SC_NAME_OBJECT) {
-            sc_object* obj_p = static_cast<sc_object*>(it->second.m_element_p);
+        table_entry& entry = m_instance_table[i];
+        if(entry.m_name_origin == SC_NAME_OBJECT) {
+            sc_object* obj_p = static_cast<sc_object*>(entry.m_element_p);
             obj_p->m_simc = 0;
+        } else if(entry.m_name_origin == SC_NAME_EXTERNAL) {
+            delete [] const_cast<char*>(entry.m_name);
         }
     }
 }
@@ -99,59 +118,39 @@ sc_object_manager::~sc_object_manager()
 // +----------------------------------------------------------------------------
 std::string sc_object_manager::create_name(const char* leaf_name) 
 { 
-    bool        clash;                  // true if path name exists in obj table
-    std::string leafname_string;        // string containing the leaf name.
-    std::string parentname_string;      // parent path name 
     sc_object*  parent_p;               // parent for this instance or NULL.
-    std::string result_orig_string;     // save for warning message.
     std::string result_string;          // name to return.
- 
+    std::size_t prefix_n;               // length of the parent path name.
+
     // CONSTRUCT PATHNAME TO THE NAME TO BE RETURNED:
-    // 
-    // If there is not a leaf name generate one. 
 
     parent_p = sc_get_curr_simcontext()->active_object();
-    parentname_string = parent_p ? parent_p->name() : ""; 
-    leafname_string = leaf_name; 
     if (parent_p) {
-        result_string = parentname_string;
-	result_string += SC_HIERARCHY_CHAR;
-	result_string += leafname_string;
-    } else { 
-        result_string = leafname_string;
-    } 
-
-    // SAVE the original path name 
-
-    result_orig_string = result_string;
+        result_string = parent_p->name();
+        result_string += SC_HIERARCHY_CHAR;
+    }
+    prefix_n = result_string.size();
+    result_string += leaf_name;
 
     // MAKE SURE THE ENTITY NAME IS UNIQUE:
     // 
     // If not use unique name generator to make it unique. 
 
-    clash = false; 
-    for (;;)
-    {
-	    if ( !name_exists(result_string) )
-	    {
-	        break;
-	    }
-        clash = true; 
+    if ( !name_exists(result_string) )
+        return result_string;
+
+    std::string result_orig_string = result_string; // for warning message.
+    std::string leafname_string = leaf_name;
+    do {
         leafname_string = sc_gen_unique_name(leafname_string.c_str(), false); 
-	if (parent_p) {
-	    result_string = parentname_string;
-	    result_string += SC_HIERARCHY_CHAR;
-	    result_string += leafname_string;
-	} else { 
-	    result_string = leafname_string;
-	} 
-    } 
-    if (clash) { 
-	std::string message = result_orig_string;
-	message += ". Latter declaration will be renamed to ";
-	message += result_string;
-        SC_REPORT_WARNING( SC_ID_INSTANCE_EXISTS_, message.c_str());
-    } 
+        result_string.resize(prefix_n);
+        result_string += leafname_string;
+    } while ( name_exists(result_string) );
+
+    std::string message = result_orig_string;
+    message += ". Latter declaration will be renamed to ";
+    message += result_string;
+    SC_REPORT_WARNING( SC_ID_INSTANCE_EXISTS_, message.c_str());
 
     return result_string;
 }
@@ -169,9 +168,7 @@ std::string sc_object_manager::create_name(const char* leaf_name)
 bool
 sc_object_manager::name_exists(const std::string& name)
 {
-    instance_table_t::const_iterator it = m_instance_table.find(name);
-    return (it != m_instance_table.end()) &&
-           (it->second.m_name_origin != SC_NAME_NONE);
+    return find_entry(name.c_str()) != NULL;
 }
 
 // +----------------------------------------------------------------------------
@@ -187,12 +184,67 @@ sc_object_manager::name_exists(const std::string& name)
 const char*
 sc_object_manager::get_name(const std::string& name)
 {
-    instance_table_t::iterator it = m_instance_table.find(name);
-    if (it != m_instance_table.end() &&
-        it->second.m_name_origin != SC_NAME_NONE) {
-        return it->first.c_str();
-    } else {
-        return NULL;
+    table_entry* entry_p = find_entry(name.c_str());
+    return entry_p ? entry_p->m_name : NULL;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::erase_entry"
+// | 
+// | This method removes an entry from the instance table. The following
+// | entries of its probe sequence are moved back, so lookups never have to
+// | skip removed entries.
+// |
+// | Arguments:
+// |     entry_p -> entry to be removed.
+// +----------------------------------------------------------------------------
+void
+sc_object_manager::erase_entry(table_entry* entry_p)
+{
+    std::size_t mask = m_instance_table.size() - 1;
+    std::size_t free_i = entry_p - &m_instance_table[0];
+    std::size_t entry_i = free_i;
+    for (;;)
+    {
+        entry_i = (entry_i + 1) & mask;
+        table_entry& entry = m_instance_table[entry_i];
+        if ( !entry.m_name ) break;
+
+        // move the entry into the free slot unless its home slot lies
+        // cyclically after the free slot
+        std::size_t home_i = entry.m_hash & mask;
+        if ( ((entry_i - home_i) & mask) >= ((entry_i - free_i) & mask) )
+        {
+            m_instance_table[free_i] = entry;
+            free_i = entry_i;
+        }
+    }
+    m_instance_table[free_i] = table_entry();
+    m_instance_n--;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::find_entry"
+// | 
+// | This method returns the instance table entry with the supplied name, or
+// | NULL if the name is not in the table.
+// |
+// | Arguments:
+// |     name = name of the element
+// +----------------------------------------------------------------------------
+sc_object_manager::table_entry*
+sc_object_manager::find_entry(const char* name)
+{
+    if ( m_instance_n == 0 ) return NULL;
+
+    unsigned    hash = hash_name(name);
+    std::size_t mask = m_instance_table.size() - 1;
+    for ( std::size_t i = hash & mask; ; i = (i + 1) & mask )
+    {
+        table_entry& entry = m_instance_table[i];
+        if ( !entry.m_name ) return NULL;
+        if ( entry.m_hash == hash && std::strcmp(entry.m_name, name) == 0 )
+            return &entry;
     }
 }
 
@@ -209,12 +261,10 @@ sc_object_manager::get_name(const std::string& name)
 sc_event*
 sc_object_manager::find_event(const char* name)
 {
-    instance_table_t::iterator it;
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EVENT)
+    table_entry* entry_p = find_entry(name);
+    if(entry_p && entry_p->m_name_origin == SC_NAME_EVENT)
     {
-        return static_cast<sc_event*>(it->second.m_element_p);
+        return static_cast<sc_event*>(entry_p->m_element_p);
     } else {
         return NULL;
     }
@@ -233,12 +283,10 @@ sc_object_manager::find_event(const char* name)
 sc_object*
 sc_object_manager::find_object(const char* name)
 {
-    instance_table_t::iterator it;
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_OBJECT)
+    table_entry* entry_p = find_entry(name);
+    if(entry_p && entry_p->m_name_origin == SC_NAME_OBJECT)
     {
-        return static_cast<sc_object*>(it->second.m_element_p);
+        return static_cast<sc_object*>(entry_p->m_element_p);
     } else {
         return NULL;
     }
@@ -248,26 +296,56 @@ sc_object_manager::find_object(const char* name)
 // +----------------------------------------------------------------------------
 // |"sc_object_manager::first_object"
 // | 
-// | This method initializes the object iterator to point to the first object
-// | in the instance table, and returns its address. If there are no objects
-// | in the table a NULL value is returned.
+// | This method collects the objects of the instance table in the order of
+// | their names, and returns the address of the first one. If there are no
+// | objects in the table a NULL value is returned.
 // +----------------------------------------------------------------------------
 sc_object*
 sc_object_manager::first_object()
 {
-    sc_object* result_p; // result to return.
+    m_object_walk.clear();
+    for ( std::size_t i = 0; i < m_instance_table.size(); i++ )
+    {
+        if(m_instance_table[i].m_name_origin == SC_NAME_OBJECT) {
+            m_object_walk.push_back(
+              static_cast<sc_object*>(m_instance_table[i].m_element_p) );
+        }
+    }
+    std::sort( m_object_walk.begin(), m_object_walk.end(), object_name_less );
 
     m_object_walk_ok = true;
-    result_p = NULL;
-    for ( m_object_it = m_instance_table.begin(); 
-          m_object_it != m_instance_table.end(); 
-	  m_object_it++ )
+    m_object_walk_i = 0;
+    return m_object_walk.empty() ? NULL : m_object_walk[0];
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::grow_table"
+// | 
+// | This method grows the instance table by powers of two until it can hold
+// | the supplied number of entries, and reinserts its entries.
+// |
+// | Arguments:
+// |     entry_n = number of entries the table must hold.
+// +----------------------------------------------------------------------------
+void
+sc_object_manager::grow_table(std::size_t entry_n)
+{
+    std::size_t size = m_instance_table.empty() ? 64 : m_instance_table.size();
+    while ( 2 * entry_n > size ) size *= 2;
+    if ( size == m_instance_table.size() ) return;
+
+    instance_table_t old_table( size );
+    old_table.swap( m_instance_table );
+
+    std::size_t mask = m_instance_table.size() - 1;
+    for ( std::size_t old_i = 0; old_i < old_table.size(); old_i++ )
     {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
-        }
+        const table_entry& entry = old_table[old_i];
+        if ( !entry.m_name ) continue;
+        std::size_t i = entry.m_hash & mask;
+        while ( m_instance_table[i].m_name ) i = (i + 1) & mask;
+        m_instance_table[i] = entry;
     }
-    return result_p;
 }
 
 // +----------------------------------------------------------------------------
@@ -344,17 +422,20 @@ sc_object_manager::hierarchy_size()
 bool
 sc_object_manager::insert_external_name(const std::string& name)
 {
-    if(!name_exists(name)) {
-        m_instance_table[name].m_element_p = NULL;
-        m_instance_table[name].m_name_origin = SC_NAME_EXTERNAL;
+    table_entry* entry_p = find_entry(name.c_str());
+    if(!entry_p) {
+        char* name_copy = new char[name.size() + 1];
+        std::strcpy(name_copy, name.c_str());
+        entry_p = insert_entry(name_copy);
+        entry_p->m_element_p = NULL;
+        entry_p->m_name_origin = SC_NAME_EXTERNAL;
         return true;
     } else {
-        table_entry element = m_instance_table[name];
         std::stringstream msg;
         msg << name << " ("
-            << ((element.m_name_origin == SC_NAME_OBJECT)
-                ? (static_cast<sc_object*>(element.m_element_p))->kind()
-                : (element.m_name_origin == SC_NAME_EVENT)
+            << ((entry_p->m_name_origin == SC_NAME_OBJECT)
+                ? (static_cast<sc_object*>(entry_p->m_element_p))->kind()
+                : (entry_p->m_name_origin == SC_NAME_EVENT)
                     ? "event" : "external name")
             << ")";
         SC_REPORT_WARNING( SC_ID_NAME_EXISTS_, msg.str().c_str());
@@ -362,63 +443,93 @@ sc_object_manager::insert_external_name(const std::string& name)
     }
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::insert_entry"
+// | 
+// | This method returns the instance table entry with the supplied name,
+// | after adding an entry without element if the name is not in the table.
+// | The name is not copied, it must live as long as the entry.
+// |
+// | Arguments:
+// |     name = name of the element
+// +----------------------------------------------------------------------------
+sc_object_manager::table_entry*
+sc_object_manager::insert_entry(const char* name)
+{
+    table_entry* entry_p = find_entry(name);
+    if ( entry_p ) return entry_p;
+
+    // keep the table at most half full
+    if ( 2 * (m_instance_n + 1) > m_instance_table.size() )
+        grow_table( m_instance_n + 1 );
+
+    unsigned    hash = hash_name(name);
+    std::size_t mask = m_instance_table.size() - 1;
+    std::size_t i = hash & mask;
+    while ( m_instance_table[i].m_name ) i = (i + 1) & mask;
+    entry_p = &m_instance_table[i];
+    entry_p->m_name = name;
+    entry_p->m_hash = hash;
+    m_instance_n++;
+    return entry_p;
+}
+
 // +----------------------------------------------------------------------------
 // |"sc_object_manager::insert_event"
 // | 
 // | This method inserts the supplied sc_event instance into the instance
-// | table using the supplied name.
+// | table using the supplied name, which must live as long as the event.
 // |
 // | Arguments:
 // |     name    =  name of the event to be inserted.
 // |     event_p -> event to be inserted.
 // +----------------------------------------------------------------------------
 void
-sc_object_manager::insert_event(const std::string& name, sc_event* event_p)
+sc_object_manager::insert_event(const char* name, sc_event* event_p)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(event_p);
-    m_instance_table[name].m_name_origin = SC_NAME_EVENT;
+    table_entry* entry_p = insert_entry(name);
+    if(entry_p->m_name_origin == SC_NAME_EXTERNAL)
+        delete [] const_cast<char*>(entry_p->m_name);
+    entry_p->m_name = name;
+    entry_p->m_element_p = static_cast<void*>(event_p);
+    entry_p->m_name_origin = SC_NAME_EVENT;
 }
 
 // +----------------------------------------------------------------------------
 // |"sc_object_manager::insert_object"
 // | 
 // | This method inserts the supplied sc_object instance into the instance
-// | table using the supplied name.
+// | table using the supplied name, which must live as long as the object.
 // |
 // | Arguments:
-// |     name     =  name of the event to be inserted.
+// |     name     =  name of the object to be inserted.
 // |     object_p -> object to be inserted.
 // +----------------------------------------------------------------------------
 void
-sc_object_manager::insert_object(const std::string& name, sc_object* object_p)
+sc_object_manager::insert_object(const char* name, sc_object* object_p)
 {
-    m_instance_table[name].m_element_p = static_cast<void*>(object_p);
-    m_instance_table[name].m_name_origin = SC_NAME_OBJECT;
+    table_entry* entry_p = insert_entry(name);
+    if(entry_p->m_name_origin == SC_NAME_EXTERNAL)
+        delete [] const_cast<char*>(entry_p->m_name);
+    entry_p->m_name = name;
+    entry_p->m_element_p = static_cast<void*>(object_p);
+    entry_p->m_name_origin = SC_NAME_OBJECT;
 }
 
 // +----------------------------------------------------------------------------
 // |"sc_object_manager::next_object"
 // | 
-// | This method returns the next object pointed to by the instance iterator.
+// | This method returns the next object of the walk started by first_object.
 // +----------------------------------------------------------------------------
 sc_object*
 sc_object_manager::next_object()
 {
-    sc_object* result_p; // result to return.
-
     sc_assert( m_object_walk_ok );
 
-    if ( m_object_it == m_instance_table.end() ) return NULL;
-    m_object_it++;
-
-    for ( result_p = NULL; m_object_it != m_instance_table.end(); 
-	  m_object_it++ )
-    {
-        if(m_object_it->second.m_name_origin == SC_NAME_OBJECT) {
-            return static_cast<sc_object*>(m_object_it->second.m_element_p);
-        }
-    }
-    return result_p;
+    if ( m_object_walk_i >= m_object_walk.size() ) return NULL;
+    m_object_walk_i++;
+    return m_object_walk_i < m_object_walk.size()
+           ? m_object_walk[m_object_walk_i] : NULL;
 }
 
 // +----------------------------------------------------------------------------
@@ -472,18 +583,17 @@ sc_object_manager::top_of_module_name_stack()
 // | the table of instances.
 // |
 // | Arguments:
-// |     name = name of the event to be removed.
+// |     name    = name of the event to be removed.
+// |     event_p -> event to be removed.
 // +----------------------------------------------------------------------------
 void
-sc_object_manager::remove_event(const std::string& name)
+sc_object_manager::remove_event(const char* name, sc_event* event_p)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EVENT)
+    table_entry* entry_p = find_entry(name);
+    if(entry_p && entry_p->m_name_origin == SC_NAME_EVENT
+       && entry_p->m_element_p == event_p)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        erase_entry(entry_p);
     }
 }
 
@@ -494,18 +604,17 @@ sc_object_manager::remove_event(const std::string& name)
 // | the table of instances.
 // |
 // | Arguments:
-// |     name = name of the object to be removed.
+// |     name     = name of the object to be removed.
+// |     object_p -> object to be removed.
 // +----------------------------------------------------------------------------
 void
-sc_object_manager::remove_object(const std::string& name)
+sc_object_manager::remove_object(const char* name, sc_object* object_p)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_OBJECT)
+    table_entry* entry_p = find_entry(name);
+    if(entry_p && entry_p->m_name_origin == SC_NAME_OBJECT
+       && entry_p->m_element_p == object_p)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        erase_entry(entry_p);
     }
 }
 
@@ -521,19 +630,33 @@ sc_object_manager::remove_object(const std::string& name)
 bool
 sc_object_manager::remove_external_name(const std::string& name)
 {
-    instance_table_t::iterator it;     // instance table iterator.
-    it = m_instance_table.find(name);
-    if(it != m_instance_table.end()
-       && it->second.m_name_origin == SC_NAME_EXTERNAL)
+    table_entry* entry_p = find_entry(name.c_str());
+    if(entry_p && entry_p->m_name_origin == SC_NAME_EXTERNAL)
     {
-        it->second.m_element_p = NULL;
-        it->second.m_name_origin = SC_NAME_NONE;
+        char* name_copy = const_cast<char*>(entry_p->m_name);
+        erase_entry(entry_p);
+        delete [] name_copy;
         return true;
     } else {
         return false;
     }
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_object_manager::reserve"
+// | 
+// | This method makes room in the instance table for the supplied number of
+// | further entries, so that adding them does not grow the table again.
+// |
+// | Arguments:
+// |     entry_n = number of entries that are about to be added.
+// +----------------------------------------------------------------------------
+void
+sc_object_manager::reserve(std::size_t entry_n)
+{
+    grow_table( m_instance_n + entry_n );
+}
+
 } // namespace sc_core
 
 // $Log: sc_object_manager.cpp,v $
@@ -30,7 +30,8 @@
 #ifndef SC_OBJECT_MANAGER_H
 #define SC_OBJECT_MANAGER_H
 
-#include <map>
+#include <cstddef>
+#include <string>
 #include <vector>
 
 namespace sc_core {
@@ -63,14 +64,21 @@ protected:
 
     struct table_entry
     {
-        table_entry() : m_element_p(NULL), m_name_origin(SC_NAME_NONE) {}
-
-	    void*          m_element_p; // can be an sc_object or an sc_event
+        table_entry()
+          : m_name(NULL), m_hash(0), m_element_p(NULL)
+          , m_name_origin(SC_NAME_NONE)
+        {}
+
+        const char*    m_name;      // name of the element, null if free.
+        unsigned       m_hash;      // hash of m_name.
+        void*          m_element_p; // can be an sc_object or an sc_event
         sc_name_origin m_name_origin;
     };
 
 public:
-    typedef std::map<std::string,table_entry> instance_table_t;
+    // open addressing hash table, the names are not copied: they are owned
+    // by the objects and events, only external names are copied.
+    typedef std::vector<table_entry>          instance_table_t;
     typedef std::vector<sc_object*>           object_vector_t;
 
     sc_object_manager();
@@ -94,23 +102,31 @@ public:
     sc_module_name* pop_module_name();
     sc_module_name* top_of_module_name_stack();
 
+    // make room for entry_n further objects and events
+    void reserve(std::size_t entry_n);
+
 
 private:
     std::string create_name( const char* leaf_name );
-    void insert_event(const std::string& name, sc_event* obj);
-    void insert_object(const std::string& name, sc_object* obj);
+    void insert_event(const char* name, sc_event* obj);
+    void insert_object(const char* name, sc_object* obj);
     bool insert_external_name(const std::string& name);
-    void remove_event(const std::string& name);
-    void remove_object(const std::string& name);
+    void remove_event(const char* name, sc_event* obj);
+    void remove_object(const char* name, sc_object* obj);
     bool remove_external_name(const std::string& name);
 
+    table_entry* find_entry(const char* name);
+    table_entry* insert_entry(const char* name);
+    void erase_entry(table_entry* entry_p);
+    void grow_table(std::size_t entry_n);
+
 private:
 
-    instance_table_t::iterator m_event_it;          // event instance iterator.
-    bool                       m_event_walk_ok;     // true if can walk events.
+    std::size_t                m_instance_n;        // entries in use.
     instance_table_t           m_instance_table;    // table of instances.
     sc_module_name*            m_module_name_stack; // sc_module_name stack.
-    instance_table_t::iterator m_object_it;         // object instance iterator.
+    object_vector_t            m_object_walk;       // objects in name order.
+    std::size_t                m_object_walk_i;     // object walk position.
     object_vector_t            m_object_stack;      // sc_object stack.
     bool                       m_object_walk_ok;    // true if can walk objects.
 };
@@ -0,0 +1,735 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_parallel_evaluator.cpp -- Parallel evaluation of method processes.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_parallel_evaluator.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_method_process.h"
+#include "sysc/kernel/sc_module.h"
+#include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/communication/sc_port.h"
+#include "sysc/communication/sc_prim_channel.h"
+#include "sysc/communication/sc_signal.h"
+#include "sysc/communication/sc_signal_ports.h"
+
+#if SC_HAS_PARALLEL_EVALUATION_
+#  include "sysc/communication/sc_host_mutex.h"
+#  include "sysc/communication/sc_host_semaphore.h"
+#  if SC_CPLUSPLUS >= 201103L
+#    include <thread>
+#  else
+#    include <pthread.h>
+#  endif
+#endif
+
+#include <algorithm>
+#include <map>
+
+namespace sc_core {
+
+#if SC_HAS_PARALLEL_EVALUATION_
+
+// ----------------------------------------------------------------------------
+//  STRUCT : sc_parallel_evaluator::worker
+//
+//  The per-thread state of a worker.
+// ----------------------------------------------------------------------------
+
+struct sc_parallel_evaluator::worker
+{
+    explicit worker( sc_parallel_evaluator* evaluator_p, unsigned index )
+      : m_evaluator_p( evaluator_p ), m_index( index ), m_proc_info()
+      , m_writer_p( 0 ), m_log(), m_start( 0 ), m_thread()
+    {}
+
+    sc_parallel_evaluator*   m_evaluator_p;
+    unsigned                 m_index;
+    sc_curr_proc_info        m_proc_info;
+    sc_process_b*            m_writer_p;
+    std::vector<deferred_op> m_log;    // operations recorded by this worker.
+    sc_host_semaphore        m_start;  // posted to start an evaluation round.
+#if SC_CPLUSPLUS >= 201103L
+    std::thread              m_thread;
+#else
+    pthread_t                m_thread;
+#endif
+};
+
+// The state of the worker executing on the current host thread, or null if
+// the host thread does not take part in a parallel evaluation round.
+
+static SC_THREAD_LOCAL_ sc_parallel_evaluator::worker* curr_worker_p = 0;
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::sc_parallel_evaluator"
+// |
+// | This is the object instance constructor for this class. It starts
+// | workers - 1 host threads, the simulator thread acts as worker 0.
+// |
+// | Arguments:
+// |     simc             = simulation context this object instance serves.
+// |     workers          = number of host threads to evaluate methods on.
+// |     infer_partitions = true if partitions should be derived from the
+// |                        port bindings for methods without a partition.
+// +----------------------------------------------------------------------------
+sc_parallel_evaluator::sc_parallel_evaluator( sc_simcontext& simc,
+                                              unsigned workers,
+                                              bool infer_partitions )
+  : m_simc( &simc ), m_infer_partitions( infer_partitions ), m_workers()
+  , m_segments(), m_buckets( 4 * workers ), m_active_buckets()
+  , m_order(), m_next_bucket( 0 ), m_mutex( new sc_host_mutex )
+  , m_report_mutex( new sc_host_mutex )
+  , m_report_state_p( sc_report_handler::get_thread_state() )
+  , m_done( new sc_host_semaphore( 0 ) )
+  , m_shutdown( false )
+{
+    sc_assert( workers > 1 );
+
+    for ( unsigned worker_i = 0; worker_i < workers; worker_i++ )
+        m_workers.push_back( new worker( this, worker_i ) );
+
+    for ( unsigned worker_i = 1; worker_i < workers; worker_i++ )
+    {
+        worker* worker_p = m_workers[worker_i];
+#if SC_CPLUSPLUS >= 201103L
+        worker_p->m_thread = std::thread( &worker_main, worker_p );
+#else
+        int result = pthread_create( &worker_p->m_thread, NULL,
+                                     &worker_main, worker_p );
+        sc_assert( result == 0 );
+#endif
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::~sc_parallel_evaluator"
+// |
+// | This is the object instance destructor for this class. It terminates
+// | and joins the worker threads.
+// +----------------------------------------------------------------------------
+sc_parallel_evaluator::~sc_parallel_evaluator()
+{
+    m_shutdown = true;
+    for ( std::size_t worker_i = 1; worker_i < m_workers.size(); worker_i++ )
+        m_workers[worker_i]->m_start.post();
+
+    for ( std::size_t worker_i = 0; worker_i < m_workers.size(); worker_i++ )
+    {
+        worker* worker_p = m_workers[worker_i];
+        if ( worker_i != 0 )
+        {
+#if SC_CPLUSPLUS >= 201103L
+            worker_p->m_thread.join();
+#else
+            pthread_join( worker_p->m_thread, NULL );
+#endif
+        }
+        delete worker_p;
+    }
+    delete m_done;
+    delete m_report_mutex;
+    delete m_mutex;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::worker_main"
+// |
+// | This static method is the body of each worker thread. It executes one
+// | evaluation round each time its start semaphore is posted, in the
+// | simulation context and with the report settings of the simulator thread.
+// +----------------------------------------------------------------------------
+void*
+sc_parallel_evaluator::worker_main( void* arg_p )
+{
+    worker*                worker_p = static_cast<worker*>( arg_p );
+    sc_parallel_evaluator* this_p   = worker_p->m_evaluator_p;
+
+    sc_set_curr_simcontext( this_p->m_simc );
+    sc_report_handler::set_thread_state( this_p->m_report_state_p );
+    curr_worker_p = worker_p;
+    for (;;)
+    {
+        worker_p->m_start.wait();
+        if ( this_p->m_shutdown )
+            break;
+        this_p->execute( *worker_p );
+        this_p->m_done->post();
+    }
+    curr_worker_p = 0;
+    return NULL;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::execute"
+// |
+// | This method executes buckets of the current round until none are left.
+// +----------------------------------------------------------------------------
+void
+sc_parallel_evaluator::execute( worker& w )
+{
+    for (;;)
+    {
+        m_mutex->lock();
+        std::size_t bucket_i = m_next_bucket++;
+        m_mutex->unlock();
+
+        if ( bucket_i >= m_active_buckets.size() )
+            break;
+        execute_bucket( w, m_active_buckets[bucket_i] );
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::execute_bucket"
+// |
+// | This method executes the method processes of a bucket in run queue order.
+// | Execution of the bucket stops at the first process that raised an error.
+// +----------------------------------------------------------------------------
+void
+sc_parallel_evaluator::execute_bucket( worker& w, std::size_t bucket )
+{
+    const std::vector<std::size_t>& bucket_r = m_buckets[bucket];
+    bool                            write_check = m_simc->write_check();
+
+    for ( std::size_t seg_i = 0; seg_i < bucket_r.size(); seg_i++ )
+    {
+        segment& seg = m_segments[bucket_r[seg_i]];
+
+        w.m_proc_info.process_handle = seg.method_p;
+        w.m_proc_info.kind           = SC_METHOD_PROC_;
+        w.m_writer_p                 = write_check ? seg.method_p : 0;
+
+        seg.worker = w.m_index;
+        seg.begin  = w.m_log.size();
+        bool ok    = seg.method_p->run_process();
+        seg.end    = w.m_log.size();
+
+        if ( !ok ) break;
+    }
+    w.m_proc_info.process_handle = 0;
+    w.m_proc_info.kind           = SC_NO_PROC_;
+    w.m_writer_p                 = 0;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::run_methods"
+// |
+// | This method evaluates the method processes of the current run queue.
+// | Methods without a partition are put back on the run queue and are
+// | executed by the simulator afterwards. If the remaining methods do not
+// | span at least two buckets, all methods are put back and the round is
+// | executed sequentially.
+// |
+// | Arguments:
+// |     empty_eval_phase = set to false if any process was executed.
+// | Result is false if a process raised an error, true otherwise.
+// +----------------------------------------------------------------------------
+bool
+sc_parallel_evaluator::run_methods( bool& empty_eval_phase )
+{
+    sc_runnable* runnable_p = m_simc->m_runnable;
+
+    m_order.clear();
+    m_segments.clear();
+    for ( sc_method_handle method_h = runnable_p->pop_method(); method_h;
+          method_h = runnable_p->pop_method() )
+    {
+        m_order.push_back( method_h );
+        int bucket = bucket_of( method_h );
+        if ( bucket < 0 ) continue;
+
+        segment seg = { method_h, 0, 0, 0 };
+        if ( m_buckets[bucket].empty() )
+            m_active_buckets.push_back( bucket );
+        m_buckets[bucket].push_back( m_segments.size() );
+        m_segments.push_back( seg );
+    }
+
+    // NOT ENOUGH INDEPENDENT WORK, LET THE SIMULATOR EXECUTE THE ROUND:
+
+    if ( m_active_buckets.size() < 2 )
+    {
+        for ( std::size_t order_i = m_order.size(); order_i-- > 0; )
+            runnable_p->execute_method_next( m_order[order_i] );
+        for ( std::size_t bucket_i = 0; bucket_i < m_active_buckets.size();
+              bucket_i++ )
+            m_buckets[m_active_buckets[bucket_i]].clear();
+        m_active_buckets.clear();
+        return true;
+    }
+
+    // PUT THE METHODS WITHOUT PARTITION BACK:
+
+    for ( std::size_t order_i = m_order.size(); order_i-- > 0; )
+    {
+        if ( bucket_of( m_order[order_i] ) < 0 )
+            runnable_p->execute_method_next( m_order[order_i] );
+    }
+
+    // EXECUTE THE ROUND ON THE WORKERS:
+
+    empty_eval_phase = false;
+    std::size_t wake_n = m_active_buckets.size() - 1;
+    if ( wake_n > m_workers.size() - 1 )
+        wake_n = m_workers.size() - 1;
+
+    m_next_bucket = 0;
+    m_simc->m_parallel_evaluation = true;
+    m_simc->m_prim_channel_registry->m_defer_updates = true;
+
+    for ( std::size_t worker_i = 1; worker_i <= wake_n; worker_i++ )
+        m_workers[worker_i]->m_start.post();
+    curr_worker_p = m_workers[0];
+    execute( *m_workers[0] );
+    curr_worker_p = 0;
+    for ( std::size_t worker_i = 1; worker_i <= wake_n; worker_i++ )
+        m_done->wait();
+
+    m_simc->m_prim_channel_registry->m_defer_updates = false;
+    m_simc->m_parallel_evaluation = false;
+
+    for ( std::size_t bucket_i = 0; bucket_i < m_active_buckets.size();
+          bucket_i++ )
+        m_buckets[m_active_buckets[bucket_i]].clear();
+    m_active_buckets.clear();
+
+    return replay();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::replay"
+// |
+// | This method applies the operations recorded by the workers in the order
+// | in which the method processes were taken from the run queue, so the
+// | outcome is the same as for a sequential evaluation in that order.
+// | Replay stops at the first error, and after sc_stop() if the stop mode is
+// | SC_STOP_IMMEDIATE.
+// |
+// | Result is false if a process raised an error, true otherwise.
+// +----------------------------------------------------------------------------
+bool
+sc_parallel_evaluator::replay()
+{
+    bool result  = true;
+    bool stopped = false;
+
+    for ( std::size_t seg_i = 0; seg_i < m_segments.size(); seg_i++ )
+    {
+        const segment& seg = m_segments[seg_i];
+        if ( seg.begin == seg.end ) continue;
+
+        const std::vector<deferred_op>& log = m_workers[seg.worker]->m_log;
+        sc_method_handle method_h = seg.method_p;
+
+        m_simc->set_curr_proc( method_h );
+        for ( std::size_t op_i = seg.begin; op_i < seg.end; op_i++ )
+        {
+            const deferred_op& op = log[op_i];
+            sc_event*          event_p = static_cast<sc_event*>(op.object_p);
+            const sc_event_list* list_p =
+                static_cast<const sc_event_list*>(op.object_p);
+
+            if ( !result || stopped )
+            {
+                // discard the event list copies that will not be used.
+
+                if ( op.kind == op_next_trigger_list ||
+                     op.kind == op_next_trigger_time_list )
+                    list_p->auto_delete();
+                continue;
+            }
+
+            switch ( op.kind )
+            {
+              case op_update:
+                static_cast<sc_prim_channel*>(op.object_p)->request_update();
+                break;
+              case op_notify:
+                event_p->notify();
+                break;
+              case op_notify_time:
+                event_p->notify( op.time );
+                break;
+              case op_notify_delayed:
+                event_p->notify_delayed();
+                break;
+              case op_notify_delayed_time:
+                event_p->notify_delayed( op.time );
+                break;
+              case op_notify_internal:
+                if ( event_p == method_h->m_timeout_event_p )
+                    event_p->notify_internal( op.time,
+                                              method_h->m_timeout_slot_p );
+                else
+                    event_p->notify_internal( op.time );
+                break;
+              case op_cancel:
+                event_p->cancel();
+                break;
+              case op_next_trigger:
+                method_h->clear_trigger();
+                break;
+              case op_next_trigger_event:
+                method_h->next_trigger( *event_p );
+                break;
+              case op_next_trigger_list:
+                if ( list_p->and_list() )
+                    method_h->next_trigger(
+                        *static_cast<const sc_event_and_list*>(list_p) );
+                else
+                    method_h->next_trigger(
+                        *static_cast<const sc_event_or_list*>(list_p) );
+                break;
+              case op_next_trigger_time:
+                method_h->next_trigger( op.time );
+                break;
+              case op_next_trigger_time_event:
+                method_h->next_trigger( op.time, *event_p );
+                break;
+              case op_next_trigger_time_list:
+                if ( list_p->and_list() )
+                    method_h->next_trigger( op.time,
+                        *static_cast<const sc_event_and_list*>(list_p) );
+                else
+                    method_h->next_trigger( op.time,
+                        *static_cast<const sc_event_or_list*>(list_p) );
+                break;
+              case op_stop:
+                m_simc->stop();
+                stopped = ( sc_get_stop_mode() == SC_STOP_IMMEDIATE );
+                break;
+              case op_error:
+                m_simc->set_error( static_cast<sc_report*>(op.object_p) );
+                result = false;
+                break;
+            }
+        }
+    }
+
+    for ( std::size_t worker_i = 0; worker_i < m_workers.size(); worker_i++ )
+        m_workers[worker_i]->m_log.clear();
+    m_segments.clear();
+    return result;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::curr_proc_info"
+// |
+// | This static method returns the process information of the calling
+// | worker thread.
+// +----------------------------------------------------------------------------
+sc_curr_proc_handle
+sc_parallel_evaluator::curr_proc_info()
+{
+    sc_assert( curr_worker_p != 0 );
+    return &curr_worker_p->m_proc_info;
+}
+
+sc_process_b*
+sc_parallel_evaluator::current_writer()
+{
+    sc_assert( curr_worker_p != 0 );
+    return curr_worker_p->m_writer_p;
+}
+
+sc_host_mutex*
+sc_parallel_evaluator::report_mutex()
+{
+    return curr_worker_p ? curr_worker_p->m_evaluator_p->m_report_mutex : 0;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::defer"
+// |
+// | These static methods record a kernel operation of the process executing
+// | on the calling worker thread. Event lists are copied, since the list
+// | passed to next_trigger may not outlive the process execution.
+// +----------------------------------------------------------------------------
+void
+sc_parallel_evaluator::defer( op_kind kind, void* object_p, const sc_time& t )
+{
+    sc_assert( curr_worker_p != 0 );
+    deferred_op op;
+    op.kind     = kind;
+    op.object_p = object_p;
+    op.time     = t;
+    curr_worker_p->m_log.push_back( op );
+}
+
+void
+sc_parallel_evaluator::defer( op_kind kind, const sc_event_list& el,
+                              const sc_time& t )
+{
+    sc_event_list* copy_p;
+    if ( el.and_list() )
+        copy_p = sc_event_and_list::new_temporary();
+    else
+        copy_p = sc_event_or_list::new_temporary();
+    copy_p->move_from( el );
+    if ( el.temporary() )
+        el.auto_delete();
+    defer( kind, copy_p, t );
+}
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_parallel_report_guard
+//
+//  Locks the report handler while evaluating in parallel.
+// ----------------------------------------------------------------------------
+
+sc_parallel_report_guard::sc_parallel_report_guard()
+  : m_mutex_p( sc_parallel_evaluator::report_mutex() )
+{
+    if ( m_mutex_p )
+        m_mutex_p->lock();
+}
+
+sc_parallel_report_guard::~sc_parallel_report_guard()
+{
+    if ( m_mutex_p )
+        m_mutex_p->unlock();
+}
+
+#else // !SC_HAS_PARALLEL_EVALUATION_
+
+// Without host thread support no evaluator is ever created, so none of the
+// methods below is reached.
+
+struct sc_parallel_evaluator::worker {};
+
+sc_parallel_evaluator::sc_parallel_evaluator( sc_simcontext& simc,
+                                              unsigned, bool infer_partitions )
+  : m_simc( &simc ), m_infer_partitions( infer_partitions ), m_workers()
+  , m_segments(), m_buckets(), m_active_buckets(), m_order()
+  , m_next_bucket( 0 ), m_mutex( 0 ), m_report_mutex( 0 ), m_done( 0 )
+  , m_shutdown( false )
+{
+    sc_assert( false );
+}
+
+sc_parallel_evaluator::~sc_parallel_evaluator() {}
+
+bool
+sc_parallel_evaluator::run_methods( bool& )
+{
+    return true;
+}
+
+sc_curr_proc_handle
+sc_parallel_evaluator::curr_proc_info()
+{
+    sc_assert( false );
+    return 0;
+}
+
+sc_process_b*
+sc_parallel_evaluator::current_writer()
+{
+    return 0;
+}
+
+sc_host_mutex*
+sc_parallel_evaluator::report_mutex()
+{
+    return 0;
+}
+
+sc_parallel_report_guard::sc_parallel_report_guard() : m_mutex_p( 0 ) {}
+sc_parallel_report_guard::~sc_parallel_report_guard() {}
+
+void
+sc_parallel_evaluator::defer( op_kind, void*, const sc_time& )
+{
+    sc_assert( false );
+}
+
+void
+sc_parallel_evaluator::defer( op_kind, const sc_event_list&, const sc_time& )
+{
+    sc_assert( false );
+}
+
+#endif // SC_HAS_PARALLEL_EVALUATION_
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::bucket_of"
+// |
+// | This method returns the bucket the supplied method is executed in, or -1
+// | if the method has no partition and must be executed by the simulator.
+// +----------------------------------------------------------------------------
+int
+sc_parallel_evaluator::bucket_of( const sc_method_process* method_p ) const
+{
+    int partition = method_p->m_partition;
+    return partition < 0 ? -1 : (int)( partition % m_buckets.size() );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_parallel_evaluator::start_simulation"
+// |
+// | This method assigns partitions to the method processes without a
+// | declared partition. Objects are merged into the same partition if one
+// | of them can modify the state of the other: a port that is not an input
+// | port merges its module with the bound channel, and a primitive channel
+// | other than a signal merges with its parent module if that module owns
+// | method processes. Signals are assumed to be written by a single
+// | partition. Modules with a multiport that is not an input port, and
+// | methods not owned by a module stay without a partition. The inferred
+// | partitions are numbered after the largest declared partition.
+// +----------------------------------------------------------------------------
+
+namespace {
+
+typedef std::map<sc_object*, sc_object*> sc_partition_sets;
+
+sc_object*
+sc_partition_find( sc_partition_sets& sets, sc_object* obj_p )
+{
+    sc_partition_sets::iterator it = sets.find( obj_p );
+    if ( it == sets.end() )
+    {
+        sets[obj_p] = obj_p;
+        return obj_p;
+    }
+    if ( it->second == obj_p )
+        return obj_p;
+    sc_object* root_p = sc_partition_find( sets, it->second );
+    sets[obj_p] = root_p; // path compression
+    return root_p;
+}
+
+void
+sc_partition_merge( sc_partition_sets& sets, sc_object* a_p, sc_object* b_p )
+{
+    a_p = sc_partition_find( sets, a_p );
+    b_p = sc_partition_find( sets, b_p );
+    if ( a_p != b_p )
+        sets[b_p] = a_p;
+}
+
+} // anonymous namespace
+
+void
+sc_parallel_evaluator::start_simulation()
+{
+    sc_partition_sets               sets;
+    std::map<sc_object*, bool>      has_methods;
+    std::vector<sc_method_process*> methods;
+    std::vector<sc_object*>         serial;
+    int                             declared_n = 0;
+
+    // COLLECT THE OBJECT HIERARCHY AND THE METHOD PROCESSES:
+
+    std::vector<sc_object*> objects( sc_get_top_level_objects( m_simc ) );
+    for ( std::size_t obj_i = 0; obj_i < objects.size(); obj_i++ )
+    {
+        const std::vector<sc_object*>& children =
+            objects[obj_i]->get_child_objects();
+        objects.insert( objects.end(), children.begin(), children.end() );
+
+        sc_method_handle method_p =
+            dynamic_cast<sc_method_handle>( objects[obj_i] );
+        if ( !method_p ) continue;
+
+        methods.push_back( method_p );
+        if ( method_p->m_partition >= declared_n )
+            declared_n = method_p->m_partition + 1;
+        if ( method_p->get_parent_object() )
+            has_methods[method_p->get_parent_object()] = true;
+    }
+
+    if ( !m_infer_partitions )
+        return;
+
+    // MERGE THE OBJECTS THAT MAY MODIFY EACH OTHER:
+
+    for ( std::size_t obj_i = 0; obj_i < objects.size(); obj_i++ )
+    {
+        sc_object* obj_p    = objects[obj_i];
+        sc_object* parent_p = obj_p->get_parent_object();
+        if ( parent_p && has_methods[parent_p] &&
+             dynamic_cast<sc_prim_channel*>(obj_p) &&
+             !dynamic_cast<sc_signal_channel*>(obj_p) )
+        {
+            sc_partition_merge( sets, parent_p, obj_p );
+        }
+
+        sc_port_base* port_p = dynamic_cast<sc_port_base*>(obj_p);
+        if ( !port_p || !parent_p )
+            continue;
+
+        if ( dynamic_cast<sc_signal_in_port*>(port_p) )
+            continue; // input ports do not modify the channel
+
+        if ( port_p->interface_count() > 1 )
+        {
+            serial.push_back( parent_p );
+            continue;
+        }
+
+        sc_object* channel_p = dynamic_cast<sc_object*>(
+            port_p->get_interface() );
+        if ( channel_p )
+            sc_partition_merge( sets, parent_p, channel_p );
+    }
+
+    for ( std::size_t serial_i = 0; serial_i < serial.size(); serial_i++ )
+        serial[serial_i] = sc_partition_find( sets, serial[serial_i] );
+
+    // NUMBER THE PARTITIONS:
+
+    std::map<sc_object*, int> ids;
+    for ( std::size_t method_i = 0; method_i < methods.size(); method_i++ )
+    {
+        sc_method_handle method_p = methods[method_i];
+        sc_object*       module_p =
+            dynamic_cast<sc_module*>( method_p->get_parent_object() );
+        if ( method_p->m_partition >= 0 || !module_p )
+            continue;
+
+        sc_object* root_p = sc_partition_find( sets, module_p );
+        if ( std::find( serial.begin(), serial.end(), root_p ) != serial.end() )
+            continue;
+
+        std::map<sc_object*, int>::iterator it = ids.find( root_p );
+        if ( it == ids.end() )
+            it = ids.insert( std::make_pair( root_p,
+                     declared_n + (int)ids.size() ) ).first;
+        method_p->m_partition = it->second;
+    }
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,207 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_parallel_evaluator.h -- Parallel evaluation of method processes.
+
+  The evaluator distributes the method processes that are runnable at the
+  start of an evaluation round over a pool of host worker threads. Method
+  processes are grouped into partitions, which are either declared by the
+  user (sc_spawn_options::set_partition, sc_module::set_partition) or
+  inferred from the port bindings at the start of simulation. Processes
+  of the same partition are executed in order on the same worker.
+
+  All kernel side effects of the processes (update requests, event
+  notifications, next_trigger calls, sc_stop, errors) are recorded by the
+  workers and replayed on the simulator thread in the original run queue
+  order, so that the simulation result does not depend on the number of
+  workers or on the host scheduling.
+
+  FOR INTERNAL USE ONLY!
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_PARALLEL_EVALUATOR_H_INCLUDED_
+#define SC_PARALLEL_EVALUATOR_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_time.h"
+#include "sysc/utils/sc_report.h"
+
+// The worker pool needs host threads, which are only guaranteed to be
+// available (and linked) if asynchronous updates are supported.
+
+#if !defined(SC_DISABLE_ASYNC_UPDATES) \
+ && ( SC_CPLUSPLUS >= 201103L || !( defined(WIN32) || defined(_WIN32) ) )
+#  define SC_HAS_PARALLEL_EVALUATION_ 1
+#else
+#  define SC_HAS_PARALLEL_EVALUATION_ 0
+#endif
+
+#include <vector>
+
+namespace sc_core {
+
+class sc_event;
+class sc_event_list;
+class sc_host_mutex;
+class sc_host_semaphore;
+class sc_method_process;
+class sc_prim_channel;
+class sc_report;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_parallel_evaluator
+//
+//  Executes independent method processes of an evaluation round on a pool
+//  of host worker threads.
+// ----------------------------------------------------------------------------
+
+class sc_parallel_evaluator
+{
+    friend class sc_simcontext;
+
+public:
+
+    // kernel operations recorded during a parallel evaluation round
+    enum op_kind {
+        op_update,                   // sc_prim_channel::request_update
+        op_notify,                   // sc_event::notify()
+        op_notify_time,              // sc_event::notify(t)
+        op_notify_delayed,           // sc_event::notify_delayed()
+        op_notify_delayed_time,      // sc_event::notify_delayed(t)
+        op_notify_internal,          // sc_event::notify_internal(t)
+        op_cancel,                   // sc_event::cancel()
+        op_next_trigger,             // next_trigger()
+        op_next_trigger_event,       // next_trigger(e)
+        op_next_trigger_list,        // next_trigger(el)
+        op_next_trigger_time,        // next_trigger(t)
+        op_next_trigger_time_event,  // next_trigger(t, e)
+        op_next_trigger_time_list,   // next_trigger(t, el)
+        op_stop,                     // sc_stop()
+        op_error                     // uncaught exception
+    };
+
+    // recording interface, only valid while evaluating in parallel
+    static sc_curr_proc_handle curr_proc_info();
+    static sc_process_b* current_writer();
+    static void defer( op_kind, void* object_p = 0,
+                       const sc_time& t = SC_ZERO_TIME );
+    static void defer( op_kind, const sc_event_list&,
+                       const sc_time& t = SC_ZERO_TIME );
+
+    // serializes the report handler between the workers
+    static sc_host_mutex* report_mutex();
+
+    // per-thread state of a worker
+    struct worker;
+
+private:
+
+    struct deferred_op
+    {
+        op_kind kind;
+        void*   object_p;
+        sc_time time;
+    };
+
+    // the log range of a single method process execution
+    struct segment
+    {
+        sc_method_process* method_p;
+        unsigned           worker;
+        std::size_t        begin;
+        std::size_t        end;
+    };
+
+    sc_parallel_evaluator( sc_simcontext& simc, unsigned workers,
+                           bool infer_partitions );
+    ~sc_parallel_evaluator();
+
+    // assign the method processes to partitions
+    void start_simulation();
+
+    // execute the runnable method processes, false if an error occurred
+    bool run_methods( bool& empty_eval_phase );
+
+    // executed by each worker, including the simulator thread
+    void execute( worker& );
+    void execute_bucket( worker&, std::size_t bucket );
+    bool replay();
+
+    static void* worker_main( void* );
+
+    int bucket_of( const sc_method_process* ) const;
+
+private:
+    sc_simcontext*                    m_simc;
+    bool                              m_infer_partitions;
+    std::vector<worker*>              m_workers;  // [0] = simulator thread
+    std::vector<segment>              m_segments; // current batch.
+    std::vector<std::vector<std::size_t> > m_buckets;
+    std::vector<std::size_t>          m_active_buckets;
+    std::vector<sc_method_process*>   m_order;    // popped run queue.
+    std::size_t                       m_next_bucket;
+    sc_host_mutex*                    m_mutex;    // guards m_next_bucket.
+    sc_host_mutex*                    m_report_mutex;
+    sc_report_handler::thread_state*  m_report_state_p; // of simulator.
+    sc_host_semaphore*                m_done;
+    bool                              m_shutdown;
+
+private:
+    // disabled
+    sc_parallel_evaluator( const sc_parallel_evaluator& );
+    sc_parallel_evaluator& operator = ( const sc_parallel_evaluator& );
+};
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_parallel_report_guard
+//
+//  Locks the report handler while evaluating in parallel.
+// ----------------------------------------------------------------------------
+
+class sc_parallel_report_guard
+{
+public:
+    sc_parallel_report_guard();
+    ~sc_parallel_report_guard();
+private:
+    sc_host_mutex* m_mutex_p;
+private:
+    // disabled
+    sc_parallel_report_guard( const sc_parallel_report_guard& );
+    sc_parallel_report_guard& operator = ( const sc_parallel_report_guard& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_PARALLEL_EVALUATOR_H_INCLUDED_
+// Taf!
@@ -0,0 +1,740 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_pdes.cpp -- Link between the partitions of a distributed simulation.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_pdes.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/communication/sc_pdes_channel.h"
+#include "sysc/utils/sc_report.h"
+
+#include <cstdio>
+#include <cstring>
+
+#if !( defined(WIN32) || defined(_WIN32) )
+#  define SC_PDES_SOCKETS_ 1
+#  include <cerrno>
+#  include <fcntl.h>
+#  include <poll.h>
+#  include <sys/socket.h>
+#  include <sys/time.h>
+#  include <sys/un.h>
+#  include <unistd.h>
+#else
+#  define SC_PDES_SOCKETS_ 0
+#endif
+
+namespace sc_core {
+
+// Each partition listens on the socket "<address>.<rank>". At the start of
+// simulation a partition connects to the partitions of lower rank, sends
+// its rank, and accepts the connections of the partitions of higher rank.
+// The messages are exchanged in the byte order of the host, so all
+// partitions must run on the same kind of host.
+
+static const int connect_timeout = 60;  // seconds to wait for a partition.
+
+sc_pdes::peer::peer()
+  : fd( -1 ), out(), out_sent( 0 ), in(), inboxes(), outboxes( 0 ),
+    lookahead( sc_max_time() ), eot_in( SC_ZERO_TIME ),
+    eot_out( SC_ZERO_TIME ), done( false )
+{}
+
+sc_pdes::sc_pdes( sc_simcontext* simc_p, int rank, int size,
+                  const std::string& address )
+  : m_simc( simc_p ), m_rank( rank ), m_address( address ),
+    m_peers( size ), m_inboxes(), m_outboxes(),
+    m_started( false )
+{
+    // this partition is no input of itself, its own messages are
+    // delivered directly.
+    m_peers[rank].eot_in = sc_max_time();
+    m_peers[rank].done = true;
+}
+
+sc_pdes::~sc_pdes()
+{
+    close();
+    for ( std::size_t i = 0; i < m_inboxes.size(); ++i )
+        m_inboxes[i]->m_link = 0;
+    for ( std::size_t i = 0; i < m_outboxes.size(); ++i )
+        m_outboxes[i]->m_link = 0;
+}
+
+void
+sc_pdes::add_inbox( sc_pdes_inbox_base* inbox_p )
+{
+    m_inboxes.push_back( inbox_p );
+}
+
+void
+sc_pdes::add_outbox( sc_pdes_outbox_base* outbox_p )
+{
+    peer& p = m_peers[outbox_p->m_peer];
+    outbox_p->m_index = p.outboxes++;
+    if ( outbox_p->m_lookahead < p.lookahead )
+        p.lookahead = outbox_p->m_lookahead;
+    m_outboxes.push_back( outbox_p );
+}
+
+void
+sc_pdes::remove_inbox( sc_pdes_inbox_base* inbox_p )
+{
+    for ( std::size_t i = 0; i < m_inboxes.size(); ++i )
+    {
+        if ( m_inboxes[i] == inbox_p )
+        {
+            m_inboxes[i] = m_inboxes.back();
+            m_inboxes.pop_back();
+            break;
+        }
+    }
+    for ( std::size_t r = 0; r < m_peers.size(); ++r )
+    {
+        std::vector<sc_pdes_inbox_base*>& inboxes = m_peers[r].inboxes;
+        for ( std::size_t i = 0; i < inboxes.size(); ++i )
+            if ( inboxes[i] == inbox_p )
+                inboxes[i] = 0;
+    }
+}
+
+void
+sc_pdes::remove_outbox( sc_pdes_outbox_base* outbox_p )
+{
+    for ( std::size_t i = 0; i < m_outboxes.size(); ++i )
+    {
+        if ( m_outboxes[i] == outbox_p )
+        {
+            m_outboxes[i] = m_outboxes.back();
+            m_outboxes.pop_back();
+            break;
+        }
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes::start"
+// |
+// | This method connects the partitions at the start of simulation. It
+// | sends the time resolution and the names of the outboxes to each
+// | other partition, together with a first promise, and matches the
+// | outboxes to this partition with their inboxes.
+// +----------------------------------------------------------------------------
+void
+sc_pdes::start()
+{
+    if ( m_started )
+        return;
+    m_started = true;
+
+    if ( m_peers.size() > 1 )
+        connect();
+
+    sc_dt::uint64 resolution =
+        static_cast<sc_dt::uint64>( m_simc->m_time_params->time_resolution );
+    for ( std::size_t r = 0; r < m_peers.size(); ++r )
+    {
+        if ( static_cast<int>( r ) != m_rank )
+            append( m_peers[r], hello, 0, resolution, 0, 0 );
+    }
+
+    for ( std::size_t i = 0; i < m_outboxes.size(); ++i )
+    {
+        sc_pdes_outbox_base* outbox_p = m_outboxes[i];
+        peer& p = m_peers[outbox_p->m_peer];
+        std::string name = outbox_p->name();
+        if ( outbox_p->m_peer != m_rank )
+        {
+            append( p, channel, outbox_p->m_index, 0, name.data(),
+                    name.size() );
+            continue;
+        }
+        header h = { channel, outbox_p->m_index, 0, name.size() };
+        receive( m_rank, h, name.data() );
+    }
+
+    promise( m_simc->m_curr_time );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes::send"
+// |
+// | This method sends a value written to an outbox. A value to this
+// | partition is delivered to its inbox at once.
+// |
+// | Arguments:
+// |     outbox_p = outbox the value was written to.
+// |     t        = time the value is to be received.
+// |     value    = bytes of the value.
+// +----------------------------------------------------------------------------
+void
+sc_pdes::send( sc_pdes_outbox_base* outbox_p, const sc_time& t,
+               const std::vector<char>& value )
+{
+    const char* payload_p = value.empty() ? 0 : &value[0];
+    if ( outbox_p->m_peer == m_rank )
+    {
+        header h = { data, outbox_p->m_index, t.value(), value.size() };
+        receive( m_rank, h, payload_p );
+        return;
+    }
+    peer& p = m_peers[outbox_p->m_peer];
+    if ( p.fd >= 0 )
+        append( p, data, outbox_p->m_index, t.value(), payload_p,
+                value.size() );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes::synchronize"
+// |
+// | This method is called by the simulator before the time advances. It
+// | promises the other partitions the earlier of the next local time and
+// | the promises received, plus the lookahead, and waits for messages
+// | until no message up to the next local time can arrive. Received data
+// | may advance the next local time; it is re-evaluated after each
+// | message.
+// |
+// | Arguments:
+// |     until_t = time the simulation runs to.
+// +----------------------------------------------------------------------------
+void
+sc_pdes::synchronize( const sc_time& until_t )
+{
+    rearm_inboxes();
+    for ( ;; )
+    {
+        sc_time t;
+        sc_time horizon = ( m_simc->next_time( t ) && t < until_t )
+                        ? t : until_t;
+        sc_time input = input_horizon();
+
+        append_promises( input < horizon ? input : horizon );
+        if ( horizon < input || input == sc_max_time() )
+        {
+            pump( false );
+            return;
+        }
+        // nothing has been read since horizon and input were computed, so
+        // the message to wait for has not arrived yet.
+        if ( !pump( true ) )
+            return;   // no partition left to wait for.
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes::promise"
+// |
+// | This method promises each partition fed by an outbox of this partition
+// | that no data with a timestamp below t plus the least lookahead of the
+// | outboxes to it will be sent. A partition without outboxes is promised
+// | sc_max_time() once.
+// +----------------------------------------------------------------------------
+void
+sc_pdes::promise( const sc_time& t )
+{
+    append_promises( t );
+    pump( false );
+}
+
+void
+sc_pdes::append_promises( const sc_time& t )
+{
+    for ( std::size_t r = 0; r < m_peers.size(); ++r )
+    {
+        peer& p = m_peers[r];
+        if ( static_cast<int>( r ) == m_rank || p.fd < 0 )
+            continue;
+        sc_time eot = sc_max_time();
+        if ( p.outboxes && t < sc_max_time() - p.lookahead )
+            eot = t + p.lookahead;
+        if ( eot > p.eot_out )
+        {
+            p.eot_out = eot;
+            append( p, null, 0, eot.value(), 0, 0 );
+        }
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes::stop"
+// |
+// | This method tells the other partitions that this one stopped, so that
+// | they no longer wait for its promises.
+// +----------------------------------------------------------------------------
+void
+sc_pdes::stop()
+{
+    for ( std::size_t r = 0; r < m_peers.size(); ++r )
+    {
+        peer& p = m_peers[r];
+        if ( static_cast<int>( r ) != m_rank && p.fd >= 0 )
+        {
+            p.eot_out = sc_max_time();
+            append( p, done, 0, 0, 0, 0 );
+        }
+    }
+    close();
+}
+
+void
+sc_pdes::append( peer& p, kind k, unsigned channel_index,
+                 sc_dt::uint64 time, const void* payload_p, std::size_t size )
+{
+    header h = { static_cast<unsigned>( k ), channel_index, time, size };
+    const char* h_p = reinterpret_cast<const char*>( &h );
+    p.out.insert( p.out.end(), h_p, h_p + sizeof( h ) );
+    if ( size )
+    {
+        const char* bytes_p = static_cast<const char*>( payload_p );
+        p.out.insert( p.out.end(), bytes_p, bytes_p + size );
+    }
+}
+
+sc_time
+sc_pdes::input_horizon() const
+{
+    sc_time horizon = sc_max_time();
+    for ( std::size_t r = 0; r < m_peers.size(); ++r )
+    {
+        const peer& p = m_peers[r];
+        if ( !p.done && p.eot_in < horizon )
+            horizon = p.eot_in;
+    }
+    return horizon;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes::rearm_inboxes"
+// |
+// | This method notifies each inbox for its next received value, once the
+// | notification for the previous one has happened.
+// +----------------------------------------------------------------------------
+void
+sc_pdes::rearm_inboxes()
+{
+    for ( std::size_t i = 0; i < m_inboxes.size(); ++i )
+        m_inboxes[i]->arm();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes::receive"
+// |
+// | This method handles a message received from another partition.
+// |
+// | Arguments:
+// |     rank      = partition the message comes from.
+// |     h         = header of the message.
+// |     payload_p = bytes of the payload.
+// +----------------------------------------------------------------------------
+void
+sc_pdes::receive( int rank, const header& h, const char* payload_p )
+{
+    peer& p = m_peers[rank];
+    switch ( h.kind )
+    {
+      case hello:
+        if ( h.time != static_cast<sc_dt::uint64>(
+                         m_simc->m_time_params->time_resolution ) )
+        {
+            SC_REPORT_ERROR( SC_ID_PDES_,
+                             "the partitions use different time resolutions" );
+        }
+        break;
+      case channel:
+      {
+        std::string name( payload_p, static_cast<std::size_t>( h.size ) );
+        sc_pdes_inbox_base* inbox_p = 0;
+        for ( std::size_t i = 0; i < m_inboxes.size(); ++i )
+        {
+            if ( m_inboxes[i]->m_peer == rank &&
+                 m_inboxes[i]->m_outbox_name == name )
+            {
+                inbox_p = m_inboxes[i];
+                break;
+            }
+        }
+        if ( !inbox_p )
+        {
+            std::string msg = "no inbox for outbox '" + name + "'";
+            SC_REPORT_ERROR( SC_ID_PDES_, msg.c_str() );
+            break;
+        }
+        if ( p.inboxes.size() <= h.channel )
+            p.inboxes.resize( h.channel + 1, 0 );
+        p.inboxes[h.channel] = inbox_p;
+        break;
+      }
+      case data:
+        if ( h.channel < p.inboxes.size() && p.inboxes[h.channel] )
+        {
+            p.inboxes[h.channel]->receive( sc_time::from_value( h.time ),
+                                           payload_p,
+                                           static_cast<std::size_t>( h.size ) );
+        }
+        break;
+      case null:
+        if ( sc_time::from_value( h.time ) > p.eot_in )
+            p.eot_in = sc_time::from_value( h.time );
+        break;
+      case done:
+        p.done = true;
+        break;
+      default:
+        SC_REPORT_ERROR( SC_ID_PDES_, "invalid message" );
+    }
+}
+
+#if SC_PDES_SOCKETS_
+
+static std::string
+socket_path( const std::string& address, int rank )
+{
+    char buffer[16];
+    std::sprintf( buffer, ".%d", rank );
+    return address + buffer;
+}
+
+static bool
+make_address( const std::string& path, sockaddr_un& addr )
+{
+    std::memset( &addr, 0, sizeof( addr ) );
+    addr.sun_family = AF_UNIX;
+    if ( path.size() >= sizeof( addr.sun_path ) )
+        return false;
+    std::strcpy( addr.sun_path, path.c_str() );
+    return true;
+}
+
+static bool
+transfer_rank( int fd, int& rank, bool write_it )
+{
+    unsigned value = static_cast<unsigned>( rank );
+    char* bytes_p = reinterpret_cast<char*>( &value );
+    std::size_t done_n = 0;
+    while ( done_n < sizeof( value ) )
+    {
+        ssize_t n = write_it
+                  ? ::write( fd, bytes_p + done_n, sizeof( value ) - done_n )
+                  : ::read( fd, bytes_p + done_n, sizeof( value ) - done_n );
+        if ( n < 0 && errno == EINTR )
+            continue;
+        if ( n <= 0 )
+            return false;
+        done_n += static_cast<std::size_t>( n );
+    }
+    rank = static_cast<int>( value );
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes::connect"
+// |
+// | This method connects this partition to all others, waiting up to
+// | connect_timeout seconds for the partitions of lower rank to listen.
+// | The socket of this partition is removed once all partitions are
+// | connected.
+// +----------------------------------------------------------------------------
+void
+sc_pdes::connect()
+{
+    int size = static_cast<int>( m_peers.size() );
+    sockaddr_un addr;
+    std::string path = socket_path( m_address, m_rank );
+    if ( !make_address( path, addr ) )
+    {
+        std::string msg = "socket path too long: " + path;
+        SC_REPORT_ERROR( SC_ID_PDES_, msg.c_str() );
+        return;
+    }
+
+    ::unlink( path.c_str() );
+    int listen_fd = ::socket( AF_UNIX, SOCK_STREAM, 0 );
+    if ( listen_fd < 0 ||
+         ::bind( listen_fd, reinterpret_cast<sockaddr*>( &addr ),
+                 sizeof( addr ) ) != 0 ||
+         ::listen( listen_fd, size ) != 0 )
+    {
+        std::string msg = "cannot listen on " + path + ": " +
+                          std::strerror( errno );
+        if ( listen_fd >= 0 )
+            ::close( listen_fd );
+        SC_REPORT_ERROR( SC_ID_PDES_, msg.c_str() );
+        return;
+    }
+
+    std::string error;
+
+    // connect to the partitions of lower rank
+
+    for ( int r = 0; r < m_rank && error.empty(); ++r )
+    {
+        std::string peer_path = socket_path( m_address, r );
+        make_address( peer_path, addr );
+        int fd = -1;
+        for ( int tries = connect_timeout * 100; ; --tries )
+        {
+            fd = ::socket( AF_UNIX, SOCK_STREAM, 0 );
+            if ( fd >= 0 &&
+                 ::connect( fd, reinterpret_cast<sockaddr*>( &addr ),
+                            sizeof( addr ) ) == 0 )
+                break;
+            if ( fd >= 0 )
+                ::close( fd );
+            fd = -1;
+            if ( tries == 0 )
+                break;
+            ::usleep( 10000 );
+        }
+        int rank = m_rank;
+        if ( fd < 0 || !transfer_rank( fd, rank, true ) )
+        {
+            error = "cannot connect to " + peer_path;
+            if ( fd >= 0 )
+                ::close( fd );
+            break;
+        }
+        m_peers[r].fd = fd;
+    }
+
+    // accept the partitions of higher rank
+
+    for ( int n = m_rank + 1; n < size && error.empty(); ++n )
+    {
+        int fd = ::accept( listen_fd, 0, 0 );
+        if ( fd < 0 && errno == EINTR )
+        {
+            --n;
+            continue;
+        }
+        int rank = -1;
+        if ( fd < 0 || !transfer_rank( fd, rank, false ) ||
+             rank <= m_rank || rank >= size || m_peers[rank].fd >= 0 )
+        {
+            error = "invalid connection of a partition";
+            if ( fd >= 0 )
+                ::close( fd );
+            break;
+        }
+        m_peers[rank].fd = fd;
+    }
+
+    ::close( listen_fd );
+    ::unlink( path.c_str() );
+    if ( !error.empty() )
+    {
+        SC_REPORT_ERROR( SC_ID_PDES_, error.c_str() );
+        return;
+    }
+
+    for ( int r = 0; r < size; ++r )
+    {
+        int fd = m_peers[r].fd;
+        if ( fd < 0 )
+            continue;
+        ::fcntl( fd, F_SETFL, ::fcntl( fd, F_GETFL ) | O_NONBLOCK );
+#if defined(SO_NOSIGPIPE)
+        int on = 1;
+        ::setsockopt( fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof( on ) );
+#endif
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes::pump"
+// |
+// | This method sends pending output and reads the input of the
+// | connections.
+// |
+// | Arguments:
+// |     block = true to wait until a connection is ready.
+// | Result is false if no connection is left.
+// +----------------------------------------------------------------------------
+bool
+sc_pdes::pump( bool block )
+{
+    std::vector<pollfd> fds;
+    std::vector<int>    ranks;
+    for ( std::size_t r = 0; r < m_peers.size(); ++r )
+    {
+        peer& p = m_peers[r];
+        if ( p.fd < 0 )
+            continue;
+        pollfd pfd;
+        pfd.fd = p.fd;
+        pfd.events = POLLIN;
+        if ( p.out_sent < p.out.size() )
+            pfd.events |= POLLOUT;
+        pfd.revents = 0;
+        fds.push_back( pfd );
+        ranks.push_back( static_cast<int>( r ) );
+    }
+    if ( fds.empty() )
+        return false;
+
+    int n;
+    do {
+        n = ::poll( &fds[0], fds.size(), block ? -1 : 0 );
+    } while ( n < 0 && errno == EINTR );
+
+    for ( std::size_t i = 0; n > 0 && i < fds.size(); ++i )
+    {
+        peer& p = m_peers[ranks[i]];
+        if ( fds[i].revents & POLLOUT )
+        {
+            while ( p.out_sent < p.out.size() )
+            {
+#if defined(MSG_NOSIGNAL)
+                ssize_t sent = ::send( p.fd, &p.out[p.out_sent],
+                                       p.out.size() - p.out_sent,
+                                       MSG_NOSIGNAL );
+#else
+                ssize_t sent = ::send( p.fd, &p.out[p.out_sent],
+                                       p.out.size() - p.out_sent, 0 );
+#endif
+                if ( sent > 0 )
+                    p.out_sent += static_cast<std::size_t>( sent );
+                else if ( sent < 0 && errno == EINTR )
+                    continue;
+                else
+                {
+                    if ( sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK )
+                        p.out_sent = p.out.size();  // the partition has gone.
+                    break;
+                }
+            }
+            if ( p.out_sent == p.out.size() )
+            {
+                p.out.clear();
+                p.out_sent = 0;
+            }
+        }
+        if ( fds[i].revents & ( POLLIN | POLLHUP | POLLERR ) )
+            receive( ranks[i] );
+    }
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes::receive"
+// |
+// | This method reads the available input of a connection and handles the
+// | complete messages. A closed connection counts as a stopped partition.
+// +----------------------------------------------------------------------------
+void
+sc_pdes::receive( int rank )
+{
+    peer& p = m_peers[rank];
+    char buffer[65536];
+    for ( ;; )
+    {
+        ssize_t n = ::read( p.fd, buffer, sizeof( buffer ) );
+        if ( n > 0 )
+        {
+            p.in.insert( p.in.end(), buffer, buffer + n );
+            continue;
+        }
+        if ( n < 0 && errno == EINTR )
+            continue;
+        if ( n == 0 || ( errno != EAGAIN && errno != EWOULDBLOCK ) )
+        {
+            ::close( p.fd );
+            p.fd = -1;
+            p.done = true;
+            p.out.clear();
+            p.out_sent = 0;
+        }
+        break;
+    }
+
+    std::size_t pos = 0;
+    while ( p.in.size() - pos >= sizeof( header ) )
+    {
+        header h;
+        std::memcpy( &h, &p.in[pos], sizeof( h ) );
+        if ( p.in.size() - pos - sizeof( h ) < h.size )
+            break;
+        pos += sizeof( h );
+        receive( rank, h, h.size ? &p.in[pos] : 0 );
+        pos += static_cast<std::size_t>( h.size );
+    }
+    p.in.erase( p.in.begin(), p.in.begin() + pos );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_pdes::close"
+// |
+// | This method sends the pending output and closes the connections.
+// +----------------------------------------------------------------------------
+void
+sc_pdes::close()
+{
+    for ( ;; )
+    {
+        bool pending = false;
+        for ( std::size_t r = 0; r < m_peers.size(); ++r )
+            if ( m_peers[r].fd >= 0 && !m_peers[r].out.empty() )
+                pending = true;
+        if ( !pending || !pump( true ) )
+            break;
+    }
+    for ( std::size_t r = 0; r < m_peers.size(); ++r )
+    {
+        if ( m_peers[r].fd >= 0 )
+        {
+            ::close( m_peers[r].fd );
+            m_peers[r].fd = -1;
+        }
+        m_peers[r].done = true;
+    }
+}
+
+#else // !SC_PDES_SOCKETS_
+
+void
+sc_pdes::connect()
+{
+    SC_REPORT_ERROR( SC_ID_PDES_,
+                     "distributed simulation is not supported on this "
+                     "platform" );
+}
+
+bool sc_pdes::pump( bool ) { return false; }
+void sc_pdes::receive( int ) {}
+void sc_pdes::close() {}
+
+#endif // SC_PDES_SOCKETS_
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,181 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_pdes.h -- Link between the partitions of a distributed simulation.
+
+  A distributed simulation runs the partitions of a model in separate
+  host processes, one simulation context per process. The partitions
+  exchange timestamped messages over the cross-partition channels
+  (sc_pdes_outbox, sc_pdes_inbox), each of which has a positive
+  lookahead: a message written at time t is received at t + lookahead.
+
+  The partitions are synchronized conservatively with null messages: a
+  partition promises its peers a lower bound of the timestamps of the
+  messages it may still send, and advances its time only to times
+  below the promises of all its peers. Since the lookaheads are
+  positive, the promises grow with every exchange, so the partitions
+  never deadlock.
+
+  The partitions are connected by Unix-domain stream sockets. Messages
+  to a partition that is not busy receiving are buffered, so a process
+  writing an outbox never blocks.
+
+  FOR INTERNAL USE ONLY!
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_PDES_H_INCLUDED_
+#define SC_PDES_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/kernel/sc_simcontext.h"
+#include "sysc/kernel/sc_time.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+
+#include <string>
+#include <vector>
+
+namespace sc_core {
+
+class sc_pdes_inbox_base;
+class sc_pdes_outbox_base;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_pdes
+//
+//  Link of a partition to the other partitions of a distributed simulation.
+// ----------------------------------------------------------------------------
+
+class sc_pdes
+{
+    friend class sc_simcontext;
+    friend class sc_pdes_inbox_base;
+    friend class sc_pdes_outbox_base;
+    friend SC_API void sc_start( const sc_time&, sc_starvation_policy );
+
+    // message kinds
+    enum kind {
+        hello,    // time resolution of the sender, in fs.
+        channel,  // name of an outbox of the sender.
+        data,     // value written to an outbox of the sender.
+        null,     // promise: no data with a smaller timestamp follows.
+        done      // the sender stopped, no data follows.
+    };
+
+    // message header, followed by size bytes of payload
+    struct header
+    {
+        unsigned      kind;
+        unsigned      channel;  // outbox index of the sender.
+        sc_dt::uint64 time;     // in time resolution units.
+        sc_dt::uint64 size;
+    };
+
+    // connection to another partition
+    struct peer
+    {
+        peer();
+
+        int                               fd;        // -1 if not connected.
+        std::vector<char>                 out;       // pending output.
+        std::size_t                       out_sent;  // bytes of out sent.
+        std::vector<char>                 in;        // incomplete input.
+        std::vector<sc_pdes_inbox_base*>  inboxes;   // by outbox index.
+        unsigned                          outboxes;  // outboxes to peer.
+        sc_time                           lookahead; // least of outboxes.
+        sc_time                           eot_in;    // promise of peer.
+        sc_time                           eot_out;   // promise to peer.
+        bool                              done;      // no more input.
+    };
+
+private:
+
+    sc_pdes( sc_simcontext* simc_p, int rank, int size,
+             const std::string& address );
+    ~sc_pdes();
+
+    int rank() const { return m_rank; }
+    int size() const { return static_cast<int>( m_peers.size() ); }
+
+    // registration of the cross-partition channels
+    void add_inbox( sc_pdes_inbox_base* );
+    void add_outbox( sc_pdes_outbox_base* );
+    void remove_inbox( sc_pdes_inbox_base* );
+    void remove_outbox( sc_pdes_outbox_base* );
+
+    // connect to the other partitions at the start of simulation
+    void start();
+
+    // send a value written to an outbox, at its timestamp
+    void send( sc_pdes_outbox_base*, const sc_time&,
+               const std::vector<char>& value );
+
+    // wait until no message up to the next local time can arrive
+    void synchronize( const sc_time& until_t );
+
+    // promise that no message is sent before time t plus the lookahead
+    void promise( const sc_time& t );
+
+    // tell the other partitions that this one stopped
+    void stop();
+
+private:
+
+    void connect();
+    void append_promises( const sc_time& t );
+    void append( peer&, kind, unsigned channel, sc_dt::uint64 time,
+                 const void* payload, std::size_t size );
+    bool pump( bool block );
+    void receive( int rank );
+    void receive( int rank, const header&, const char* payload );
+    void rearm_inboxes();
+    sc_time input_horizon() const;
+    void close();
+
+private:
+    sc_simcontext*                    m_simc;
+    int                               m_rank;
+    std::string                       m_address;   // socket path prefix.
+    std::vector<peer>                 m_peers;     // by rank.
+    std::vector<sc_pdes_inbox_base*>  m_inboxes;
+    std::vector<sc_pdes_outbox_base*> m_outboxes;
+    bool                              m_started;
+
+private:
+    // disabled
+    sc_pdes( const sc_pdes& );
+    sc_pdes& operator = ( const sc_pdes& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_PDES_H_INCLUDED_
+// Taf!
@@ -49,9 +49,6 @@ std::vector<sc_event*>  sc_process_handle::empty_event_vector;
 std::vector<sc_object*> sc_process_handle::empty_object_vector;
 sc_event                sc_process_handle::non_event( sc_event::kernel_event );
 
-// Last process that was created:
-
-sc_process_b* sc_process_b::m_last_created_process_p = 0;
 
 //------------------------------------------------------------------------------
 //"sc_process_b::add_static_event"
@@ -240,6 +237,24 @@ const char* sc_process_b::gen_unique_name( const char* basename_,
     return m_name_gen_p->gen_unique_name( basename_, preserve_first );
 }
 
+int sc_process_b::gen_unique_names( const char* basename_, int n_ )
+{
+    if ( ! m_name_gen_p ) m_name_gen_p = new sc_name_gen;
+    return m_name_gen_p->gen_unique_names( basename_, n_ );
+}
+
+//------------------------------------------------------------------------------
+//"sc_process_b::last_created_process_base"
+//
+// This method returns the sc_process_b pointer for the last process created
+// in the simulation context of the calling host thread. It is only used
+// internally by the simulator.
+//------------------------------------------------------------------------------
+sc_process_b* sc_process_b::last_created_process_base()
+{
+    return sc_get_curr_simcontext()->m_last_created_process_p;
+}
+
 //------------------------------------------------------------------------------
 //"sc_process_b::remove_dynamic_events"
 //
@@ -565,7 +580,9 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
     m_last_report_p(0),
     m_name_gen_p(0),
     m_process_kind(SC_NO_PROC_),
+    m_profile_p(0),
     m_references_n(1),
+    m_spare_event_lists(),
     m_resets(),
     m_reset_event_p(0),
     m_resume_event_p(0),
@@ -580,6 +597,7 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
     m_throw_status( THROW_NONE ),
     m_timed_out(false),
     m_timeout_event_p(0),
+    m_timeout_slot_p(0),
     m_trigger_type(STATIC),
     m_unwinding(false)
 {
@@ -591,7 +609,7 @@ sc_process_b::sc_process_b( const char* name_p, bool is_thread, bool free_host,
 
     // THIS OBJECT INSTANCE IS NOW THE LAST CREATED PROCESS:
 
-    m_last_created_process_p = this;
+    simcontext()->m_last_created_process_p = this;
     m_timeout_event_p = new sc_event( sc_event::kernel_event, "free_event" );
 }
 
@@ -625,9 +643,49 @@ sc_process_b::~sc_process_b()
     delete m_term_event_p;
     delete m_throw_helper_p;
     delete m_timeout_event_p;
+    sc_event_timed::delete_slot( m_timeout_slot_p );
+    for ( std::size_t i = 0; i < m_spare_event_lists.size(); i++ )
+        delete m_spare_event_lists[i];
 
 }
 
+//------------------------------------------------------------------------------
+//"sc_process_b::take_spare_event_list"
+//
+// This method returns a temporary event list of the given kind that this
+// process kept for reuse, or NULL if there is none.
+//------------------------------------------------------------------------------
+sc_event_list*
+sc_process_b::take_spare_event_list( bool and_list )
+{
+    for ( int i = (int)m_spare_event_lists.size() - 1; i >= 0; i-- )
+    {
+        sc_event_list* list_p = m_spare_event_lists[i];
+        if ( list_p->and_list() == and_list )
+        {
+            m_spare_event_lists[i] = m_spare_event_lists.back();
+            m_spare_event_lists.pop_back();
+            return list_p;
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+//"sc_process_b::keep_spare_event_list"
+//
+// This method keeps a temporary event list that is no longer used for
+// reuse, returning false if this process keeps enough lists already.
+//------------------------------------------------------------------------------
+bool
+sc_process_b::keep_spare_event_list( sc_event_list* list_p )
+{
+    if ( m_spare_event_lists.size() >= max_spare_event_lists )
+        return false;
+    m_spare_event_lists.push_back( list_p );
+    return true;
+}
+
 //------------------------------------------------------------------------------
 //"sc_process_b::terminated_event"
 //
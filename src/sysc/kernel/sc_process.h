@@ -49,6 +49,7 @@ class sc_thread_process;
 class sc_reset;
 
 SC_API const char* sc_gen_unique_name( const char*, bool preserve_first );
+SC_API int sc_gen_unique_names( const char*, int n );
 SC_API  sc_process_handle sc_get_current_process_handle();
 void sc_thread_cor_fn( void* arg );
 SC_API bool timed_out( sc_simcontext* );
@@ -205,7 +206,9 @@ extern SC_API void sc_set_stack_size( sc_thread_handle, std::size_t );
 
 class sc_event;
 class sc_event_list;
+class sc_event_timed;
 class sc_name_gen;
+struct sc_process_profile;
 class sc_spawn_options;
 class sc_unwind_exception;
 
@@ -278,13 +281,17 @@ class SC_API sc_process_b : public sc_object {
     friend class sc_process_table;   // Allow process_table to modify ref. count.
     friend class sc_thread_process;  // Child can access parent.
 
+    friend class sc_checkpoint;
     friend class sc_event;
+    friend class sc_event_list;
+    friend class sc_kernel_profiler;
     friend class sc_object;
     friend class sc_port_base;
     friend class sc_runnable;
     friend class sc_sensitive;
     friend class sc_sensitive_pos;
     friend class sc_sensitive_neg;
+    friend class sc_sensitivity_table;
     friend class sc_module;
     friend class sc_report_handler;
     friend class sc_reset;
@@ -292,6 +299,7 @@ class SC_API sc_process_b : public sc_object {
     friend class sc_unwind_exception;
 
     friend SC_API const char* sc_gen_unique_name( const char*, bool preserve_first );
+    friend SC_API int sc_gen_unique_names( const char*, int n );
     friend SC_API sc_process_handle sc_get_current_process_handle();
     friend void sc_thread_cor_fn( void* arg );
     friend SC_API bool timed_out( sc_simcontext* );
@@ -365,10 +373,11 @@ class SC_API sc_process_b : public sc_object {
     void add_static_event( const sc_event& );
     bool dynamic() const { return m_dynamic_proc != SPAWN_ELAB; }
     const char* gen_unique_name( const char* basename_, bool preserve_first );
+    int gen_unique_names( const char* basename_, int n_ );
     inline sc_report* get_last_report() { return m_last_report_p; }
     inline bool is_disabled() const;
     inline bool is_runnable() const;
-    static inline sc_process_b* last_created_process_base();
+    static sc_process_b* last_created_process_base();
     virtual bool remove_child_object( sc_object* );
     void remove_dynamic_events( bool skip_timeout = false );
     void remove_static_events();
@@ -411,6 +420,11 @@ class SC_API sc_process_b : public sc_object {
     inline void reference_decrement();
     inline void reference_increment();
 
+    // temporary event lists kept for reuse (see sc_event_list)
+    enum { max_spare_event_lists = 4 };
+    sc_event_list* take_spare_event_list( bool and_list );
+    bool           keep_spare_event_list( sc_event_list* list_p );
+
   protected:
     inline void semantics();
 
@@ -437,7 +451,9 @@ class SC_API sc_process_b : public sc_object {
     sc_report*                   m_last_report_p;   // last report this process.
     sc_name_gen*                 m_name_gen_p;      // subprocess name generator
     sc_curr_proc_kind            m_process_kind;    // type of process.
+    sc_process_profile*          m_profile_p;       // null unless profiled.
     int                          m_references_n;    // outstanding handles.
+    std::vector<sc_event_list*>  m_spare_event_lists; // temporaries to reuse.
     std::vector<sc_reset*>       m_resets;          // resets for process.
     sc_event*                    m_reset_event_p;   // reset event.
     sc_event*                    m_resume_event_p;  // resume event.
@@ -452,11 +468,9 @@ class SC_API sc_process_b : public sc_object {
     process_throw_type           m_throw_status;    // exception throwing status
     bool                         m_timed_out;       // true if we timed out.
     sc_event*                    m_timeout_event_p; // timeout event.
+    sc_event_timed*              m_timeout_slot_p;  // its timer slot.
     trigger_t                    m_trigger_type;    // type of trigger using.
     bool                         m_unwinding;       // true if unwinding stack.
-
-  protected:
-    static sc_process_b* m_last_created_process_p; // Last process created.
 };
 
 typedef sc_process_b sc_process_b;  // For compatibility.
@@ -582,17 +596,6 @@ inline bool sc_process_b::clear_unwinding()
 }
 
 
-//------------------------------------------------------------------------------
-//"sc_process_b::last_created_process_base"
-//
-// This virtual method returns the sc_process_b pointer for the last
-// created process. It is only used internally by the simulator.
-//------------------------------------------------------------------------------
-inline sc_process_b* sc_process_b::last_created_process_base()
-{
-    return m_last_created_process_p;
-}
-
 
 
 //------------------------------------------------------------------------------
@@ -529,7 +529,7 @@ inline void sc_process_handle::throw_it( const EXCEPT& exception,
 //------------------------------------------------------------------------------
 inline sc_process_handle sc_process_b::last_created_process_handle()
 {
-    return sc_process_handle(m_last_created_process_p);
+    return sc_process_handle(last_created_process_base());
 }
 
 inline sc_process_handle sc_get_last_created_process_handle()
@@ -47,6 +47,7 @@ template<typename DATA> class sc_inout;
 template<typename DATA> class sc_out;
 template<typename SOURCE> class sc_spawn_reset;
 class sc_reset;
+class sc_signal_bank_base;
 class sc_process_b;
 
 //==============================================================================
@@ -118,6 +119,7 @@ class SC_API sc_reset {
     friend class sc_signal<bool, SC_ONE_WRITER>;
     friend class sc_signal<bool, SC_MANY_WRITERS>;
     friend class sc_signal<bool, SC_UNCHECKED_WRITERS>;
+    friend class sc_signal_bank_base;
     friend class sc_simcontext;
     template<typename SOURCE> friend class sc_spawn_reset;
     friend class sc_thread_process;
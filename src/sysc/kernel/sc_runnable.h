@@ -71,6 +71,8 @@ class SC_API sc_runnable
 
   public: // diagnostics:
     void dump() const;
+    inline std::size_t method_count() const;
+    inline std::size_t thread_count() const;
 
   private:
     sc_method_handle m_methods_push_head;
@@ -97,6 +97,48 @@ inline void sc_runnable::dump() const
     }
 }
 
+//------------------------------------------------------------------------------
+//"sc_runnable::method_count"
+//
+// This method returns the number of methods in the push and pop queues.
+//------------------------------------------------------------------------------
+inline std::size_t sc_runnable::method_count() const
+{
+    std::size_t count = 0;
+    for ( sc_method_handle p = m_methods_pop; p != SC_NO_METHODS;
+          p = p->next_runnable() )
+    {
+        count++;
+    }
+    for ( sc_method_handle p = m_methods_push_head->next_runnable();
+          p != SC_NO_METHODS; p = p->next_runnable() )
+    {
+        count++;
+    }
+    return count;
+}
+
+//------------------------------------------------------------------------------
+//"sc_runnable::thread_count"
+//
+// This method returns the number of threads in the push and pop queues.
+//------------------------------------------------------------------------------
+inline std::size_t sc_runnable::thread_count() const
+{
+    std::size_t count = 0;
+    for ( sc_thread_handle p = m_threads_pop; p != SC_NO_THREADS;
+          p = p->next_runnable() )
+    {
+        count++;
+    }
+    for ( sc_thread_handle p = m_threads_push_head->next_runnable();
+          p != SC_NO_THREADS; p = p->next_runnable() )
+    {
+        count++;
+    }
+    return count;
+}
+
 //------------------------------------------------------------------------------
 //"sc_runnable::execute_method_next"
 //
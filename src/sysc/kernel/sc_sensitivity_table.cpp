@@ -0,0 +1,110 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_sensitivity_table.cpp -- Contiguous table of the static sensitivity.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_sensitivity_table.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/kernel/sc_method_process.h"
+#include "sysc/kernel/sc_thread_process.h"
+
+#include <algorithm>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_sensitivity_table
+// ----------------------------------------------------------------------------
+
+sc_sensitivity_table::sc_sensitivity_table()
+  : m_events()
+  , m_added()
+  , m_entries()
+{}
+
+sc_sensitivity_table::~sc_sensitivity_table()
+{}
+
+void
+sc_sensitivity_table::add_events( const sc_process_b* process_p )
+{
+    const std::vector<const sc_event*>& events = process_p->m_static_events;
+    for ( std::size_t i = 0; i < events.size(); ++i )
+    {
+        if ( m_added.insert( events[i] ).second )
+            m_events.push_back( events[i] );
+    }
+}
+
+// The events are laid out in the order of their first process, so that
+// the events of the processes of a module end up close to each other.
+// Within a slice, the static methods are followed by the static threads,
+// each in the reverse order of their vectors, as sc_event::trigger
+// schedules them.
+
+void
+sc_sensitivity_table::build()
+{
+    std::size_t size = 0;
+    for ( std::size_t i = 0; i < m_events.size(); ++i )
+    {
+        size += m_events[i]->m_methods_static.size() +
+                m_events[i]->m_threads_static.size();
+    }
+    m_entries.resize( size );
+
+    std::size_t next = 0;
+    for ( std::size_t i = 0; i < m_events.size(); ++i )
+    {
+        const sc_event* event_p = m_events[i];
+        const std::vector<sc_method_handle>& methods =
+          event_p->m_methods_static;
+        const std::vector<sc_thread_handle>& threads =
+          event_p->m_threads_static;
+        if ( methods.empty() && threads.empty() )
+            continue;
+
+        event_p->m_static_slice = &m_entries[next];
+        next = std::copy( methods.rbegin(), methods.rend(),
+                          m_entries.begin() + next ) - m_entries.begin();
+        next = std::copy( threads.rbegin(), threads.rend(),
+                          m_entries.begin() + next ) - m_entries.begin();
+    }
+
+    m_events.clear();
+    m_added.clear();
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,95 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_sensitivity_table.h -- Contiguous table of the static sensitivity.
+
+  At the start of simulation, the processes statically sensitive to each
+  event are copied into one array, event after event, in the order in
+  which sc_event::trigger schedules them. An event with a slice in the
+  table triggers its static processes with a linear scan of the slice
+  instead of walking its own process vectors, which are separate heap
+  allocations. The vectors of the events remain authoritative: an event
+  whose static sensitivity changes during the simulation (e.g., through
+  a spawned or killed process) drops its slice and uses its vectors again.
+
+  FOR INTERNAL USE ONLY!
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_SENSITIVITY_TABLE_H_INCLUDED_
+#define SC_SENSITIVITY_TABLE_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#include <set>
+#include <vector>
+
+namespace sc_core {
+
+class sc_event;
+class sc_process_b;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_sensitivity_table
+//
+//  Static sensitivity of all events, laid out contiguously.
+// ----------------------------------------------------------------------------
+
+class sc_sensitivity_table
+{
+public:
+
+    sc_sensitivity_table();
+    ~sc_sensitivity_table();
+
+    // add the static events of a process
+    void add_events( const sc_process_b* );
+
+    // lay out the static sensitivity of the added events
+    void build();
+
+    std::size_t size() const { return m_entries.size(); }
+
+private:
+    std::vector<const sc_event*> m_events;   // events to lay out.
+    std::set<const sc_event*>    m_added;    // events added so far.
+    std::vector<sc_process_b*>   m_entries;  // event slices.
+
+private:
+    // disabled
+    sc_sensitivity_table( const sc_sensitivity_table& );
+    sc_sensitivity_table& operator = ( const sc_sensitivity_table& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_SENSITIVITY_TABLE_H_INCLUDED_
+// Taf!
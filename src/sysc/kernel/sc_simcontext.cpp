@@ -34,22 +34,31 @@
 #include "sysc/kernel/sc_cor_fiber.h"
 #include "sysc/kernel/sc_cor_pthread.h"
 #include "sysc/kernel/sc_cor_qt.h"
+#include "sysc/kernel/sc_checkpoint.h"
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_kernel_ids.h"
 #include "sysc/kernel/sc_module.h"
 #include "sysc/kernel/sc_module_registry.h"
 #include "sysc/kernel/sc_name_gen.h"
 #include "sysc/kernel/sc_object_manager.h"
+#include "sysc/kernel/sc_kernel_profiler.h"
+#include "sysc/kernel/sc_method_levelizer.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
+#include "sysc/kernel/sc_pdes.h"
+#include "sysc/kernel/sc_stack_profile.h"
 #include "sysc/kernel/sc_cthread_process.h"
 #include "sysc/kernel/sc_method_process.h"
 #include "sysc/kernel/sc_thread_process.h"
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_reset.h"
+#include "sysc/kernel/sc_sensitivity_table.h"
 #include "sysc/kernel/sc_ver.h"
 #include "sysc/kernel/sc_dynamic_processes.h"
 #include "sysc/kernel/sc_phase_callback_registry.h"
+#include "sysc/communication/sc_clock.h"
 #include "sysc/communication/sc_port.h"
 #include "sysc/communication/sc_export.h"
+#include "sysc/communication/sc_host_mutex.h"
 #include "sysc/communication/sc_prim_channel.h"
 #include "sysc/tracing/sc_trace.h"
 #include "sysc/utils/sc_mempool.h"
@@ -58,7 +67,10 @@
 #include "sysc/utils/sc_utils_ids.h"
 
 #include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <sstream>
 
 // DEBUGGING MACROS:
@@ -103,6 +115,47 @@ namespace sc_core {
 
 sc_stop_mode stop_mode = SC_STOP_FINISH_DELTA;
 
+static unsigned parallel_workers = 0;    // see sc_set_parallel_evaluation.
+static bool     parallel_inference = true;
+static bool     levelized_methods = false; // see sc_set_levelized_methods.
+
+// see sc_set_kernel_profile, constructed on first use
+
+static std::string&
+kernel_profile_file()
+{
+    static std::string file_name;
+    return file_name;
+}
+
+// see sc_set_stack_profile and sc_set_stack_sizes
+
+static std::string&
+stack_profile_file()
+{
+    static std::string file_name;
+    return file_name;
+}
+
+static std::string&
+stack_sizes_file()
+{
+    static std::string file_name;
+    return file_name;
+}
+
+// see sc_set_pdes_partition
+
+static int pdes_rank = 0;
+static int pdes_size = 1;
+
+static std::string&
+pdes_address()
+{
+    static std::string address( "/tmp/sc_pdes" );
+    return address;
+}
+
 // ----------------------------------------------------------------------------
 //  CLASS : sc_process_table
 //
@@ -206,8 +259,8 @@ sc_notify_time_compare( const void* p1, const void* p2 )
     const sc_event_timed* et1 = static_cast<const sc_event_timed*>( p1 );
     const sc_event_timed* et2 = static_cast<const sc_event_timed*>( p2 );
 
-    const sc_time& t1 = et1->notify_time();
-    const sc_time& t2 = et2->notify_time();
+    const sc_time& t1 = et1->key_time();
+    const sc_time& t2 = et2->key_time();
 
     if( t1 < t2 ) {
 	return 1;
@@ -321,6 +374,7 @@ sc_simcontext::init()
     m_name_gen = new sc_name_gen;
     m_process_table = new sc_process_table;
     m_current_writer = 0;
+    m_last_created_process_p = 0;
 
 
     // CHECK FOR ENVIRONMENT VARIABLES THAT MODIFY SIMULATOR EXECUTION:
@@ -334,14 +388,64 @@ sc_simcontext::init()
     else
         m_write_check = SC_SIGNAL_WRITE_CHECK_DEFAULT_;
 
+    const char* parallel = std::getenv("SC_PARALLEL_EVALUATION");
+    if ( parallel != NULL )
+        parallel_workers = static_cast<unsigned>( std::atoi( parallel ) );
+
+    const char* timing_wheel = std::getenv("SC_TIMING_WHEEL");
+
+    const char* skip_ahead = std::getenv("SC_CLOCK_SKIP_AHEAD");
+
+    const char* levelized = std::getenv("SC_LEVELIZED_METHODS");
+    if ( levelized != NULL )
+        levelized_methods = std::strcmp( levelized, "0" ) != 0;
+
+    const char* profile = std::getenv("SC_KERNEL_PROFILE");
+    if ( profile != NULL )
+        kernel_profile_file() = profile;
+
+    const char* stack_profile = std::getenv("SC_STACK_PROFILE");
+    if ( stack_profile != NULL )
+        stack_profile_file() = stack_profile;
+
+    const char* stack_sizes = std::getenv("SC_STACK_SIZES");
+    if ( stack_sizes != NULL )
+        stack_sizes_file() = stack_sizes;
+
+    const char* partition = std::getenv("SC_PDES_PARTITION");
+    if ( partition != NULL )
+    {
+        int rank = 0, size = 1, length = 0;
+        if ( std::sscanf( partition, "%d,%d%n", &rank, &size, &length ) == 2
+             && rank >= 0 && rank < size )
+        {
+            pdes_rank = rank;
+            pdes_size = size;
+            if ( partition[length] == ',' )
+                pdes_address() = partition + length + 1;
+        }
+    }
+
     // FINISH INITIALIZATIONS:
 
     reset_curr_proc();
     m_next_proc_id = -1;
-    m_timed_events = new sc_ppq<sc_event_timed*>( 128, sc_notify_time_compare );
+    m_timed_events = new sc_timing_wheel;
+    if ( timing_wheel != NULL && std::strcmp( timing_wheel, "0" ) != 0 )
+        m_timed_events->set_wheel_enabled( true );
     m_something_to_trace = false;
+    m_clock_skip_ahead = skip_ahead != NULL && std::strcmp( skip_ahead, "0" ) != 0;
     m_runnable = new sc_runnable;
     m_collectable = new sc_process_list;
+    m_parallel_evaluator = 0;
+    m_parallel_evaluation = false;
+    m_method_levelizer = 0;
+    m_levelizing = false;
+    m_profiler = 0;
+    m_stack_profile = 0;
+    m_checkpoint = 0;
+    m_sensitivity_table = 0;
+    m_pdes = 0;
     m_time_params = new sc_time_params;
     m_curr_time = SC_ZERO_TIME;
     m_max_time = SC_ZERO_TIME;
@@ -362,6 +466,9 @@ sc_simcontext::init()
     m_start_of_simulation_called = false;
     m_end_of_simulation_called = false;
     m_simulation_status = SC_ELABORATION;
+    m_sc_start_called = false;
+    m_stop_warning_issued = false;
+    m_deprecated_calls = 0;
 }
 
 void
@@ -370,13 +477,29 @@ sc_simcontext::clean()
     // remove remaining zombie processes
     do_collect_processes();
 
+    delete m_parallel_evaluator;
+    delete m_method_levelizer;
+    if ( m_profiler )
+    {
+        m_profiler->write();
+        delete m_profiler;
+    }
+    if ( m_stack_profile )
+    {
+        m_stack_profile->write();
+        delete m_stack_profile;
+        m_stack_profile = 0;
+    }
+    delete m_checkpoint;
+    delete m_sensitivity_table;
+    delete m_pdes;
+    m_pdes = 0;
     delete m_method_invoker_p;
     delete m_error;
     delete m_cor_pkg;
     delete m_time_params;
     delete m_collectable;
     delete m_runnable;
-    delete m_timed_events;
     delete m_process_table;
     delete m_name_gen;
     delete m_phase_cb_registry;
@@ -386,9 +509,16 @@ sc_simcontext::clean()
     delete m_module_registry;
     delete m_object_manager;
 
+    // the processes and objects deleted above cancel their pending timed
+    // notifications, so the queue goes last
+    delete m_timed_events;
+    m_timed_events = 0;
+
     m_delta_events.clear();
     m_child_objects.clear();
     m_trace_files.clear();
+    m_clocks.clear();
+    m_parked_clocks.clear();
 
     while( m_reset_finder_q ) {
         sc_reset_finder* rf = m_reset_finder_q;
@@ -403,9 +533,15 @@ sc_simcontext::sc_simcontext() :
     m_export_registry(0), m_prim_channel_registry(0),
     m_phase_cb_registry(0), m_name_gen(0),
     m_process_table(0), m_curr_proc_info(), m_current_writer(0),
+    m_last_created_process_p(0),
     m_write_check(SC_SIGNAL_WRITE_CHECK_DEFAULT_), m_next_proc_id(-1),
     m_child_events(), m_child_objects(), m_delta_events(), m_timed_events(0),
-    m_trace_files(), m_something_to_trace(false), m_runnable(0), m_collectable(0),
+    m_trace_files(), m_something_to_trace(false),
+    m_clocks(), m_parked_clocks(), m_clock_skip_ahead(false),
+    m_runnable(0), m_collectable(0),
+    m_parallel_evaluator(0), m_parallel_evaluation(false),
+    m_method_levelizer(0), m_levelizing(false), m_profiler(0),
+    m_stack_profile(0), m_checkpoint(0), m_sensitivity_table(0), m_pdes(0),
     m_time_params(), m_curr_time(SC_ZERO_TIME), m_max_time(SC_ZERO_TIME),
     m_change_stamp(0), m_delta_count(0), m_initial_delta_count_at_current_time(0),
     m_forced_stop(false), m_paused(false),
@@ -474,12 +610,24 @@ sc_simcontext::crunch( bool once )
 
 	m_execution_phase = phase_evaluate;
 	bool empty_eval_phase = true;
+	if ( SC_UNLIKELY_(m_profiler) )
+	    m_profiler->begin_delta();
 	while( true )
 	{
 
 	    // execute method processes
 
 	    m_runnable->toggle_methods();
+	    if ( m_parallel_evaluator &&
+	         !m_parallel_evaluator->run_methods( empty_eval_phase ) )
+	    {
+		goto out;
+	    }
+	    if ( m_method_levelizer &&
+	         !m_method_levelizer->run_methods( empty_eval_phase ) )
+	    {
+		goto out;
+	    }
 	    sc_method_handle method_h = pop_runnable_method();
 	    while( method_h != 0 ) {
 		empty_eval_phase = false;
@@ -533,6 +681,8 @@ sc_simcontext::crunch( bool once )
 	{
 //	    SC_DO_PHASE_CALLBACK_(evaluation_done);
 	    m_change_stamp++;
+	    if ( SC_UNLIKELY_(m_profiler) )
+		m_profiler->end_delta();
 	}
 	m_prim_channel_registry->perform_update();
 	SC_DO_PHASE_CALLBACK_(update_done);
@@ -567,16 +717,7 @@ sc_simcontext::crunch( bool once )
 	// Process delta notifications which will queue processes for
 	// subsequent execution.
 
-        int size = m_delta_events.size();
-	if ( size != 0 )
-	{
-	    sc_event** l_events = &m_delta_events[0];
-	    int i = size - 1;
-	    do {
-		l_events[i]->trigger();
-	    } while( -- i >= 0 );
-	    m_delta_events.clear();
-	}
+        trigger_delta_events();
 
 	if ( !empty_eval_phase )
 		m_delta_count ++;
@@ -704,6 +845,85 @@ sc_simcontext::prepare_to_simulate()
         return;
     }
 
+    // CONNECT THE PARTITIONS OF A DISTRIBUTED SIMULATION:
+
+    if ( pdes_size > 1 )
+        pdes();
+    if ( m_pdes )
+        m_pdes->start();
+
+    // START THE PARALLEL EVALUATION OF METHODS IF REQUESTED:
+
+    if ( parallel_workers > 1 )
+    {
+#if SC_HAS_PARALLEL_EVALUATION_
+        m_parallel_evaluator = new sc_parallel_evaluator( *this,
+            parallel_workers, parallel_inference );
+        m_parallel_evaluator->start_simulation();
+#else
+        SC_REPORT_WARNING( SC_ID_PARALLEL_EVALUATION_,
+                           "not supported in this build, using sequential "
+                           "evaluation" );
+#endif
+    }
+
+    // LEVELIZE THE METHOD PROCESSES IF REQUESTED:
+
+    if ( levelized_methods )
+    {
+        if ( m_parallel_evaluator )
+        {
+            SC_REPORT_WARNING( SC_ID_LEVELIZED_METHODS_,
+                               "not supported with parallel evaluation, "
+                               "using dynamic scheduling" );
+        }
+        else
+        {
+            m_method_levelizer = new sc_method_levelizer( *this );
+            m_method_levelizer->start_simulation();
+        }
+    }
+
+    // PROFILE THE PROCESSES IF REQUESTED:
+
+    if ( !kernel_profile_file().empty() )
+    {
+        m_profiler = new sc_kernel_profiler( *this, kernel_profile_file() );
+        for ( method_p = m_process_table->method_q_head();
+              method_p; method_p = method_p->next_exist() )
+        {
+            m_profiler->attach( method_p );
+        }
+        for ( thread_p = m_process_table->thread_q_head();
+              thread_p; thread_p = thread_p->next_exist() )
+        {
+            m_profiler->attach( thread_p );
+        }
+    }
+
+    // MEASURE OR SIZE THE THREAD STACKS IF REQUESTED:
+
+    if ( !stack_profile_file().empty() || !stack_sizes_file().empty() )
+    {
+        m_stack_profile =
+          new sc_stack_profile( stack_profile_file(), stack_sizes_file() );
+    }
+
+    // LAY OUT THE STATIC SENSITIVITY OF THE EVENTS:
+
+    m_sensitivity_table = new sc_sensitivity_table;
+    for ( method_p = m_process_table->method_q_head();
+          method_p; method_p = method_p->next_exist() )
+    {
+        m_sensitivity_table->add_events( method_p );
+    }
+    for ( thread_p = m_process_table->thread_q_head();
+          thread_p; thread_p = thread_p->next_exist() )
+    {
+        m_sensitivity_table->add_events( thread_p );
+    }
+    m_sensitivity_table->build();
+
     // PREPARE ALL (C)THREAD PROCESSES FOR SIMULATION:
 
     for ( thread_p = m_process_table->thread_q_head();
@@ -716,23 +936,30 @@ sc_simcontext::prepare_to_simulate()
     m_ready_to_simulate = true;
     m_runnable->init();
 
+    // RESTORE THE STATE OF A CHECKPOINT IF REQUESTED:
+
+    if ( m_checkpoint )
+        apply_checkpoint();
+
     // update phase
 
     m_execution_phase = phase_update;
     m_prim_channel_registry->perform_update();
     m_execution_phase = phase_notify;
 
-    int size;
-
     // make all method processes runnable
+    // (after a checkpoint has been restored, only the ones that were
+    // runnable or waiting on dynamic sensitivity)
 
     for ( method_p = m_process_table->method_q_head();
 	  method_p; method_p = method_p->next_exist() )
     {
+	bool initialize = m_checkpoint ? m_checkpoint->initialize( method_p )
+	                               : !method_p->dont_initialize();
 	if ( ((method_p->m_state & sc_process_b::ps_bit_disabled) != 0) ||
-	     method_p->dont_initialize() )
+	     !initialize )
 	{
-	    if ( method_p->m_static_events.size() == 0 )
+	    if ( method_p->m_static_events.size() == 0 && !m_checkpoint )
 	    {
 	        SC_REPORT_WARNING( SC_ID_DISABLE_WILL_ORPHAN_PROCESS_,
 		                   method_p->name() );
@@ -755,10 +982,12 @@ sc_simcontext::prepare_to_simulate()
     for ( thread_p = m_process_table->thread_q_head();
 	  thread_p; thread_p = thread_p->next_exist() )
     {
+	bool initialize = m_checkpoint ? m_checkpoint->initialize( thread_p )
+	                               : !thread_p->dont_initialize();
 	if ( ((thread_p->m_state & sc_process_b::ps_bit_disabled) != 0) ||
-	     thread_p->dont_initialize() )
+	     !initialize )
 	{
-	    if ( thread_p->m_static_events.size() == 0 )
+	    if ( thread_p->m_static_events.size() == 0 && !m_checkpoint )
 	    {
 	        SC_REPORT_WARNING( SC_ID_DISABLE_WILL_ORPHAN_PROCESS_,
 		                   thread_p->name() );
@@ -778,14 +1007,10 @@ sc_simcontext::prepare_to_simulate()
 
     // process delta notifications
 
-    if( ( size = m_delta_events.size() ) != 0 ) {
-        sc_event** l_delta_events = &m_delta_events[0];
-        int i = size - 1;
-        do {
-            l_delta_events[i]->trigger();
-        } while( -- i >= 0 );
-        m_delta_events.clear();
-    }
+    trigger_delta_events();
+
+    delete m_checkpoint;
+    m_checkpoint = 0;
 
     SC_DO_PHASE_CALLBACK_(initialization_done);
 }
@@ -901,6 +1126,10 @@ sc_simcontext::simulate( const sc_time& duration )
 	do {
 	    // See note 1 above:
 
+            if ( m_pdes )
+                m_pdes->synchronize( until_t );
+            else if ( m_clock_skip_ahead && m_trace_files.empty() )
+                skip_idle_clocks( until_t );
             if ( !next_time(t) || (t > until_t) ) {
                 if ( (t > until_t) || m_prim_channel_registry->async_suspend() ) {
                     // requested simulation time completed or no external updates
@@ -918,7 +1147,7 @@ sc_simcontext::simulate( const sc_time& duration )
 	    do {
 		sc_event_timed* et = m_timed_events->extract_top();
 		sc_event* e = et->event();
-		delete et;
+		sc_event_timed::retire( et );
 		if( e != 0 ) {
 		    e->trigger();
 		}
@@ -932,6 +1161,8 @@ exit_time:  // final simulation time update, if needed
     if ( t > m_curr_time && t <= until_t )
         do_timestep(t);
 exit_pause: // call pause callback upon implicit or explicit pause
+    if ( !m_parked_clocks.empty() )
+        resume_parked_clocks();
     m_execution_phase      = phase_evaluate;
     m_in_simulator_control = false;
     SC_DO_PHASE_CALLBACK_(simulation_paused);
@@ -953,12 +1184,111 @@ sc_simcontext::do_timestep(const sc_time& t)
     m_curr_time = t;
     m_change_stamp++;
     m_initial_delta_count_at_current_time = m_delta_count;
+    if ( SC_UNLIKELY_(m_profiler) )
+        m_profiler->timestep();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::trigger_delta_events"
+// |
+// | This method triggers the events notified for the next delta cycle, in
+// | the reverse order of their notification, and empties the list. While an
+// | event is triggered, the next one is fetched into the cache.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::trigger_delta_events()
+{
+    int size = m_delta_events.size();
+    if ( size == 0 )
+        return;
+
+    sc_event** l_events = &m_delta_events[0];
+    int i = size - 1;
+    do {
+        if ( i > 0 )
+            SC_PREFETCH_( l_events[i - 1] );
+        l_events[i]->trigger();
+    } while( -- i >= 0 );
+    m_delta_events.clear();
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::skip_idle_clocks"
+// |
+// | This method lets the simulation time advance over the edges of clocks
+// | that no process observes. It is called before the time advances:
+// |   (1) Parked clocks that got an observer resume their edges.
+// |   (2) Clocks without observers are parked, i.e., their next edge is
+// |       cancelled and its time kept.
+// |   (3) The parked clocks take the value of their edges before the next
+// |       pending notification, without notifying their events. An edge at
+// |       the time of that notification happens as usual, so the value of a
+// |       clock is exact whenever a process runs. If nothing is pending up
+// |       to until_t, the last edge up to until_t happens as usual, so the
+// |       time advances as far as it would without the skip-ahead.
+// |
+// | Arguments:
+// |     until_t = time the simulation runs to.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::skip_idle_clocks( const sc_time& until_t )
+{
+    std::size_t i;
+    for ( i = 0; i < m_parked_clocks.size(); )
+    {
+        if ( m_parked_clocks[i]->observed() )
+        {
+            m_parked_clocks[i]->unpark();
+            m_parked_clocks[i] = m_parked_clocks.back();
+            m_parked_clocks.pop_back();
+        }
+        else
+            ++i;
+    }
+    for ( i = 0; i < m_clocks.size(); ++i )
+    {
+        if ( m_clocks[i]->park() )
+            m_parked_clocks.push_back( m_clocks[i] );
+    }
+    if ( m_parked_clocks.empty() )
+        return;
+
+    sc_time t;
+    bool pending = next_time( t ) && t <= until_t;
+    for ( i = 0; i < m_parked_clocks.size(); )
+    {
+        if ( m_parked_clocks[i]->skip_edges( pending ? t : until_t, !pending ) )
+        {
+            m_parked_clocks[i]->unpark();
+            m_parked_clocks[i] = m_parked_clocks.back();
+            m_parked_clocks.pop_back();
+        }
+        else
+            ++i;
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::resume_parked_clocks"
+// |
+// | This method resumes the edges of all parked clocks when the simulation
+// | pauses, so that the pending notifications are complete between calls
+// | of sc_start.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::resume_parked_clocks()
+{
+    for ( std::size_t i = 0; i < m_parked_clocks.size(); ++i )
+        m_parked_clocks[i]->unpark();
+    m_parked_clocks.clear();
 }
 
 void
 sc_simcontext::do_sc_stop_action()
 {
     SC_REPORT_INFO("/OSCI/SystemC","Simulation stopped by user.");
+    if ( m_pdes )
+        m_pdes->stop();
     if (m_start_of_simulation_called) {
 	end();
 	m_in_simulator_control = false;
@@ -1002,12 +1332,17 @@ void sc_simcontext::do_collect_processes()
 void
 sc_simcontext::stop()
 {
-    static bool stop_warning_issued = false;
+    if ( SC_UNLIKELY_(m_parallel_evaluation) )
+    {
+        sc_parallel_evaluator::defer( sc_parallel_evaluator::op_stop );
+        return;
+    }
+
     if (m_forced_stop)
     {
-        if ( !stop_warning_issued )
+        if ( !m_stop_warning_issued )
         {
-            stop_warning_issued = true; // This must be before the WARNING!!!
+            m_stop_warning_issued = true; // This must be before the WARNING!!!
             SC_REPORT_WARNING(SC_ID_SIMULATION_STOP_CALLED_TWICE_, "");
         }
         return;
@@ -1020,6 +1355,31 @@ sc_simcontext::stop()
     }
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::parallel_curr_proc_info"
+// |
+// | These methods provide the per-worker view of the process information,
+// | the current writer and the error state while method processes are
+// | executed by the parallel evaluator.
+// +----------------------------------------------------------------------------
+sc_curr_proc_handle
+sc_simcontext::parallel_curr_proc_info() const
+{
+    return sc_parallel_evaluator::curr_proc_info();
+}
+
+sc_process_b*
+sc_simcontext::parallel_current_writer() const
+{
+    return sc_parallel_evaluator::current_writer();
+}
+
+void
+sc_simcontext::parallel_set_error( sc_report* err )
+{
+    sc_parallel_evaluator::defer( sc_parallel_evaluator::op_error, err );
+}
+
 void
 sc_simcontext::reset()
 {
@@ -1038,6 +1398,10 @@ sc_simcontext::end()
     m_module_registry->simulation_done();
     SC_DO_PHASE_CALLBACK_(simulation_done);
     m_end_of_simulation_called = true;
+    if ( m_profiler )
+        m_profiler->write();
+    if ( m_stack_profile )
+        m_stack_profile->write();
 }
 
 void
@@ -1070,13 +1434,30 @@ sc_simcontext::next_object()
     return m_object_manager->next_object();
 }
 
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::first_deprecated_call"
+// |
+// | This method records the call of a deprecated function, so that its
+// | deprecation is reported once per simulation context.
+// |
+// | Arguments:
+// |     function = the deprecated function being called.
+// | Result is true for the first call of the function, false afterwards.
+// +----------------------------------------------------------------------------
+bool
+sc_simcontext::first_deprecated_call( deprecated_function function ) const
+{
+    if ( m_deprecated_calls & function )
+        return false;
+    m_deprecated_calls |= function;
+    return true;
+}
+
 sc_object*
 sc_simcontext::find_object( const char* name )
 {
-    static bool warn_find_object=true;
-    if ( warn_find_object )
+    if ( first_deprecated_call( deprecated_find_object ) )
     {
-	warn_find_object = false;
 	SC_REPORT_INFO(SC_ID_IEEE_1666_DEPRECATION_,
 	    "sc_simcontext::find_object() is deprecated,\n" \
             " use sc_find_object()" );
@@ -1134,6 +1515,12 @@ sc_simcontext::gen_unique_name( const char* basename_, bool preserve_first )
     return m_name_gen->gen_unique_name( basename_, preserve_first );
 }
 
+int
+sc_simcontext::gen_unique_names( const char* basename_, int n_ )
+{
+    return m_name_gen->gen_unique_names( basename_, n_ );
+}
+
 
 sc_process_handle
 sc_simcontext::create_cthread_process(
@@ -1142,6 +1529,8 @@ sc_simcontext::create_cthread_process(
 {
     sc_thread_handle handle =
         new sc_cthread_process(name_p, free_host, method_p, host_p, opt_p);
+    if ( SC_UNLIKELY_(m_profiler) )
+        m_profiler->attach( handle );
     if ( m_ready_to_simulate )
     {
 	handle->prepare_for_simulation();
@@ -1159,6 +1548,8 @@ sc_simcontext::create_method_process(
 {
     sc_method_handle handle =
         new sc_method_process(name_p, free_host, method_p, host_p, opt_p);
+    if ( SC_UNLIKELY_(m_profiler) )
+        m_profiler->attach( handle );
     if ( m_ready_to_simulate ) { // dynamic process
 	if ( !handle->dont_initialize() )
         {
@@ -1199,6 +1590,8 @@ sc_simcontext::create_thread_process(
 {
     sc_thread_handle handle =
         new sc_thread_process(name_p, free_host, method_p, host_p, opt_p);
+    if ( SC_UNLIKELY_(m_profiler) )
+        m_profiler->attach( handle );
     if ( m_ready_to_simulate ) { // dynamic process
 	handle->prepare_for_simulation();
         if ( !handle->dont_initialize() )
@@ -1278,10 +1671,8 @@ sc_simcontext::add_reset_finder( sc_reset_finder* reset_finder )
 const ::std::vector<sc_object*>&
 sc_simcontext::get_child_objects() const
 {
-    static bool warn_get_child_objects=true;
-    if ( warn_get_child_objects )
+    if ( first_deprecated_call( deprecated_get_child_objects ) )
     {
-	warn_get_child_objects = false;
 	SC_REPORT_INFO(SC_ID_IEEE_1666_DEPRECATION_,
 	    "sc_simcontext::get_child_objects() is deprecated,\n" \
             " use sc_get_top_level_objects()" );
@@ -1320,11 +1711,11 @@ sc_simcontext::remove_child_event( sc_event* event_ )
 void
 sc_simcontext::remove_child_object( sc_object* object_ )
 {
-    int size = m_child_objects.size();
-    for( int i = 0; i < size; ++ i ) {
+    // search from the back and keep the order, see
+    // sc_object::remove_child_object
+    for( int i = m_child_objects.size() - 1; i >= 0; -- i ) {
 	if( object_ == m_child_objects[i] ) {
-	    m_child_objects[i] = m_child_objects[size - 1];
-	    m_child_objects.pop_back();
+	    m_child_objects.erase( m_child_objects.begin() + i );
 	    return;
 	}
     }
@@ -1334,10 +1725,8 @@ sc_simcontext::remove_child_object( sc_object* object_ )
 sc_dt::uint64
 sc_simcontext::delta_count() const
 {
-    static bool warn_delta_count=true;
-    if ( warn_delta_count )
+    if ( first_deprecated_call( deprecated_delta_count ) )
     {
-	warn_delta_count = false;
 	SC_REPORT_INFO(SC_ID_IEEE_1666_DEPRECATION_,
 	    "sc_simcontext::delta_count() is deprecated, use sc_delta_count()" );
     }
@@ -1347,10 +1736,8 @@ sc_simcontext::delta_count() const
 bool
 sc_simcontext::is_running() const
 {
-    static bool warn_is_running=true;
-    if ( warn_is_running )
+    if ( first_deprecated_call( deprecated_is_running ) )
     {
-	warn_is_running = false;
 	SC_REPORT_INFO(SC_ID_IEEE_1666_DEPRECATION_,
 	    "sc_simcontext::is_running() is deprecated, use sc_is_running()" );
     }
@@ -1377,7 +1764,7 @@ sc_simcontext::next_time( sc_time& result ) const
 	    result = et->notify_time();
 	    return true;
 	}
-	delete m_timed_events->extract_top();
+	sc_event_timed::retire( m_timed_events->extract_top() );
     }
     return false;
 }
@@ -1530,36 +1917,322 @@ sc_simcontext::trace_cycle( bool delta_cycle )
     }
 }
 
+// report a checkpoint warning followed by the first few of a list of names
+
+static void
+report_checkpoint_names( const char* msg, const std::vector<std::string>& names )
+{
+    const std::size_t max_names = 8;
+    if ( names.empty() )
+        return;
+
+    std::stringstream text;
+    text << msg << ':';
+    for ( std::size_t i = 0; i < names.size() && i < max_names; ++i )
+        text << ' ' << names[i];
+    if ( names.size() > max_names )
+        text << " ... (" << names.size() << " in total)";
+    SC_REPORT_WARNING( SC_ID_CHECKPOINT_, text.str().c_str() );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::save_checkpoint"
+// |
+// | This method writes the state of the paused simulation to a stream. Only
+// | the notifications of the events in the object hierarchy and the
+// | timeouts of the processes are saved, the kernel events of the primitive
+// | channels (e.g., of sc_clock) are saved by the channels themselves.
+// | Events without a name cannot be restored, neither can the channels
+// | whose values have no operator >>; both are reported.
+// |
+// | Arguments:
+// |     os = stream to write the checkpoint to.
+// | Result is true if the checkpoint has been written.
+// +----------------------------------------------------------------------------
+bool
+sc_simcontext::save_checkpoint( std::ostream& os )
+{
+    if ( get_status() != SC_PAUSED )
+    {
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_,
+                         "may only be saved while the simulation is paused" );
+        return false;
+    }
+
+    sc_checkpoint checkpoint;
+    checkpoint.m_resolution = m_time_params->time_resolution;
+    checkpoint.m_time = m_curr_time.value();
+    checkpoint.m_delta_count = m_delta_count;
+    checkpoint.m_delta_count_at_time = m_initial_delta_count_at_current_time;
+    checkpoint.m_change_stamp = m_change_stamp;
+
+    for ( sc_method_handle method_p = m_process_table->method_q_head();
+          method_p; method_p = method_p->next_exist() )
+    {
+        checkpoint.save_process( method_p );
+    }
+    for ( sc_thread_handle thread_p = m_process_table->thread_q_head();
+          thread_p; thread_p = thread_p->next_exist() )
+    {
+        checkpoint.save_process( thread_p );
+    }
+
+    int unnamed = 0;
+    std::vector<sc_event_timed*> timed;
+    m_timed_events->pending( timed );
+    for ( std::size_t i = 0; i < timed.size(); ++i )
+    {
+        const sc_event* e = timed[i]->event();
+        if ( e->m_name.empty() )
+            ++unnamed;
+        else if ( m_object_manager->find_event( e->m_name.c_str() ) == e )
+        {
+            sc_checkpoint::notification n;
+            n.event = e->m_name;
+            n.time = timed[i]->notify_time().value();
+            checkpoint.m_timed.push_back( n );
+        }
+    }
+    for ( std::size_t i = 0; i < m_delta_events.size(); ++i )
+    {
+        const sc_event* e = m_delta_events[i];
+        if ( e->m_name.empty() )
+            ++unnamed;
+        else if ( m_object_manager->find_event( e->m_name.c_str() ) == e )
+            checkpoint.m_delta.push_back( e->m_name );
+    }
+    if ( unnamed )
+    {
+        std::stringstream msg;
+        msg << unnamed << " notification(s) of unnamed events not saved";
+        SC_REPORT_WARNING( SC_ID_CHECKPOINT_, msg.str().c_str() );
+    }
+
+    std::vector<std::string> unsaved;
+    checkpoint.save_objects( m_child_objects, unsaved );
+    report_checkpoint_names( "state of objects not saved", unsaved );
+
+    if ( !checkpoint.write( os ) )
+    {
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_, "write failed" );
+        return false;
+    }
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::restore_checkpoint"
+// |
+// | This method reads a checkpoint from a stream. Its state is restored when
+// | the simulation starts, after the start_of_simulation callbacks, see
+// | apply_checkpoint.
+// |
+// | Arguments:
+// |     is = stream to read the checkpoint from.
+// | Result is true if the checkpoint has been read.
+// +----------------------------------------------------------------------------
+bool
+sc_simcontext::restore_checkpoint( std::istream& is )
+{
+    if ( m_ready_to_simulate )
+    {
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_,
+                         "may only be restored before the simulation starts" );
+        return false;
+    }
+
+    sc_checkpoint* checkpoint_p = new sc_checkpoint;
+    if ( !checkpoint_p->read( is ) )
+    {
+        delete checkpoint_p;
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_, "invalid checkpoint" );
+        return false;
+    }
+    if ( checkpoint_p->m_resolution != m_time_params->time_resolution )
+    {
+        delete checkpoint_p;
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_,
+                         "saved with a different time resolution" );
+        return false;
+    }
+
+    delete m_checkpoint;
+    m_checkpoint = checkpoint_p;
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_simcontext::apply_checkpoint"
+// |
+// | This method restores the state of the checkpoint read by
+// | restore_checkpoint. The notifications pending in the new model, e.g.,
+// | the first edges of the clocks, are cancelled and replaced by the ones
+// | saved, the events are looked up by name in the object hierarchy, and
+// | the method processes waiting on a timeout only are triggered by it
+// | again. Then the modules and primitive channels restore their state,
+// | which includes the notifications of their kernel events.
+// |
+// | The thread processes that were suspended within their functions start
+// | from the beginning and lose their pending waits, the method processes
+// | that were waiting on events run once in the initialization phase (see
+// | sc_checkpoint::initialize); both are reported.
+// +----------------------------------------------------------------------------
+void
+sc_simcontext::apply_checkpoint()
+{
+    std::vector<sc_event*>       notified( m_delta_events );
+    std::vector<sc_event_timed*> timed;
+
+    m_timed_events->pending( timed );
+    for ( std::size_t i = 0; i < timed.size(); ++i )
+        notified.push_back( timed[i]->event() );
+    for ( std::size_t i = 0; i < notified.size(); ++i )
+        notified[i]->cancel();
+
+    m_curr_time = sc_time::from_value( m_checkpoint->m_time );
+    m_delta_count = m_checkpoint->m_delta_count;
+    m_initial_delta_count_at_current_time =
+      m_checkpoint->m_delta_count_at_time;
+    m_change_stamp = m_checkpoint->m_change_stamp;
+
+    std::size_t timed_count = m_checkpoint->m_timed.size();
+    for ( std::size_t i = 0; i < timed_count + m_checkpoint->m_delta.size();
+          ++i )
+    {
+        const std::string& name = i < timed_count
+                                ? m_checkpoint->m_timed[i].event
+                                : m_checkpoint->m_delta[i - timed_count];
+        sc_event* e = m_object_manager->find_event( name.c_str() );
+        if ( !e )
+        {
+            std::string msg = "event not found, notification not restored: "
+                            + name;
+            SC_REPORT_WARNING( SC_ID_CHECKPOINT_, msg.c_str() );
+            continue;
+        }
+        if ( i < timed_count )
+            e->notify_internal(
+              sc_time::from_value( m_checkpoint->m_timed[i].time ) -
+              m_curr_time );
+        else
+            e->notify_internal( SC_ZERO_TIME );
+    }
+
+    // processes that terminated stay disabled
+
+    std::vector<std::string> rerun;
+    std::vector<std::string> restarted;
+    sc_dt::uint64            timeout;
+
+    for ( sc_method_handle method_p = m_process_table->method_q_head();
+          method_p; method_p = method_p->next_exist() )
+    {
+        if ( m_checkpoint->process_flag( method_p, sc_checkpoint::disabled ) ||
+             m_checkpoint->process_flag( method_p, sc_checkpoint::terminated ) )
+            method_p->m_state |= sc_process_b::ps_bit_disabled;
+        if ( m_checkpoint->process_flag( method_p, sc_checkpoint::suspended ) )
+            method_p->m_state |= sc_process_b::ps_bit_suspended;
+
+        if ( m_checkpoint->process_flag( method_p, sc_checkpoint::terminated ) ||
+             m_checkpoint->process_flag( method_p, sc_checkpoint::ready ) )
+            continue;
+        if ( m_checkpoint->process_flag( method_p, sc_checkpoint::triggered ) )
+            rerun.push_back( method_p->name() );
+        else if ( m_checkpoint->process_timeout( method_p, timeout ) )
+            method_p->next_trigger( sc_time::from_value( timeout ) -
+                                    m_curr_time );
+    }
+    for ( sc_thread_handle thread_p = m_process_table->thread_q_head();
+          thread_p; thread_p = thread_p->next_exist() )
+    {
+        if ( m_checkpoint->process_flag( thread_p, sc_checkpoint::disabled ) ||
+             m_checkpoint->process_flag( thread_p, sc_checkpoint::terminated ) )
+            thread_p->m_state |= sc_process_b::ps_bit_disabled;
+        if ( m_checkpoint->process_flag( thread_p, sc_checkpoint::suspended ) )
+            thread_p->m_state |= sc_process_b::ps_bit_suspended;
+
+        if ( !m_checkpoint->process_flag( thread_p, sc_checkpoint::terminated )
+             && ( m_checkpoint->process_flag( thread_p, sc_checkpoint::busy ) ||
+                  m_checkpoint->process_timeout( thread_p, timeout ) ) )
+            restarted.push_back( thread_p->name() );
+    }
+    report_checkpoint_names( "threads suspended within their functions "
+                             "restart from the beginning", restarted );
+    report_checkpoint_names( "methods waiting on events run once "
+                             "instead", rerun );
+
+    m_checkpoint->restore_objects();
+}
+
 // ----------------------------------------------------------------------------
 
-#if 1
-#ifdef PURIFY
-	static sc_simcontext sc_default_global_context;
-	sc_simcontext* sc_curr_simcontext = &sc_default_global_context;
-#else
-	SC_API sc_simcontext* sc_curr_simcontext = 0;
-	SC_API sc_simcontext* sc_default_global_context = 0;
-#endif
-#else
-// Not MT-safe!
-static sc_simcontext* sc_curr_simcontext = 0;
+SC_API sc_simcontext* sc_default_global_context = 0;
 
+#if !defined(SC_WIN_DLL) || !( defined(_WIN32) || defined(_WIN64) )
+SC_API SC_THREAD_LOCAL_ sc_simcontext* sc_curr_simcontext = 0;
+#else
+static SC_THREAD_LOCAL_ sc_simcontext* sc_curr_simcontext = 0;
+static sc_simcontext* sc_use_default_simcontext();
 
 SC_API sc_simcontext*
 sc_get_curr_simcontext()
 {
-    if( sc_curr_simcontext == 0 ) {
-#ifdef PURIFY
-        static sc_simcontext sc_default_global_context;
-        sc_curr_simcontext = &sc_default_global_context;
+    if( SC_UNLIKELY_( sc_curr_simcontext == 0 ) ) {
+        return sc_use_default_simcontext();
+    }
+    return sc_curr_simcontext;
+}
+#endif
+
+static sc_host_mutex& default_simcontext_mutex()
+{
+    static sc_host_mutex* mutex_p = new sc_host_mutex;
+    return *mutex_p;
+}
+
+//------------------------------------------------------------------------------
+//"sc_use_default_simcontext"
+//
+// This function makes the default simulation context the current one of a
+// host thread that has none, e.g. the thread running sc_main or a host
+// thread notifying events of the simulation. The first call creates the
+// default context.
+//------------------------------------------------------------------------------
+#if !defined(SC_WIN_DLL) || !( defined(_WIN32) || defined(_WIN64) )
+SC_API
 #else
-        static sc_simcontext* sc_default_global_context = new sc_simcontext;
-        sc_curr_simcontext = sc_default_global_context;
+static
 #endif
+sc_simcontext*
+sc_use_default_simcontext()
+{
+    {
+        sc_scoped_lock lock( default_simcontext_mutex() );
+        if( sc_default_global_context == 0 ) {
+            sc_default_global_context = new sc_simcontext;
+        }
     }
+    sc_curr_simcontext = sc_default_global_context;
     return sc_curr_simcontext;
 }
-#endif // 0
+
+//------------------------------------------------------------------------------
+//"sc_set_curr_simcontext"
+//
+// This function makes the given simulation context the current one of the
+// calling host thread, so that several simulations can run concurrently on
+// different host threads, or one after the other on the same thread. The
+// context must only be used by one host thread at a time.
+//     simc = simulation context, NULL to use the default context again.
+// Result is the previous simulation context of the thread.
+//------------------------------------------------------------------------------
+SC_API sc_simcontext*
+sc_set_curr_simcontext( sc_simcontext* simc )
+{
+    sc_simcontext* prev_p = sc_curr_simcontext;
+    sc_curr_simcontext = simc;
+    return prev_p;
+}
 
 // Generates unique names within each module.
 
@@ -1583,6 +2256,26 @@ sc_gen_unique_name( const char* basename_, bool preserve_first )
     }
 }
 
+SC_API int
+sc_gen_unique_names( const char* basename_, int n_ )
+{
+    sc_simcontext* simc = sc_get_curr_simcontext();
+    sc_module* curr_module = simc->hierarchy_curr();
+    if( curr_module != 0 ) {
+	return curr_module->gen_unique_names( basename_, n_ );
+    } else {
+        sc_process_b* curr_proc_p = sc_get_current_process_b();
+	if ( curr_proc_p )
+	{
+	    return curr_proc_p->gen_unique_names( basename_, n_ );
+	}
+	else
+	{
+	    return simc->gen_unique_names( basename_, n_ );
+	}
+    }
+}
+
 // Get a handle for the current process
 //
 // Note that this method should not be called if the current process is
@@ -1603,10 +2296,9 @@ sc_get_current_process_handle()
 SC_API sc_process_b*
 sc_get_curr_process_handle()
 {
-    static bool warn=true;
-    if ( warn )
+    if ( sc_get_curr_simcontext()->first_deprecated_call(
+             sc_simcontext::deprecated_curr_proc_handle ) )
     {
-        warn = false;
         SC_REPORT_INFO(SC_ID_IEEE_1666_DEPRECATION_,
        "sc_get_curr_process_handle deprecated use sc_get_current_process_handle"
        );
@@ -1683,13 +2375,16 @@ sc_start( const sc_time& duration, sc_starvation_policy p )
 
     context_p = sc_get_curr_simcontext();
     starting_delta = sc_delta_count();
-    entry_time = context_p->m_curr_time;
+    entry_time = context_p->m_checkpoint   // time of a restored checkpoint.
+               ? sc_time::from_value( context_p->m_checkpoint->time() )
+               : context_p->m_curr_time;
     if ( p == SC_RUN_TO_TIME )
-        exit_time = context_p->m_curr_time + duration;
+        exit_time = entry_time + duration;
 
     // called with duration = SC_ZERO_TIME for the first time
-    static bool init_delta_or_pending_updates =
+    bool init_delta_or_pending_updates = !context_p->m_sc_start_called &&
          ( starting_delta == 0 && exit_time == SC_ZERO_TIME );
+    context_p->m_sc_start_called = true;
 
     // If the simulation status is bad issue the appropriate message:
 
@@ -1730,6 +2425,12 @@ sc_start( const sc_time& duration, sc_starvation_policy p )
         context_p->do_timestep( exit_time );
     }
 
+    // Promise the other partitions of a distributed simulation that
+    // nothing is sent before the time it has paused at:
+
+    if ( context_p->m_pdes && sim_status == SC_SIM_OK )
+        context_p->m_pdes->promise( context_p->m_curr_time );
+
     // If there was no activity and the simulation clock did not move warn
     // the user, except if we're in a first sc_start(SC_ZERO_TIME) for
     // initialisation (only) or there have been pending updates:
@@ -1741,9 +2442,6 @@ sc_start( const sc_time& duration, sc_starvation_policy p )
     {
         SC_REPORT_WARNING(SC_ID_NO_SC_START_ACTIVITY_, "");
     }
-
-    // reset init/update flag for subsequent calls
-    init_delta_or_pending_updates = false;
 }
 
 SC_API void
@@ -1766,11 +2464,9 @@ sc_stop()
 SC_API void
 sc_initialize()
 {
-    static bool warning_initialize = true;
-
-    if ( warning_initialize )
+    if ( sc_get_curr_simcontext()->first_deprecated_call(
+             sc_simcontext::deprecated_initialize ) )
     {
-        warning_initialize = false;
         SC_REPORT_INFO(SC_ID_IEEE_1666_DEPRECATION_,
 	    "sc_initialize() is deprecated: use sc_start(SC_ZERO_TIME)" );
     }
@@ -1782,11 +2478,9 @@ sc_initialize()
 SC_API void
 sc_cycle( const sc_time& duration )
 {
-    static bool warning_cycle = true;
-
-    if ( warning_cycle )
+    if ( sc_get_curr_simcontext()->first_deprecated_call(
+             sc_simcontext::deprecated_cycle ) )
     {
-        warning_cycle = false;
         SC_REPORT_INFO(SC_ID_IEEE_1666_DEPRECATION_,
 	    "sc_cycle is deprecated: use sc_start(sc_time)" );
     }
@@ -1819,10 +2513,9 @@ sc_time_stamp()
 SC_API double
 sc_simulation_time()
 {
-    static bool warn_simulation_time=true;
-    if ( warn_simulation_time )
+    if ( sc_get_curr_simcontext()->first_deprecated_call(
+             sc_simcontext::deprecated_simulation_time ) )
     {
-        warn_simulation_time=false;
         SC_REPORT_INFO(SC_ID_IEEE_1666_DEPRECATION_,
 	    "sc_simulation_time() is deprecated use sc_time_stamp()" );
     }
@@ -1870,6 +2563,293 @@ sc_get_stop_mode()
     return stop_mode;
 }
 
+//------------------------------------------------------------------------------
+//"sc_set_parallel_evaluation"
+//
+// This function sets the number of host threads used to evaluate the
+// SC_METHODs of different partitions concurrently. It overrides the value
+// of the SC_PARALLEL_EVALUATION environment variable.
+//     workers          = number of host threads, 0 or 1 for sequential
+//                        evaluation.
+//     infer_partitions = true if SC_METHODs without a declared partition
+//                        should be partitioned based on their port bindings,
+//                        false if they should be executed sequentially.
+//------------------------------------------------------------------------------
+SC_API void
+sc_set_parallel_evaluation( unsigned workers, bool infer_partitions )
+{
+    if ( sc_is_running() )
+    {
+        SC_REPORT_ERROR( SC_ID_PARALLEL_EVALUATION_,
+                         "may not be changed after simulation has started" );
+        return;
+    }
+    parallel_workers = workers;
+    parallel_inference = infer_partitions;
+}
+
+SC_API unsigned
+sc_get_parallel_evaluation()
+{
+    return parallel_workers;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_levelized_methods"
+//
+// This function enables the levelized execution of the SC_METHODs that
+// communicate through signals without forming a cycle. It overrides the
+// SC_LEVELIZED_METHODS environment variable.
+//     enable = true to execute such SC_METHODs in topological order and to
+//              propagate their signal updates within the same delta cycle.
+//------------------------------------------------------------------------------
+SC_API void
+sc_set_levelized_methods( bool enable )
+{
+    if ( sc_is_running() )
+    {
+        SC_REPORT_ERROR( SC_ID_LEVELIZED_METHODS_,
+                         "may not be changed after simulation has started" );
+        return;
+    }
+    levelized_methods = enable;
+}
+
+SC_API bool
+sc_get_levelized_methods()
+{
+    return levelized_methods;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_kernel_profile"
+//
+// This function selects the file the kernel profile is written to at the
+// end of simulation. It overrides the SC_KERNEL_PROFILE environment
+// variable. The profile is written as JSON if the file name ends with
+// ".json" and as CSV otherwise.
+//     file_name = name of the profile file, NULL or empty to disable the
+//                 profiling.
+//------------------------------------------------------------------------------
+SC_API void
+sc_set_kernel_profile( const char* file_name )
+{
+    if ( sc_is_running() )
+    {
+        SC_REPORT_ERROR( SC_ID_KERNEL_PROFILE_,
+                         "may not be changed after simulation has started" );
+        return;
+    }
+    kernel_profile_file() = file_name ? file_name : "";
+}
+
+SC_API const char*
+sc_get_kernel_profile()
+{
+    return kernel_profile_file().c_str();
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_stack_profile"
+//
+// This function selects the file the peak stack usage of the thread
+// processes is written to at the end of simulation. It overrides the
+// SC_STACK_PROFILE environment variable. The unused stacks are painted
+// with a pattern when the threads are created, which costs time and
+// memory, so the profile should only be written by a dedicated run.
+//     file_name = name of the CSV file, NULL or empty to disable the
+//                 measurement.
+//------------------------------------------------------------------------------
+SC_API void
+sc_set_stack_profile( const char* file_name )
+{
+    if ( sc_is_running() )
+    {
+        SC_REPORT_ERROR( SC_ID_STACK_PROFILE_,
+                         "may not be changed after simulation has started" );
+        return;
+    }
+    stack_profile_file() = file_name ? file_name : "";
+}
+
+SC_API const char*
+sc_get_stack_profile()
+{
+    return stack_profile_file().c_str();
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_stack_sizes"
+//
+// This function selects a stack profile written by an earlier run, see
+// sc_set_stack_profile, from which the stack sizes of the thread processes
+// are taken. It overrides the SC_STACK_SIZES environment variable. Thread
+// processes not in the profile keep the stack size set by the model.
+//     file_name = name of the CSV file, NULL or empty to use the stack
+//                 sizes set by the model.
+//------------------------------------------------------------------------------
+SC_API void
+sc_set_stack_sizes( const char* file_name )
+{
+    if ( sc_is_running() )
+    {
+        SC_REPORT_ERROR( SC_ID_STACK_PROFILE_,
+                         "may not be changed after simulation has started" );
+        return;
+    }
+    stack_sizes_file() = file_name ? file_name : "";
+}
+
+SC_API const char*
+sc_get_stack_sizes()
+{
+    return stack_sizes_file().c_str();
+}
+
+//------------------------------------------------------------------------------
+//"sc_save_checkpoint"
+//
+// This function writes the state of the simulation to a checkpoint file. It
+// may only be called while the simulation is paused, i.e., between calls of
+// sc_start. Modules and primitive channels save their own state by
+// overriding save_state.
+//     file_name = name of the checkpoint file.
+// Result is true if the checkpoint has been written.
+//------------------------------------------------------------------------------
+SC_API bool
+sc_save_checkpoint( const char* file_name )
+{
+    std::ofstream out( file_name ? file_name : "", std::ios::binary );
+    if ( !out )
+    {
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_, file_name ? file_name : "" );
+        return false;
+    }
+    return sc_get_curr_simcontext()->save_checkpoint( out );
+}
+
+//------------------------------------------------------------------------------
+//"sc_restore_checkpoint"
+//
+// This function reads a checkpoint file written by sc_save_checkpoint. It
+// must be called before the simulation starts, in a model elaborated like
+// the one that saved the checkpoint. The state is restored when the
+// simulation starts: the simulation continues at the time of the
+// checkpoint, the modules and primitive channels restore their state in
+// restore_state, and the thread processes start from the beginning. A
+// warning lists the thread processes that were suspended within their
+// functions when the checkpoint was saved.
+//     file_name = name of the checkpoint file.
+// Result is true if the checkpoint has been read.
+//------------------------------------------------------------------------------
+SC_API bool
+sc_restore_checkpoint( const char* file_name )
+{
+    std::ifstream in( file_name ? file_name : "", std::ios::binary );
+    if ( !in )
+    {
+        SC_REPORT_ERROR( SC_ID_CHECKPOINT_, file_name ? file_name : "" );
+        return false;
+    }
+    return sc_get_curr_simcontext()->restore_checkpoint( in );
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_pdes_partition"
+//
+// This function makes the simulation one partition of a distributed
+// simulation, whose partitions run in separate host processes and are
+// connected by Unix-domain sockets. It overrides the SC_PDES_PARTITION
+// environment variable and must be called before the first cross-partition
+// channel is created.
+//     rank    = number of this partition, from 0 to size - 1.
+//     size    = number of partitions.
+//     address = path prefix of the sockets, "<address>.<rank>", NULL to
+//               keep the default "/tmp/sc_pdes".
+//------------------------------------------------------------------------------
+SC_API void
+sc_set_pdes_partition( int rank, int size, const char* address )
+{
+    if ( sc_get_curr_simcontext()->m_pdes || sc_is_running() )
+    {
+        SC_REPORT_ERROR( SC_ID_PDES_,
+                         "partition may not be changed after the first "
+                         "cross-partition channel has been created" );
+        return;
+    }
+    if ( rank < 0 || rank >= size )
+    {
+        SC_REPORT_ERROR( SC_ID_PDES_, "partition out of range" );
+        return;
+    }
+    pdes_rank = rank;
+    pdes_size = size;
+    if ( address )
+        pdes_address() = address;
+}
+
+SC_API int
+sc_get_pdes_rank()
+{
+    return pdes_rank;
+}
+
+SC_API int
+sc_get_pdes_size()
+{
+    return pdes_size;
+}
+
+sc_pdes*
+sc_simcontext::pdes()
+{
+    if ( !m_pdes )
+        m_pdes = new sc_pdes( this, pdes_rank, pdes_size, pdes_address() );
+    return m_pdes;
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_timing_wheel"
+//
+// This function selects the data structure holding the pending timed
+// notifications of the current simulation context. It overrides the
+// SC_TIMING_WHEEL environment variable and may be called at any time.
+//     enable = true to keep near-future notifications in a timing wheel,
+//              false to keep all notifications in a binary heap.
+//------------------------------------------------------------------------------
+SC_API void
+sc_set_timing_wheel( bool enable )
+{
+    sc_get_curr_simcontext()->m_timed_events->set_wheel_enabled( enable );
+}
+
+SC_API bool
+sc_get_timing_wheel()
+{
+    return sc_get_curr_simcontext()->m_timed_events->wheel_enabled();
+}
+
+//------------------------------------------------------------------------------
+//"sc_set_clock_skip_ahead"
+//
+// This function enables the skip-ahead over the edges of the clocks of the
+// current simulation context that no process observes. It overrides the
+// SC_CLOCK_SKIP_AHEAD environment variable and may be called at any time.
+//     enable = true to advance the time directly to the next notification
+//              that is not an edge of an unobserved clock.
+//------------------------------------------------------------------------------
+SC_API void
+sc_set_clock_skip_ahead( bool enable )
+{
+    sc_get_curr_simcontext()->m_clock_skip_ahead = enable;
+}
+
+SC_API bool
+sc_get_clock_skip_ahead()
+{
+    return sc_get_curr_simcontext()->m_clock_skip_ahead;
+}
+
 SC_API bool sc_is_unwinding()
 {
     return sc_get_current_process_handle().is_unwinding();
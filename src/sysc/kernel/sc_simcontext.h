@@ -34,6 +34,7 @@
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_status.h"
 #include "sysc/kernel/sc_time.h"
+#include "sysc/kernel/sc_timing_wheel.h"
 #include "sysc/utils/sc_hash.h"
 #include "sysc/utils/sc_pq.h"
 
@@ -46,17 +47,24 @@ namespace sc_core {
 
 // forward declarations
 
+class sc_checkpoint;
+class sc_clock;
+class sc_sensitivity_table;
 class sc_cor;
 class sc_cor_pkg;
 class sc_event;
 class sc_event_timed;
 class sc_export_registry;
+class sc_kernel_profiler;
+class sc_method_levelizer;
 class sc_module;
 class sc_module_name;
 class sc_module_registry;
 class sc_name_gen;
 class sc_object;
 class sc_object_manager;
+class sc_parallel_evaluator;
+class sc_pdes;
 class sc_phase_callback_registry;
 class sc_process_handle;
 class sc_port_registry;
@@ -65,6 +73,7 @@ class sc_process_table;
 class sc_signal_bool_deval;
 class sc_trace_file;
 class sc_runnable;
+class sc_stack_profile;
 class sc_process_host;
 class sc_method_process;
 class sc_cthread_process;
@@ -91,6 +100,48 @@ enum sc_stop_mode {          // sc_stop modes:
 extern SC_API void sc_set_stop_mode( sc_stop_mode mode );
 extern SC_API sc_stop_mode sc_get_stop_mode();
 
+// number of host threads evaluating independent SC_METHODs and resolving
+// the port binding at the end of elaboration (0: sequential)
+extern SC_API void sc_set_parallel_evaluation( unsigned workers,
+                                               bool infer_partitions = true );
+extern SC_API unsigned sc_get_parallel_evaluation();
+
+// keep near-future timed notifications in a timing wheel instead of a heap
+extern SC_API void sc_set_timing_wheel( bool enable );
+extern SC_API bool sc_get_timing_wheel();
+
+// skip the edges of clocks without observers when advancing time
+extern SC_API void sc_set_clock_skip_ahead( bool enable );
+extern SC_API bool sc_get_clock_skip_ahead();
+
+// execute acyclic SC_METHOD networks in topological order within a delta
+extern SC_API void sc_set_levelized_methods( bool enable );
+extern SC_API bool sc_get_levelized_methods();
+
+// write a profile of the processes and delta cycles at the end of simulation
+extern SC_API void sc_set_kernel_profile( const char* file_name );
+extern SC_API const char* sc_get_kernel_profile();
+
+// write the peak stack usage of the thread processes at the end of simulation
+extern SC_API void sc_set_stack_profile( const char* file_name );
+extern SC_API const char* sc_get_stack_profile();
+
+// size the stacks of the thread processes from a stack profile
+extern SC_API void sc_set_stack_sizes( const char* file_name );
+extern SC_API const char* sc_get_stack_sizes();
+
+// save the state of the paused simulation to a checkpoint file
+extern SC_API bool sc_save_checkpoint( const char* file_name );
+
+// restore the state of a checkpoint file when the simulation starts
+extern SC_API bool sc_restore_checkpoint( const char* file_name );
+
+// run this simulation as partition rank of size distributed partitions
+extern SC_API void sc_set_pdes_partition( int rank, int size,
+                                          const char* address = 0 );
+extern SC_API int sc_get_pdes_rank();
+extern SC_API int sc_get_pdes_size();
+
 enum sc_starvation_policy 
 {
     SC_EXIT_ON_STARVATION,
@@ -151,7 +202,11 @@ class SC_API sc_simcontext
     friend class sc_time;
     friend class sc_time_tuple;
     friend class sc_clock;
+    friend class sc_kernel_profiler;
+    friend class sc_method_levelizer;
     friend class sc_method_process;
+    friend class sc_parallel_evaluator;
+    friend class sc_pdes;
     friend class sc_phase_callback_registry;
     friend class sc_process_b;
     friend class sc_process_handle;
@@ -172,6 +227,11 @@ class SC_API sc_simcontext
     friend SC_API sc_time sc_time_to_pending_activity( const sc_simcontext* );
     friend SC_API bool sc_pending_activity_at_current_time( const sc_simcontext* );
     friend SC_API bool sc_pending_activity_at_future_time( const sc_simcontext* );
+    friend SC_API void sc_set_timing_wheel( bool );
+    friend SC_API bool sc_get_timing_wheel();
+    friend SC_API void sc_set_clock_skip_ahead( bool );
+    friend SC_API bool sc_get_clock_skip_ahead();
+    friend SC_API void sc_set_pdes_partition( int, int, const char* );
 
     enum sc_signal_write_check
     {
@@ -234,6 +294,7 @@ public:
     const char* gen_unique_name( const char* basename_, 
                                  bool preserve_first = false 
                                );
+    int gen_unique_names( const char* basename_, int n_ );
 
     // process creation
     sc_process_handle create_cthread_process( 
@@ -276,6 +337,7 @@ public:
     bool is_running() const;
     bool update_phase() const;
     bool notify_phase() const;
+    bool evaluating_in_parallel() const;
     bool get_error();
     void set_error( sc_report* );
 
@@ -293,6 +355,27 @@ public:
     bool next_time( sc_time& t ) const; 
     bool pending_activity_at_current_time() const;
 
+    // checkpointing, see sc_save_checkpoint and sc_restore_checkpoint
+    bool save_checkpoint( std::ostream& os );
+    bool restore_checkpoint( std::istream& is );
+
+    // link to the other partitions of a distributed simulation, created on
+    // first use, see sc_set_pdes_partition
+    sc_pdes* pdes();
+
+    // deprecated functions, whose use is reported once per context
+    enum deprecated_function {
+        deprecated_find_object        = 0x01,
+        deprecated_get_child_objects  = 0x02,
+        deprecated_delta_count        = 0x04,
+        deprecated_is_running         = 0x08,
+        deprecated_curr_proc_handle   = 0x10,
+        deprecated_initialize         = 0x20,
+        deprecated_cycle              = 0x40,
+        deprecated_simulation_time    = 0x80
+    };
+    bool first_deprecated_call( deprecated_function ) const;
+
 private:
 
     void add_child_event( sc_event* );
@@ -305,9 +388,18 @@ private:
     int add_delta_event( sc_event* );
     void remove_delta_event( sc_event* );
     void add_timed_event( sc_event_timed* );
+    void remove_timed_event( sc_event_timed* );
+    bool rearm_timed_event( sc_event_timed*, sc_event*, const sc_time& );
 
     void trace_cycle( bool delta_cycle );
 
+    void apply_checkpoint();
+
+    void trigger_delta_events();
+
+    void skip_idle_clocks( const sc_time& until_t );
+    void resume_parked_clocks();
+
     void execute_method_next( sc_method_handle );
     void execute_thread_next( sc_thread_handle );
 
@@ -337,6 +429,10 @@ private:
     sc_method_handle remove_process( sc_method_handle );
     sc_thread_handle remove_process( sc_thread_handle );
 
+    sc_curr_proc_handle parallel_curr_proc_info() const;
+    sc_process_b* parallel_current_writer() const;
+    void parallel_set_error( sc_report* );
+
 private:
 
     enum execution_phases {
@@ -358,6 +454,7 @@ private:
     sc_process_table*           m_process_table;
     sc_curr_proc_info           m_curr_proc_info;
     sc_process_b*               m_current_writer;
+    sc_process_b*               m_last_created_process_p;
     sc_signal_write_check       m_write_check;
     int                         m_next_proc_id;
 
@@ -367,14 +464,28 @@ private:
     std::vector<sc_object*>     m_child_objects;
 
     std::vector<sc_event*>      m_delta_events;
-    sc_ppq<sc_event_timed*>*    m_timed_events;
+    sc_timing_wheel*            m_timed_events;
 
     std::vector<sc_trace_file*> m_trace_files;
     bool                        m_something_to_trace;
 
+    std::vector<sc_clock*>      m_clocks;
+    std::vector<sc_clock*>      m_parked_clocks;      // edges suppressed.
+    bool                        m_clock_skip_ahead;
+
     sc_runnable*                m_runnable;
     sc_process_list*            m_collectable;
 
+    sc_parallel_evaluator*      m_parallel_evaluator; // null if sequential.
+    bool                        m_parallel_evaluation; // workers are active.
+    sc_method_levelizer*        m_method_levelizer;   // null if dynamic.
+    bool                        m_levelizing;         // levelizer is active.
+    sc_kernel_profiler*         m_profiler;           // null unless profiling.
+    sc_stack_profile*           m_stack_profile;      // null unless sizing.
+    sc_checkpoint*              m_checkpoint;         // null unless restoring.
+    sc_sensitivity_table*       m_sensitivity_table;
+    sc_pdes*                    m_pdes;               // null unless distributed.
+
     sc_time_params*             m_time_params;
     sc_time                     m_curr_time;
     mutable sc_time             m_max_time;
@@ -393,6 +504,9 @@ private:
     bool                        m_end_of_simulation_called;
     sc_status                   m_simulation_status;
     bool                        m_start_of_simulation_called;
+    bool                        m_sc_start_called;
+    bool                        m_stop_warning_issued;
+    mutable unsigned            m_deprecated_calls; // deprecated_function.
 
     sc_cor_pkg*                 m_cor_pkg; // the simcontext's coroutine package
     sc_cor*                     m_cor;     // the simcontext's coroutine
@@ -408,24 +522,32 @@ private:
 
 // IIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIIII
 
-// Not MT safe.
+// Each host thread has a current simulation context, set with
+// sc_set_curr_simcontext(). Threads that have not set one use the default
+// context, which is shared by all of them and created on first use.
 
-#if 1
-extern SC_API sc_simcontext* sc_curr_simcontext;
 extern SC_API sc_simcontext* sc_default_global_context;
 
+#if !defined(SC_WIN_DLL) || !( defined(_WIN32) || defined(_WIN64) )
+extern SC_API SC_THREAD_LOCAL_ sc_simcontext* sc_curr_simcontext;
+
+// makes the default context current for the calling thread
+extern SC_API sc_simcontext* sc_use_default_simcontext();
+
 inline sc_simcontext*
 sc_get_curr_simcontext()
 {
-    if( sc_curr_simcontext == 0 ) {
-        sc_default_global_context = new sc_simcontext;
-        sc_curr_simcontext = sc_default_global_context;
+    if( SC_UNLIKELY_( sc_curr_simcontext == 0 ) ) {
+        return sc_use_default_simcontext();
     }
     return sc_curr_simcontext;
 }
-#else
+#else // thread-local variables cannot be imported from a DLL
     extern SC_API sc_simcontext* sc_get_curr_simcontext();
-#endif // 0
+#endif
+
+// make a simulation context current for the calling host thread
+extern SC_API sc_simcontext* sc_set_curr_simcontext( sc_simcontext* simc );
 inline sc_status sc_get_status()
 {
     return sc_get_curr_simcontext()->get_status();
@@ -503,6 +625,8 @@ inline
 sc_curr_proc_handle
 sc_simcontext::get_curr_proc_info()
 {
+    if( SC_UNLIKELY_(m_parallel_evaluation) )
+        return parallel_curr_proc_info();
     return &m_curr_proc_info;
 }
 
@@ -576,10 +700,24 @@ sc_simcontext::notify_phase() const
     return m_execution_phase == phase_notify;
 }
 
+// true while method processes are executed on the parallel evaluation
+// workers, kernel operations are deferred until the workers are done.
+
+inline
+bool
+sc_simcontext::evaluating_in_parallel() const
+{
+    return m_parallel_evaluation;
+}
+
 inline
 void
 sc_simcontext::set_error( sc_report* err )
 {
+    if( SC_UNLIKELY_(m_parallel_evaluation) ) {
+        parallel_set_error( err );
+        return;
+    }
     delete m_error;
     m_error = err;
 }
@@ -607,11 +745,32 @@ sc_simcontext::add_timed_event( sc_event_timed* et )
     m_timed_events->insert( et );
 }
 
+inline
+void
+sc_simcontext::remove_timed_event( sc_event_timed* et )
+{
+    // the queue is gone when events outlive clean(), nothing reads its
+    // records any more
+    if( SC_LIKELY_( m_timed_events != 0 ) ) {
+        m_timed_events->cancel( et );
+    }
+}
+
+inline
+bool
+sc_simcontext::rearm_timed_event( sc_event_timed* et, sc_event* e,
+                                  const sc_time& t )
+{
+    return m_timed_events->rearm( et, e, t );
+}
+
 // ----------------------------------------------------------------------------
 
 inline sc_process_b*
 sc_simcontext::get_current_writer() const
 {
+    if( SC_UNLIKELY_(m_parallel_evaluation) )
+        return parallel_current_writer();
     return m_current_writer;
 }
 
@@ -667,6 +826,12 @@ extern SC_API
 const char*
 sc_gen_unique_name( const char* basename_, bool preserve_first = false );
 
+// Reserves the names of n_ calls to sc_gen_unique_name( basename_ ) at once,
+// they are basename__<k> ... basename__<k+n_-1> for the returned k.
+extern SC_API
+int
+sc_gen_unique_names( const char* basename_, int n_ );
+
 
 // Set the random seed for controlled randomization -- not yet implemented
 extern SC_API
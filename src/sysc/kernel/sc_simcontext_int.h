@@ -35,6 +35,7 @@
 #include "sysc/kernel/sc_simcontext.h"
 #include "sysc/kernel/sc_runnable.h"
 #include "sysc/kernel/sc_runnable_int.h"
+#include "sysc/kernel/sc_method_levelizer.h"
 
 // DEBUGGING MACROS:
 //
@@ -99,7 +100,7 @@ sc_simcontext::reset_curr_proc()
     m_curr_proc_info.process_handle = 0;
     m_curr_proc_info.kind           = SC_NO_PROC_;
     m_current_writer                = 0;
-    sc_process_b::m_last_created_process_p = 0;
+    m_last_created_process_p        = 0;
 }
 
 inline
@@ -217,6 +218,12 @@ inline
 void
 sc_simcontext::push_runnable_method( sc_method_handle method_h )
 {
+    // while levelized method processes are executed, the triggered ones
+    // are queued by level directly
+    if( SC_UNLIKELY_(m_levelizing) && method_h->m_level >= 0 ) {
+        m_method_levelizer->queue( method_h );
+        return;
+    }
     m_runnable->push_back_method( method_h );
 }
 
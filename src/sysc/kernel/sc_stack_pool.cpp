@@ -0,0 +1,182 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_stack_pool.cpp -- Pool of the stacks of terminated thread processes.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_stack_pool.h"
+#include "sysc/communication/sc_host_mutex.h"
+
+#include <cstdlib>
+
+namespace sc_core {
+
+// default limit of the pooled stacks, in bytes
+
+static const std::size_t sc_default_stack_pool_limit = 64 * 1024 * 1024;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_stack_pool
+// ----------------------------------------------------------------------------
+
+sc_stack_pool::sc_stack_pool()
+  : m_mutex( new sc_host_mutex )
+  , m_free_fn( 0 )
+  , m_limit( sc_default_stack_pool_limit )
+  , m_classes()
+  , m_stats()
+{
+    const char* limit = std::getenv( "SC_STACK_POOL_LIMIT" );
+    if( limit != NULL )
+        m_limit = static_cast<std::size_t>( std::strtoul( limit, 0, 10 ) );
+}
+
+// like the default simulation context, the pool is never deleted, so that
+// coroutines may still be deleted during the destruction of static objects
+
+sc_stack_pool&
+sc_stack_pool::instance()
+{
+    static sc_stack_pool* pool = new sc_stack_pool;
+    return *pool;
+}
+
+void*
+sc_stack_pool::acquire( std::size_t size )
+{
+    sc_scoped_lock lock( *m_mutex );
+    class_map::iterator it = m_classes.find( size );
+    if( it == m_classes.end() || it->second.empty() )
+        return 0;
+
+    void* stack = it->second.back();
+    it->second.pop_back();
+    m_stats.reuses++;
+    m_stats.pooled--;
+    m_stats.pooled_bytes -= size;
+    return stack;
+}
+
+bool
+sc_stack_pool::release( void* stack, std::size_t size )
+{
+    sc_scoped_lock lock( *m_mutex );
+    if( m_free_fn == 0 || m_stats.pooled_bytes + size > m_limit )
+        return false;
+
+    m_classes[size].push_back( stack );
+    m_stats.releases++;
+    m_stats.pooled++;
+    m_stats.pooled_bytes += size;
+    if( m_stats.pooled_bytes > m_stats.peak_bytes )
+        m_stats.peak_bytes = m_stats.pooled_bytes;
+    return true;
+}
+
+void
+sc_stack_pool::allocated()
+{
+    sc_scoped_lock lock( *m_mutex );
+    m_stats.allocations++;
+}
+
+void
+sc_stack_pool::freed()
+{
+    sc_scoped_lock lock( *m_mutex );
+    m_stats.frees++;
+}
+
+void
+sc_stack_pool::set_limit( std::size_t bytes )
+{
+    sc_scoped_lock lock( *m_mutex );
+    m_limit = bytes;
+    trim();
+}
+
+void
+sc_stack_pool::trim()
+{
+    class_map::reverse_iterator it = m_classes.rbegin();
+    while( m_stats.pooled_bytes > m_limit && it != m_classes.rend() ) {
+        std::vector<void*>& stacks = it->second;
+        while( m_stats.pooled_bytes > m_limit && !stacks.empty() ) {
+            (*m_free_fn)( stacks.back(), it->first );
+            stacks.pop_back();
+            m_stats.frees++;
+            m_stats.pooled--;
+            m_stats.pooled_bytes -= it->first;
+        }
+        ++it;
+    }
+}
+
+sc_stack_pool_stats
+sc_stack_pool::stats() const
+{
+    sc_scoped_lock lock( *m_mutex );
+    return m_stats;
+}
+
+// ----------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//"sc_set_stack_pool_limit"
+//
+// This function sets the maximum total size of the stacks of terminated
+// thread processes kept for reuse. It overrides the SC_STACK_POOL_LIMIT
+// environment variable and may be called at any time. Pooled stacks
+// exceeding the new limit are freed.
+//     bytes = limit in bytes, 0 to free all stacks immediately.
+//------------------------------------------------------------------------------
+SC_API void
+sc_set_stack_pool_limit( std::size_t bytes )
+{
+    sc_stack_pool::instance().set_limit( bytes );
+}
+
+SC_API std::size_t
+sc_get_stack_pool_limit()
+{
+    return sc_stack_pool::instance().limit();
+}
+
+SC_API sc_stack_pool_stats
+sc_get_stack_pool_stats()
+{
+    return sc_stack_pool::instance().stats();
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,148 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_stack_pool.h -- Pool of the stacks of terminated thread processes.
+
+  The coroutine package returns the stack of a deleted coroutine to the
+  pool, which keeps it for a later coroutine with a stack of the same
+  size, as long as the total size of the pooled stacks stays within the
+  limit. Stacks of different sizes (see sc_module::set_stack_size) are
+  kept in separate size classes. The pool is shared by the simulations
+  running on different host threads.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_STACK_POOL_H_INCLUDED_
+#define SC_STACK_POOL_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(push)
+#pragma warning(disable: 4251) // DLL import for std::map, std::vector
+#endif
+
+namespace sc_core {
+
+class sc_host_mutex;
+
+// ----------------------------------------------------------------------------
+//  STRUCT : sc_stack_pool_stats
+//
+//  Statistics of the stack pool.
+// ----------------------------------------------------------------------------
+
+struct SC_API sc_stack_pool_stats
+{
+    std::size_t allocations;  // stacks allocated from the heap.
+    std::size_t reuses;       // stacks taken from the pool.
+    std::size_t releases;     // stacks returned to the pool.
+    std::size_t frees;        // stacks returned to the heap.
+    std::size_t pooled;       // stacks in the pool.
+    std::size_t pooled_bytes; // total size of the stacks in the pool.
+    std::size_t peak_bytes;   // maximum of pooled_bytes.
+};
+
+// maximum total size of the stacks kept for reuse (0: no reuse)
+extern SC_API void sc_set_stack_pool_limit( std::size_t bytes );
+extern SC_API std::size_t sc_get_stack_pool_limit();
+extern SC_API sc_stack_pool_stats sc_get_stack_pool_stats();
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_stack_pool
+//
+//  Size-classed free lists of coroutine stacks.
+//
+//  FOR INTERNAL USE ONLY!
+// ----------------------------------------------------------------------------
+
+class SC_API sc_stack_pool
+{
+public:
+
+    // returns a pooled stack to the heap
+    typedef void (free_fn)( void* stack, std::size_t size );
+
+    // the pool of the process
+    static sc_stack_pool& instance();
+
+    // enable pooling, for stacks released with the given function
+    void set_free_function( free_fn* fn ) { m_free_fn = fn; }
+
+    // take a pooled stack of the given size, 0 if there is none
+    void* acquire( std::size_t size );
+
+    // keep a stack, false if it must be freed by the caller
+    bool release( void* stack, std::size_t size );
+
+    // count the stacks not taken from or kept by the pool
+    void allocated();
+    void freed();
+
+    std::size_t limit() const { return m_limit; }
+    void set_limit( std::size_t bytes );
+
+    sc_stack_pool_stats stats() const;
+
+private:
+
+    sc_stack_pool();
+
+    // free the pooled stacks exceeding the limit, largest first
+    void trim();
+
+private:
+    typedef std::map< std::size_t, std::vector<void*> > class_map;
+
+    sc_host_mutex*      m_mutex;    // guards all of the following.
+    free_fn*            m_free_fn;
+    std::size_t         m_limit;
+    class_map           m_classes;  // pooled stacks by size.
+    sc_stack_pool_stats m_stats;
+
+private:
+    // disabled
+    sc_stack_pool( const sc_stack_pool& );
+    sc_stack_pool& operator = ( const sc_stack_pool& );
+};
+
+} // namespace sc_core
+
+#if defined(_MSC_VER) && !defined(SC_WIN_DLL_WARN)
+#pragma warning(pop)
+#endif
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_STACK_POOL_H_INCLUDED_
+// Taf!
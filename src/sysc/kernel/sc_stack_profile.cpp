@@ -0,0 +1,178 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_stack_profile.cpp -- Measurement and right-sizing of thread stacks.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_stack_profile.h"
+#include "sysc/kernel/sc_cor.h"
+#include "sysc/kernel/sc_thread_process.h"
+#include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/utils/sc_report.h"
+
+#include <cstdlib>
+#include <fstream>
+
+namespace sc_core {
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_stack_profile
+// ----------------------------------------------------------------------------
+
+sc_stack_profile::sc_stack_profile( const std::string& output_name,
+                                    const std::string& input_name )
+  : m_output_name( output_name )
+  , m_written( false )
+  , m_measured()
+  , m_sizes()
+  , m_threads()
+{
+    if ( !input_name.empty() )
+        read( input_name );
+}
+
+sc_stack_profile::~sc_stack_profile()
+{}
+
+std::size_t
+sc_stack_profile::stack_size( const char* name, std::size_t size ) const
+{
+    entry_map::const_iterator it = m_sizes.find( name );
+    if ( it == m_sizes.end() || it->second.usage == 0 )
+        return size;
+
+    std::size_t usage = it->second.usage;
+    return usage + usage / 4 + margin;
+}
+
+void
+sc_stack_profile::attach( sc_thread_process* thread_p )
+{
+    if ( m_output_name.empty() || m_written || thread_p->m_cor_p == 0 )
+        return;
+
+    thread_p->m_cor_p->stack_paint();
+    m_threads.insert( thread_p );
+}
+
+void
+sc_stack_profile::detach( sc_thread_process* thread_p )
+{
+    if ( m_threads.erase( thread_p ) )
+        record( thread_p );
+}
+
+// a process name may be reused by a later dynamic process, so that the
+// maximum over all processes of the same name is kept
+
+void
+sc_stack_profile::record( sc_thread_process* thread_p )
+{
+    std::size_t usage = thread_p->m_cor_p->stack_usage();
+    if ( usage == 0 ) // the coroutine package does not measure the usage.
+        return;
+
+    entry& measured = m_measured[thread_p->name()];
+    if ( measured.stack_size < thread_p->m_stack_size )
+        measured.stack_size = thread_p->m_stack_size;
+    if ( measured.usage < usage )
+        measured.usage = usage;
+}
+
+// the file holds a header line and a line "name,stack_size,peak_usage" per
+// thread process, the name is split at the last but one comma
+
+void
+sc_stack_profile::read( const std::string& input_name )
+{
+    std::ifstream in( input_name.c_str() );
+    if ( !in )
+    {
+        SC_REPORT_WARNING( SC_ID_STACK_PROFILE_, input_name.c_str() );
+        return;
+    }
+
+    std::string line;
+    std::getline( in, line ); // header
+    while ( std::getline( in, line ) )
+    {
+        std::string::size_type usage_pos = line.rfind( ',' );
+        if ( usage_pos == std::string::npos || usage_pos == 0 )
+            continue;
+        std::string::size_type size_pos = line.rfind( ',', usage_pos - 1 );
+        if ( size_pos == std::string::npos || size_pos == 0 )
+            continue;
+
+        entry& sizes = m_sizes[line.substr( 0, size_pos )];
+        sizes.stack_size = static_cast<std::size_t>(
+          std::strtoul( line.c_str() + size_pos + 1, 0, 10 ) );
+        sizes.usage = static_cast<std::size_t>(
+          std::strtoul( line.c_str() + usage_pos + 1, 0, 10 ) );
+    }
+}
+
+void
+sc_stack_profile::write()
+{
+    if ( m_output_name.empty() || m_written )
+        return;
+    m_written = true;
+
+    // the threads still existing have reached their peak usage
+
+    std::set<sc_thread_process*>::const_iterator thread_it;
+    for ( thread_it = m_threads.begin(); thread_it != m_threads.end();
+          ++thread_it )
+    {
+        record( *thread_it );
+    }
+    m_threads.clear();
+
+    std::ofstream out( m_output_name.c_str() );
+    if ( !out )
+    {
+        SC_REPORT_WARNING( SC_ID_STACK_PROFILE_, m_output_name.c_str() );
+        return;
+    }
+
+    out << "name,stack_size,peak_usage" << std::endl;
+    entry_map::const_iterator it;
+    for ( it = m_measured.begin(); it != m_measured.end(); ++it )
+    {
+        out << it->first << ',' << it->second.stack_size << ','
+            << it->second.usage << std::endl;
+    }
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
@@ -0,0 +1,124 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_stack_profile.h -- Measurement and right-sizing of thread stacks.
+
+  If a stack profile is written, the unused part of the stack of each
+  thread process is painted with a pattern when its coroutine is created.
+  When the thread process is deleted or the simulation ends, the peak
+  stack usage is determined from the part of the stack that has been
+  overwritten. The stack size and peak usage of all thread processes are
+  written to a CSV file.
+
+  If a stack profile is read, each thread process listed in it with a
+  known peak usage gets a stack of that size plus a safety margin,
+  instead of the stack size set by the model.
+
+  FOR INTERNAL USE ONLY!
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_STACK_PROFILE_H_INCLUDED_
+#define SC_STACK_PROFILE_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+
+namespace sc_core {
+
+class sc_thread_process;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_stack_profile
+//
+//  Peak stack usage of the thread processes of a simulation context.
+// ----------------------------------------------------------------------------
+
+class sc_stack_profile
+{
+    friend class sc_simcontext;
+    friend class sc_thread_process;
+
+    // stack of a thread process
+    struct entry
+    {
+        std::size_t stack_size;
+        std::size_t usage;       // peak usage, 0 if unknown.
+    };
+
+    typedef std::map<std::string, entry> entry_map;
+
+    // added to 1.25 times the peak usage, covers the red zone of the stack
+    enum { margin = 16384 };
+
+private:
+
+    sc_stack_profile( const std::string& output_name,
+                      const std::string& input_name );
+    ~sc_stack_profile();
+
+    // stack size of a thread process, from the profile read
+    std::size_t stack_size( const char* name, std::size_t size ) const;
+
+    // paint the stack of a thread process after its creation
+    void attach( sc_thread_process* );
+
+    // record the usage of a thread process before its deletion
+    void detach( sc_thread_process* );
+
+    void record( sc_thread_process* );
+
+    void read( const std::string& input_name );
+
+    // write the profile file, only once
+    void write();
+
+private:
+    std::string                  m_output_name; // empty if not measuring.
+    bool                         m_written;
+    entry_map                    m_measured;    // by process name.
+    entry_map                    m_sizes;       // read from the input.
+    std::set<sc_thread_process*> m_threads;     // with painted stacks.
+
+private:
+    // disabled
+    sc_stack_profile( const sc_stack_profile& );
+    sc_stack_profile& operator = ( const sc_stack_profile& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_STACK_PROFILE_H_INCLUDED_
+// Taf!
@@ -31,6 +31,7 @@
 #include "sysc/kernel/sc_thread_process.h"
 #include "sysc/kernel/sc_process_handle.h"
 #include "sysc/kernel/sc_simcontext_int.h"
+#include "sysc/kernel/sc_stack_profile.h"
 #include "sysc/kernel/sc_module.h"
 #include "sysc/utils/sc_machine.h"
 
@@ -109,6 +110,9 @@ void sc_thread_cor_fn( void* arg )
     sc_simcontext*   simc_p = sc_get_curr_simcontext();
     sc_thread_handle thread_h = reinterpret_cast<sc_thread_handle>( arg );
 
+    if ( SC_UNLIKELY_(thread_h->m_profile_p) )
+        thread_h->m_profile_p->begin( true );
+
     // PROCESS THE THREAD AND PROCESS ANY EXCEPTIONS THAT ARE THROWN:
 
     while( true ) {
@@ -136,6 +140,9 @@ void sc_thread_cor_fn( void* arg )
 
     sc_process_b*    active_p = sc_get_current_process_b();
 
+    if ( SC_UNLIKELY_(thread_h->m_profile_p) )
+        thread_h->m_profile_p->end();
+
     // REMOVE ALL TRACES OF OUR THREAD FROM THE SIMULATORS DATA STRUCTURES:
 
     thread_h->disconnect_process();
@@ -331,9 +338,16 @@ void sc_thread_process::kill_process(sc_descendant_inclusion_info descendants )
 //------------------------------------------------------------------------------
 void sc_thread_process::prepare_for_simulation()
 {
+    sc_stack_profile* profile_p = simcontext()->m_stack_profile;
+    if ( SC_UNLIKELY_(profile_p) )
+        m_stack_size = profile_p->stack_size( name(), m_stack_size );
+
     m_cor_p = simcontext()->cor_pkg()->create( m_stack_size,
                          sc_thread_cor_fn, this );
     m_cor_p->stack_protect( true );
+
+    if ( SC_UNLIKELY_(profile_p) )
+        profile_p->attach( this );
 }
 
 
@@ -476,7 +490,9 @@ sc_thread_process::~sc_thread_process()
     // DESTROY THE COROUTINE FOR THIS THREAD:
 
     if( m_cor_p != 0 ) {
-        m_cor_p->stack_protect( false );
+        sc_stack_profile* profile_p = simcontext()->m_stack_profile;
+        if ( SC_UNLIKELY_(profile_p) )
+            profile_p->detach( this );
         delete m_cor_p;
         m_cor_p = 0;
     }
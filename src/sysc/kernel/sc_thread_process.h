@@ -36,6 +36,7 @@
 #include "sysc/kernel/sc_cor.h"
 #include "sysc/kernel/sc_event.h"
 #include "sysc/kernel/sc_except.h"
+#include "sysc/kernel/sc_kernel_profiler.h"
 #include "sysc/kernel/sc_reset.h"
 
 // DEBUGGING MACROS:
@@ -104,6 +105,7 @@ class sc_thread_process : public sc_process_b {
     friend class sc_process_table;
     friend class sc_simcontext;
     friend class sc_runnable;
+    friend class sc_stack_profile;
     friend sc_cor* get_cor_pointer( sc_process_b* process_p );
 
     friend void wait( int, sc_simcontext* );
@@ -217,12 +219,14 @@ inline void sc_thread_process::suspend_me()
 
     // do not switch, if we're about to execute next (e.g. suicide)
 
+    if( SC_UNLIKELY_(m_profile_p) ) m_profile_p->end();
     if( m_cor_p != cor_p )
     {
         DEBUG_MSG( DEBUG_NAME , this, "suspending thread");
         simc_p->cor_pkg()->yield( cor_p );
         DEBUG_MSG( DEBUG_NAME , this, "resuming thread");
     }
+    if( SC_UNLIKELY_(m_profile_p) ) m_profile_p->begin( m_cor_p != cor_p );
 
     // IF THERE IS A THROW TO BE DONE FOR THIS PROCESS DO IT NOW:
     //
@@ -318,7 +322,7 @@ sc_thread_process::wait( const sc_time& t )
     if( m_unwinding )
         SC_REPORT_ERROR( SC_ID_WAIT_DURING_UNWINDING_, name() );
 
-    m_timeout_event_p->notify_internal( t );
+    m_timeout_event_p->notify_internal( t, m_timeout_slot_p );
     m_timeout_event_p->add_dynamic( this );
     m_trigger_type = TIMEOUT;
     suspend_me();
@@ -331,7 +335,7 @@ sc_thread_process::wait( const sc_time& t, const sc_event& e )
     if( m_unwinding )
         SC_REPORT_ERROR( SC_ID_WAIT_DURING_UNWINDING_, name() );
 
-    m_timeout_event_p->notify_internal( t );
+    m_timeout_event_p->notify_internal( t, m_timeout_slot_p );
     m_timeout_event_p->add_dynamic( this );
     e.add_dynamic( this );
     m_event_p = &e;
@@ -346,7 +350,7 @@ sc_thread_process::wait( const sc_time& t, const sc_event_or_list& el )
     if( m_unwinding )
         SC_REPORT_ERROR( SC_ID_WAIT_DURING_UNWINDING_, name() );
 
-    m_timeout_event_p->notify_internal( t );
+    m_timeout_event_p->notify_internal( t, m_timeout_slot_p );
     m_timeout_event_p->add_dynamic( this );
     el.add_dynamic( this );
     m_event_list_p = &el;
@@ -361,7 +365,7 @@ sc_thread_process::wait( const sc_time& t, const sc_event_and_list& el )
     if( m_unwinding )
         SC_REPORT_ERROR( SC_ID_WAIT_DURING_UNWINDING_, name() );
 
-    m_timeout_event_p->notify_internal( t );
+    m_timeout_event_p->notify_internal( t, m_timeout_slot_p );
     m_timeout_event_p->add_dynamic( this );
     el.add_dynamic( this );
     m_event_list_p = &el;
@@ -0,0 +1,436 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timing_wheel.cpp -- Queue of the pending timed event notifications.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#include "sysc/kernel/sc_timing_wheel.h"
+#include "sysc/kernel/sc_event.h"
+#include "sysc/utils/sc_report.h"  // sc_assert
+
+namespace sc_core {
+
+// index of the lowest set bit of a non-zero word
+
+static inline int
+sc_lowest_bit( sc_dt::uint64 w )
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll( w );
+#else
+    int i = 0;
+    while( !(w & 1) ) {
+        w >>= 1;
+        ++i;
+    }
+    return i;
+#endif
+}
+
+sc_timing_wheel::sc_timing_wheel()
+  : m_enabled( false )
+  , m_size( 0 )
+  , m_cancelled( 0 )
+  , m_rekeyed( 0 )
+  , m_base( 0 )
+  , m_slots()
+  , m_heap( 128, sc_notify_time_compare )
+{
+    for( int l = 0; l < levels; ++l ) {
+        m_occupied[l] = 0;
+    }
+    for( int s = 0; s < slots; ++s ) {
+        m_head[s] = 0;
+    }
+}
+
+sc_timing_wheel::~sc_timing_wheel()
+{}
+
+// +----------------------------------------------------------------------------
+// |"sc_timing_wheel::set_wheel_enabled"
+// |
+// | This method selects the data structure for subsequent insertions. When
+// | the wheel is disabled, its entries are moved to the heap, so that the
+// | queue behaves exactly like a plain sc_ppq afterwards.
+// |
+// | Arguments:
+// |     enable = true if the timing wheel should be used.
+// +----------------------------------------------------------------------------
+void
+sc_timing_wheel::set_wheel_enabled( bool enable )
+{
+    if( enable == m_enabled )
+        return;
+
+    m_enabled = enable;
+    if( enable )
+        return;
+
+    for( int l = 0; l < levels; ++l ) {
+        while( m_occupied[l] ) {
+            int s = sc_lowest_bit( m_occupied[l] );
+            std::vector<sc_event_timed*>& slot = m_slots[(l << slot_bits) + s];
+            for( std::size_t i = l ? 0 : m_head[s]; i < slot.size(); ++i ) {
+                m_heap.insert( slot[i] );
+            }
+            slot.clear();
+            if( l == 0 )
+                m_head[s] = 0;
+            m_occupied[l] &= ~( sc_dt::uint64(1) << s );
+        }
+    }
+    m_size = 0;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_timing_wheel::wheel_insert"
+// |
+// | This method places a notification in the slot matching the highest
+// | bit in which its time differs from the base time of the wheel, or in
+// | the heap if it is beyond the horizon of the wheel.
+// |
+// | Arguments:
+// |     et = notification to be inserted.
+// +----------------------------------------------------------------------------
+void
+sc_timing_wheel::wheel_insert( sc_event_timed* et )
+{
+    sc_dt::uint64 t = et->key_time().value();
+    if( t < m_base ) {
+        m_heap.insert( et );
+        return;
+    }
+
+    sc_dt::uint64 d = t ^ m_base;
+    int level = 0;
+    while( d >= slots ) {
+        d >>= slot_bits;
+        if( ++level == levels ) {
+            m_heap.insert( et );
+            return;
+        }
+    }
+
+    int s = static_cast<int>( t >> (level * slot_bits) ) & (slots - 1);
+    m_slots[(level << slot_bits) + s].push_back( et );
+    m_occupied[level] |= sc_dt::uint64(1) << s;
+    ++m_size;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_timing_wheel::refill"
+// |
+// | This method restarts the empty wheel at the time of the first
+// | notification in the heap and moves all notifications within the new
+// | horizon from the heap to the wheel.
+// +----------------------------------------------------------------------------
+void
+sc_timing_wheel::refill()
+{
+    sc_assert( m_size == 0 );
+    if( m_heap.empty() )
+        return;
+
+    m_base = m_heap.top()->key_time().value();
+    while( !m_heap.empty() &&
+           ( m_heap.top()->key_time().value() ^ m_base ) <
+             ( sc_dt::uint64(1) << (levels * slot_bits) ) ) {
+        wheel_insert( m_heap.extract_top() );
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_timing_wheel::cascade"
+// |
+// | This method advances the base time to the first occupied slot of the
+// | lowest non-empty level and distributes its entries to the lower levels,
+// | until level 0 contains an entry.
+// +----------------------------------------------------------------------------
+void
+sc_timing_wheel::cascade()
+{
+    sc_assert( m_size > 0 );
+    while( !m_occupied[0] ) {
+        int level = 1;
+        while( !m_occupied[level] ) {
+            ++level;
+        }
+
+        int s = sc_lowest_bit( m_occupied[level] );
+        int shift = level * slot_bits;
+        m_base = ( ( m_base >> (shift + slot_bits) ) << (shift + slot_bits) )
+               | ( sc_dt::uint64(s) << shift );
+
+        std::vector<sc_event_timed*> moved;
+        moved.swap( m_slots[(level << slot_bits) + s] );
+        m_occupied[level] &= ~( sc_dt::uint64(1) << s );
+        m_size -= static_cast<int>( moved.size() );
+        for( std::size_t i = 0; i < moved.size(); ++i ) {
+            wheel_insert( moved[i] );
+        }
+
+        // keep the allocated slot storage
+        moved.clear();
+        moved.swap( m_slots[(level << slot_bits) + s] );
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_timing_wheel::wheel_min"
+// |
+// | This method returns the first inserted entry with the earliest time in
+// | the wheel, or NULL if the wheel and the heap are empty.
+// +----------------------------------------------------------------------------
+sc_event_timed*
+sc_timing_wheel::wheel_min()
+{
+    if( m_size == 0 ) {
+        refill();
+        if( m_size == 0 )
+            return 0;
+    }
+    if( !m_occupied[0] )
+        cascade();
+    int s = sc_lowest_bit( m_occupied[0] );
+    return m_slots[s][m_head[s]];
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_timing_wheel::cancel"
+// |
+// | This method detaches a pending notification from its event. If the
+// | cancelled notifications outnumber the pending ones, they are removed
+// | from the queue and their records are deleted. Otherwise they are
+// | deleted when they are extracted.
+// |
+// | Arguments:
+// |     et = notification to be cancelled.
+// +----------------------------------------------------------------------------
+void
+sc_timing_wheel::cancel( sc_event_timed* et )
+{
+    sc_assert( et->m_event != 0 );
+    et->m_event = 0;
+    if( et->m_rekey ) {
+        et->m_rekey = false;
+        --m_rekeyed;
+    }
+    if( ++m_cancelled > compact_threshold && 2 * m_cancelled > size() )
+        compact();
+}
+
+void
+sc_timing_wheel::insert( sc_event_timed* et )
+{
+    et->m_queued = true;
+    if( m_enabled )
+        wheel_insert( et );
+    else
+        m_heap.insert( et );
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_timing_wheel::rearm"
+// |
+// | This method notifies an event through its timer slot. A slot that is
+// | not queued is inserted at the new time. A cancelled slot that is still
+// | queued is revived instead: at its key time, if the new time is the
+// | same, or else marked to be moved to the new time when it reaches the
+// | top of the queue (see settle). Its key time is then before the new
+// | time, and no other notification of the event is pending, so the order
+// | of the notifications is the same as if it had been inserted anew.
+// |
+// | Arguments:
+// |     et = timer slot.
+// |     e  = event to be notified.
+// |     t  = time of the notification.
+// | Result is false if the slot is queued at a later time, in which case
+// | nothing is changed.
+// +----------------------------------------------------------------------------
+bool
+sc_timing_wheel::rearm( sc_event_timed* et, sc_event* e, const sc_time& t )
+{
+    sc_assert( et->m_slot );
+    if( !et->m_queued ) {
+        et->m_event = e;
+        et->m_notify_time = t;
+        insert( et );
+        return true;
+    }
+    if( et->m_event != 0 || t < et->m_notify_time )
+        return false;
+
+    et->m_event = e;
+    --m_cancelled;
+    if( t != et->m_notify_time ) {
+        et->m_rekey_time = t;
+        et->m_rekey = true;
+        ++m_rekeyed;
+    }
+    return true;
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_timing_wheel::settle"
+// |
+// | This method moves the re-armed timer slots at the top of the queue to
+// | their new time, so that the top entry is due at its key time.
+// +----------------------------------------------------------------------------
+void
+sc_timing_wheel::settle()
+{
+    while( !empty() ) {
+        sc_event_timed* et = m_enabled ? wheel_top() : m_heap.top();
+        if( !et->m_rekey )
+            return;
+        if( m_enabled )
+            wheel_extract_top();
+        else
+            m_heap.extract_top();
+        et->m_notify_time = et->m_rekey_time;
+        et->m_rekey = false;
+        --m_rekeyed;
+        insert( et );
+    }
+}
+
+// +----------------------------------------------------------------------------
+// |"sc_timing_wheel::compact"
+// |
+// | This method removes all cancelled notifications from the wheel and the
+// | heap and deletes their records.
+// +----------------------------------------------------------------------------
+void
+sc_timing_wheel::compact()
+{
+    for( int l = 0; l < levels; ++l ) {
+        sc_dt::uint64 occupied = m_occupied[l];
+        while( occupied ) {
+            int s = sc_lowest_bit( occupied );
+            occupied &= occupied - 1;
+
+            std::vector<sc_event_timed*>& slot = m_slots[(l << slot_bits) + s];
+            std::size_t j = 0;
+            for( std::size_t i = l ? 0 : m_head[s]; i < slot.size(); ++i ) {
+                if( erase_cancelled( slot[i] ) )
+                    --m_size;
+                else
+                    slot[j++] = slot[i];
+            }
+            slot.resize( j );
+            if( l == 0 )
+                m_head[s] = 0;
+            if( j == 0 )
+                m_occupied[l] &= ~( sc_dt::uint64(1) << s );
+        }
+    }
+    m_heap.erase_if( &erase_cancelled );
+    m_cancelled = 0;
+}
+
+void
+sc_timing_wheel::pending( std::vector<sc_event_timed*>& result ) const
+{
+    for( int i = 0; i < levels * slots; ++i ) {
+        const std::vector<sc_event_timed*>& slot = m_slots[i];
+        for( std::size_t j = i < slots ? m_head[i] : 0; j < slot.size(); ++j ) {
+            if( slot[j]->m_event != 0 )
+                result.push_back( slot[j] );
+        }
+    }
+    for( int i = 0; i < m_heap.size(); ++i ) {
+        if( m_heap.at( i )->m_event != 0 )
+            result.push_back( m_heap.at( i ) );
+    }
+}
+
+bool
+sc_timing_wheel::erase_cancelled( void* p )
+{
+    sc_event_timed* et = static_cast<sc_event_timed*>( p );
+    if( et->m_event != 0 )
+        return false;
+    sc_event_timed::retire( et );
+    return true;
+}
+
+sc_event_timed*
+sc_timing_wheel::extract_top()
+{
+    if( m_rekeyed )
+        settle();
+    sc_event_timed* et = m_enabled ? wheel_extract_top()
+                                   : m_heap.extract_top();
+    if( et->m_event == 0 )
+        --m_cancelled;
+    return et;
+}
+
+sc_event_timed*
+sc_timing_wheel::wheel_top()
+{
+    sc_event_timed* et = wheel_min();
+    if( !m_heap.empty() &&
+        ( et == 0 || m_heap.top()->key_time() <= et->key_time() ) ) {
+        return m_heap.top();
+    }
+    return et;
+}
+
+sc_event_timed*
+sc_timing_wheel::wheel_extract_top()
+{
+    sc_event_timed* et = wheel_min();
+    if( !m_heap.empty() &&
+        ( et == 0 || m_heap.top()->key_time() <= et->key_time() ) ) {
+        return m_heap.extract_top();
+    }
+    sc_assert( et != 0 );
+
+    int s = sc_lowest_bit( m_occupied[0] );
+    std::vector<sc_event_timed*>& slot = m_slots[s];
+    if( ++m_head[s] == slot.size() ) {
+        slot.clear();
+        m_head[s] = 0;
+        m_occupied[0] &= ~( sc_dt::uint64(1) << s );
+    }
+    --m_size;
+
+    // all remaining entries of the wheel are at or after this time
+    m_base = et->key_time().value();
+    return et;
+}
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+// Taf!
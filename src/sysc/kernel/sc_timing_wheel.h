@@ -0,0 +1,172 @@
+/*****************************************************************************
+
+  Licensed to Accellera Systems Initiative Inc. (Accellera) under one or
+  more contributor license agreements.  See the NOTICE file distributed
+  with this work for additional information regarding copyright ownership.
+  Accellera licenses this file to you under the Apache License, Version 2.0
+  (the "License"); you may not use this file except in compliance with the
+  License.  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+  implied.  See the License for the specific language governing
+  permissions and limitations under the License.
+
+ *****************************************************************************/
+
+/*****************************************************************************
+
+  sc_timing_wheel.h -- Queue of the pending timed event notifications.
+
+  By default, the timed notifications are kept in a binary heap (sc_ppq).
+  Optionally, notifications in the near future are kept in a hierarchical
+  timing wheel instead, which provides constant time insertion and
+  amortized constant time extraction. The heap is still used for the
+  notifications beyond the horizon of the wheel.
+
+  Cancelled notifications stay in the queue until they are extracted,
+  unless they outnumber the pending ones, in which case the queue is
+  compacted and their records are returned to the sc_event_timed pool.
+
+  The timeout event of a process uses a timer slot, a record owned by the
+  process that is re-armed for each timed wait. A slot that is no longer
+  queued is inserted again. A slot that is still queued, because its last
+  wait ended early and cancelled it, is revived in place; if the new time
+  is later than its key, the slot is moved to the new time once it
+  reaches the top of the queue.
+
+  CHANGE LOG AT END OF FILE
+ *****************************************************************************/
+
+#ifndef SC_TIMING_WHEEL_H_INCLUDED_
+#define SC_TIMING_WHEEL_H_INCLUDED_
+
+#include "sysc/kernel/sc_cmnhdr.h"
+#include "sysc/datatypes/int/sc_nbdefs.h"
+#include "sysc/utils/sc_pq.h"
+
+#include <vector>
+
+namespace sc_core {
+
+class sc_event;
+class sc_event_timed;
+class sc_time;
+
+// ----------------------------------------------------------------------------
+//  CLASS : sc_timing_wheel
+//
+//  Priority queue of timed event notifications, ordered by notification
+//  time.
+//
+//  The wheel consists of levels of 64 slots each. Level 0 holds the
+//  notifications whose time differs from the base time of the wheel only
+//  in the lowest 6 bits, i.e. all entries of a level 0 slot have the same
+//  time. Level n holds the notifications that differ from the base time
+//  in bits [6n,6n+6) but not above. When level 0 runs empty, the first
+//  occupied slot of the next higher level is distributed to the lower
+//  levels. Notifications beyond the last level, or before the base time,
+//  are kept in the heap.
+//
+//  Notifications for the same time are extracted in the order in which
+//  they were inserted. A level 0 slot is therefore consumed from its
+//  head, and on a tie the heap, which holds the notifications inserted
+//  while their time was still beyond the horizon, comes first.
+// ----------------------------------------------------------------------------
+
+class SC_API sc_timing_wheel
+{
+public:
+
+    sc_timing_wheel();
+    ~sc_timing_wheel();
+
+    // select the wheel (true) or the plain heap (false).
+    void set_wheel_enabled( bool );
+    bool wheel_enabled() const
+        { return m_enabled; }
+
+    sc_event_timed* top()
+        {
+            if( m_rekeyed ) settle();
+            return m_enabled ? wheel_top() : m_heap.top();
+        }
+
+    sc_event_timed* extract_top();
+
+    void insert( sc_event_timed* et );
+
+    // detach the notification from its event, it will never be triggered.
+    void cancel( sc_event_timed* );
+
+    // notify e at time t through the timer slot et, false if the slot is
+    // still queued at a later time.
+    bool rearm( sc_event_timed* et, sc_event* e, const sc_time& t );
+
+    // append the notifications that are not cancelled, in no particular
+    // order.
+    void pending( std::vector<sc_event_timed*>& ) const;
+
+    int size() const
+        { return m_size + m_heap.size(); }
+
+    bool empty() const
+        { return size() == 0; }
+
+private:
+
+    enum {
+        slot_bits = 6,
+        slots     = 1 << slot_bits,
+        levels    = 5,  // horizon of 2^30 time resolution units.
+        compact_threshold = 64  // minimum number of cancelled entries.
+    };
+
+    sc_event_timed* wheel_top();
+    sc_event_timed* wheel_extract_top();
+    void            wheel_insert( sc_event_timed* );
+
+    sc_event_timed* wheel_min();
+    void            cascade();
+    void            refill();
+
+    void            compact();
+    static bool     erase_cancelled( void* );
+
+    void            settle();
+
+private:
+
+    bool                          m_enabled;
+    int                           m_size;     // entries in the wheel.
+    int                           m_cancelled; // cancelled entries.
+    int                           m_rekeyed;  // slots to be moved.
+    sc_dt::uint64                 m_base;     // <= all entries in the wheel.
+    sc_dt::uint64                 m_occupied[levels]; // non-empty slots.
+    std::size_t                   m_head[slots]; // first entry of level 0.
+    std::vector<sc_event_timed*>  m_slots[levels * slots];
+    sc_ppq<sc_event_timed*>       m_heap;     // far tail.
+
+private:
+
+    // disabled
+    sc_timing_wheel( const sc_timing_wheel& );
+    sc_timing_wheel& operator = ( const sc_timing_wheel& );
+};
+
+} // namespace sc_core
+
+/*****************************************************************************
+
+  MODIFICATION LOG - modifiers, enter your name, affiliation, date and
+  changes you are making here.
+
+      Name, Affiliation, Date:
+  Description of Modification:
+
+ *****************************************************************************/
+#endif // SC_TIMING_WHEEL_H_INCLUDED_
+// Taf!
@@ -30,6 +30,7 @@
 
 #include "sysc/kernel/sc_except.h"
 #include "sysc/kernel/sc_kernel_ids.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/kernel/sc_cthread_process.h"
 #include "sysc/kernel/sc_thread_process.h"
 #include "sysc/kernel/sc_simcontext_int.h"
@@ -274,7 +275,10 @@ next_trigger( sc_simcontext* simc )
 {
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->clear_trigger();
+	if( SC_UNLIKELY_( simc->evaluating_in_parallel() ) )
+	    sc_parallel_evaluator::defer( sc_parallel_evaluator::op_next_trigger );
+	else
+	    reinterpret_cast<sc_method_handle>( cpi->process_handle )->clear_trigger();
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -289,7 +293,12 @@ next_trigger( const sc_event& e, sc_simcontext* simc )
 {
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( e );
+	if( SC_UNLIKELY_( simc->evaluating_in_parallel() ) )
+	    sc_parallel_evaluator::defer(
+	        sc_parallel_evaluator::op_next_trigger_event,
+	        const_cast<sc_event*>( &e ) );
+	else
+	    reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( e );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -307,7 +316,11 @@ next_trigger( const sc_event_or_list& el, sc_simcontext* simc )
 
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( el );
+	if( SC_UNLIKELY_( simc->evaluating_in_parallel() ) )
+	    sc_parallel_evaluator::defer(
+	        sc_parallel_evaluator::op_next_trigger_list, el );
+	else
+	    reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( el );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -325,7 +338,11 @@ next_trigger( const sc_event_and_list& el, sc_simcontext* simc )
 
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( el );
+	if( SC_UNLIKELY_( simc->evaluating_in_parallel() ) )
+	    sc_parallel_evaluator::defer(
+	        sc_parallel_evaluator::op_next_trigger_list, el );
+	else
+	    reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( el );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -337,7 +354,11 @@ next_trigger( const sc_time& t, sc_simcontext* simc )
 {
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t );
+	if( SC_UNLIKELY_( simc->evaluating_in_parallel() ) )
+	    sc_parallel_evaluator::defer(
+	        sc_parallel_evaluator::op_next_trigger_time, 0, t );
+	else
+	    reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -349,7 +370,12 @@ next_trigger( const sc_time& t, const sc_event& e, sc_simcontext* simc )
 {
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t, e );
+	if( SC_UNLIKELY_( simc->evaluating_in_parallel() ) )
+	    sc_parallel_evaluator::defer(
+	        sc_parallel_evaluator::op_next_trigger_time_event,
+	        const_cast<sc_event*>( &e ), t );
+	else
+	    reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t, e );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -367,7 +393,11 @@ next_trigger( const sc_time& t, const sc_event_or_list& el, sc_simcontext* simc)
 
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t, el );
+	if( SC_UNLIKELY_( simc->evaluating_in_parallel() ) )
+	    sc_parallel_evaluator::defer(
+	        sc_parallel_evaluator::op_next_trigger_time_list, el, t );
+	else
+	    reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t, el );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
@@ -385,7 +415,11 @@ next_trigger(const sc_time& t, const sc_event_and_list& el, sc_simcontext* simc)
 
     sc_curr_proc_handle cpi = simc->get_curr_proc_info();
     if( cpi->kind == SC_METHOD_PROC_ ) {
-	reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t, el );
+	if( SC_UNLIKELY_( simc->evaluating_in_parallel() ) )
+	    sc_parallel_evaluator::defer(
+	        sc_parallel_evaluator::op_next_trigger_time_list, el, t );
+	else
+	    reinterpret_cast<sc_method_handle>( cpi->process_handle )->next_trigger( t, el );
     } else {
 	SC_REPORT_ERROR( SC_ID_NEXT_TRIGGER_NOT_ALLOWED_, "\n        "
 			 "in SC_THREADs and SC_CTHREADs use wait() instead" );
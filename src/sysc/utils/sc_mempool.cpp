@@ -41,6 +41,9 @@
 //  allocated by the mempool are never freed.  Thus, if purify is
 //  used, we may get MIU (memory-in-use) warnings.  To disable this,
 //  set the environment variable SYSTEMC_MEMPOOL_DONT_USE to 1.
+//  Each host thread has a memory pool of its own, so that simulations
+//  may run on several host threads. As all pools have the same cell
+//  sizes, a cell may be released to the pool of another thread.
 
 
 static const char* dont_use_envstring = "SYSTEMC_MEMPOOL_DONT_USE";
@@ -244,7 +247,7 @@ sc_mempool_int::~sc_mempool_int()
     delete[] allocators;
 }
 
-static sc_mempool_int* the_mempool = 0;
+static SC_THREAD_LOCAL_ sc_mempool_int* the_mempool = 0;
 
 void*
 sc_mempool_int::do_allocate(std::size_t sz)
@@ -269,6 +272,15 @@ sc_mempool_int::display_statistics()
         allocators[i]->display_statistics();
 }
 
+// Note that the_mempool is never freed.  This is going to cause
+// memory leaks when the program exits.
+
+static sc_mempool_int*
+new_mempool()
+{
+    return new sc_mempool_int( 1984, sizeof(cell_sizes)/sizeof(cell_sizes[0]) - 1, 8 );
+}
+
 /****************************************************************************/
 
 void*
@@ -282,9 +294,7 @@ sc_mempool::allocate(std::size_t sz)
         if (use_default_new)
             return ::operator new(sz);
 
-        // Note that the_mempool is never freed.  This is going to cause
-        // memory leaks when the program exits.
-        the_mempool = new sc_mempool_int( 1984, sizeof(cell_sizes)/sizeof(cell_sizes[0]) - 1, 8 );
+        the_mempool = new_mempool();
     }
 
     if (sz > (unsigned) the_mempool->max_size)
@@ -297,7 +307,10 @@ void
 sc_mempool::release(void* p, std::size_t sz)
 {
     if (p) {
-        
+
+        if (!use_default_new && the_mempool == 0) // allocated on another
+            the_mempool = new_mempool();          // host thread
+
         if (use_default_new || sz > (unsigned) the_mempool->max_size) {
             ::operator delete(p);
             return;
@@ -92,6 +92,27 @@ sc_ppq_base::insert( void* elem )
     m_heap[i] = elem;
 }
 
+int
+sc_ppq_base::erase_if( erase_fn_t fn )
+{
+    int j = 0;
+    for( int i = 1; i <= m_heap_size; ++ i ) {
+        if( !fn( m_heap[i] ) ) {
+            m_heap[++ j] = m_heap[i];
+	}
+    }
+    int erased = m_heap_size - j;
+    m_heap_size = j;
+
+    // restore the heap property bottom-up
+    if( erased != 0 ) {
+        for( int i = m_heap_size / 2; i >= 1; -- i ) {
+            heapify( i );
+	}
+    }
+    return erased;
+}
+
 void
 sc_ppq_base::heapify( int i )
 {
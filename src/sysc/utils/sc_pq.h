@@ -46,6 +46,7 @@ class SC_API sc_ppq_base
 public:
 
     typedef int (*compare_fn_t)( const void*, const void* );
+    typedef bool (*erase_fn_t)( void* );
 
     sc_ppq_base( int sz, compare_fn_t cmp );
 
@@ -58,6 +59,13 @@ public:
 
     void insert( void* elem );
 
+    // removes all elements for which the function returns true
+    int erase_if( erase_fn_t fn );
+
+    // element i in heap order, 0 <= i < size()
+    void* at( int i ) const
+	{ return m_heap[i + 1]; }
+
     int size() const
 	{ return m_heap_size; }
 
@@ -124,7 +132,11 @@ public:
     void insert( T elem )
 	{ sc_ppq_base::insert( (void*) elem ); }
 
-    // size() and empty() are inherited.
+    // element i in heap order, 0 <= i < size()
+    T at( int i ) const
+	{ return (T) sc_ppq_base::at( i ); }
+
+    // size(), empty() and erase_if() are inherited.
 };
 
 } // namespace sc_core
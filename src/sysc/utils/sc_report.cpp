@@ -205,7 +205,7 @@ void sc_report_handler::report(sc_severity severity_,
     else if ( severity_ == SC_FATAL )
 	actions |= SC_ABORT;
 
-    handler(rep, actions);
+    get_handler()(rep, actions);
 }
 
 void sc_report::register_id( int id, const char* msg )
@@ -270,15 +270,15 @@ void sc_report::suppress_id(int id_, bool suppress)
 void sc_report::suppress_infos(bool suppress)
 {
     sc_deprecated_report_ids("sc_report::supress_infos");
-    sc_report_handler::sev_actions[SC_INFO] =
-	suppress ? SC_DO_NOTHING: SC_DEFAULT_INFO_ACTIONS;
+    sc_report_handler::set_actions( SC_INFO,
+	suppress ? SC_DO_NOTHING: SC_DEFAULT_INFO_ACTIONS );
 }
 
 void sc_report::suppress_warnings(bool suppress)
 {
     sc_deprecated_report_ids("sc_report::suppress_warnings");
-    sc_report_handler::sev_actions[SC_WARNING] =
-	suppress ? SC_DO_NOTHING: SC_DEFAULT_WARNING_ACTIONS;
+    sc_report_handler::set_actions( SC_WARNING,
+	suppress ? SC_DO_NOTHING: SC_DEFAULT_WARNING_ACTIONS );
 }
 
 void sc_report::make_warnings_errors(bool flag)
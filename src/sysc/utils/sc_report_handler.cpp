@@ -31,7 +31,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <map>
 
+#include "sysc/communication/sc_host_mutex.h"
+#include "sysc/kernel/sc_parallel_evaluator.h"
 #include "sysc/kernel/sc_process.h"
 #include "sysc/kernel/sc_simcontext_int.h"
 #include "sysc/utils/sc_stop_here.h"
@@ -42,8 +45,6 @@ namespace std {}
 
 namespace sc_core {
 
-int sc_report_handler::verbosity_level = SC_MEDIUM;
-
 // not documented, but available
 const std::string sc_report_compose_message(const sc_report& rep)
 {
@@ -178,7 +179,181 @@ sc_log_file_handle::release()
 sc_log_file_handle::operator*()
 { return log_stream;	}
 
-static sc_log_file_handle log_stream;
+
+//
+// The settings and counters of the report handler of a host thread. The
+// message definitions are shared by all host threads, their report counts
+// are kept here.
+//
+
+struct sc_report_handler::thread_state
+{
+    struct msg_counts
+    {
+        unsigned call_count;
+        unsigned sev_call_count[SC_MAX_SEVERITY];
+    };
+    typedef std::map<const sc_msg_def*, msg_counts> msg_count_map;
+
+    thread_state();
+    explicit thread_state( const thread_state& settings );
+
+    msg_counts& counts_of( const sc_msg_def* md );
+
+    sc_actions             suppress_mask;
+    sc_actions             force_mask;
+    sc_actions             sev_actions[SC_MAX_SEVERITY];
+    unsigned               sev_limit[SC_MAX_SEVERITY];
+    unsigned               sev_call_count[SC_MAX_SEVERITY];
+    sc_report*             last_global_report;
+    sc_actions             catch_actions;
+    char*                  log_file_name;
+    int                    verbosity_level;
+    sc_report_handler_proc handler;
+    sc_log_file_handle     log_stream;
+    msg_count_map          msg_call_counts;
+};
+
+// Note that SC_FATAL has a limit of 1 by default
+
+sc_report_handler::thread_state::thread_state()
+  : suppress_mask( 0 )
+  , force_mask( 0 )
+  , last_global_report( NULL )
+  , catch_actions( SC_DEFAULT_CATCH_ACTIONS )
+  , log_file_name( 0 )
+  , verbosity_level( SC_MEDIUM )
+  , handler( &sc_report_handler::default_handler )
+  , log_stream()
+  , msg_call_counts()
+{
+    sev_actions[SC_INFO]    = SC_DEFAULT_INFO_ACTIONS;
+    sev_actions[SC_WARNING] = SC_DEFAULT_WARNING_ACTIONS;
+    sev_actions[SC_ERROR]   = SC_DEFAULT_ERROR_ACTIONS;
+    sev_actions[SC_FATAL]   = SC_DEFAULT_FATAL_ACTIONS;
+
+    for ( int i = 0; i < SC_MAX_SEVERITY; ++i )
+    {
+	sev_limit[i] = UINT_MAX;
+	sev_call_count[i] = 0;
+    }
+}
+
+// A new host thread starts with the settings of the main thread, with
+// counters of its own and without a log file, since two streams writing
+// to the same file would overwrite each other.
+
+sc_report_handler::thread_state::thread_state( const thread_state& settings )
+  : suppress_mask( settings.suppress_mask )
+  , force_mask( settings.force_mask )
+  , last_global_report( NULL )
+  , catch_actions( settings.catch_actions )
+  , log_file_name( 0 )
+  , verbosity_level( settings.verbosity_level )
+  , handler( settings.handler )
+  , log_stream()
+  , msg_call_counts()
+{
+    for ( int i = 0; i < SC_MAX_SEVERITY; ++i )
+    {
+	sev_actions[i] = settings.sev_actions[i];
+	sev_limit[i] = settings.sev_limit[i];
+	sev_call_count[i] = 0;
+    }
+}
+
+sc_report_handler::thread_state::msg_counts&
+sc_report_handler::thread_state::counts_of( const sc_msg_def* md )
+{
+    msg_count_map::iterator it = msg_call_counts.find( md );
+    if ( it == msg_call_counts.end() )
+    {
+	msg_counts counts = { 0, { 0 } };
+	it = msg_call_counts.insert( std::make_pair( md, counts ) ).first;
+    }
+    return it->second;
+}
+
+// guards the message definitions, which are only ever prepended to the
+// list, so that lookups need no lock, and the creation of the state of
+// the main thread; created on first use, which may happen during static
+// initialization
+
+static sc_host_mutex& messages_mutex()
+{
+    static sc_host_mutex* mutex_p = new sc_host_mutex;
+    return *mutex_p;
+}
+
+// the state of the calling host thread, created on first use; the first
+// state created is the one of the main thread, normally the one running
+// sc_main, which should be set up before other host threads report
+
+static SC_THREAD_LOCAL_ sc_report_handler::thread_state* curr_state_p = 0;
+static sc_report_handler::thread_state* main_state_p = 0;
+
+sc_report_handler::thread_state* sc_report_handler::get_thread_state()
+{
+    if ( SC_UNLIKELY_(curr_state_p == 0) )
+    {
+	sc_scoped_lock lock( messages_mutex() );
+	if ( main_state_p == 0 )
+	    main_state_p = curr_state_p = new thread_state;
+	else
+	    curr_state_p = new thread_state( *main_state_p );
+    }
+    return curr_state_p;
+}
+
+void sc_report_handler::set_thread_state(thread_state* state_p)
+{
+    curr_state_p = state_p;
+}
+
+// The former static members of sc_report_handler refer to the state of
+// the calling host thread.
+
+static sc_actions& suppress_mask_of_thread()
+    { return sc_report_handler::get_thread_state()->suppress_mask; }
+static sc_actions& force_mask_of_thread()
+    { return sc_report_handler::get_thread_state()->force_mask; }
+static sc_actions* sev_actions_of_thread()
+    { return sc_report_handler::get_thread_state()->sev_actions; }
+static unsigned* sev_limit_of_thread()
+    { return sc_report_handler::get_thread_state()->sev_limit; }
+static unsigned* sev_call_count_of_thread()
+    { return sc_report_handler::get_thread_state()->sev_call_count; }
+static sc_report*& last_global_report_of_thread()
+    { return sc_report_handler::get_thread_state()->last_global_report; }
+static sc_actions& catch_actions_of_thread()
+    { return sc_report_handler::get_thread_state()->catch_actions; }
+static char*& log_file_name_of_thread()
+    { return sc_report_handler::get_thread_state()->log_file_name; }
+static int& verbosity_level_of_thread()
+    { return sc_report_handler::get_thread_state()->verbosity_level; }
+static sc_report_handler_proc& handler_of_thread()
+    { return sc_report_handler::get_thread_state()->handler; }
+
+sc_report_state_ref<sc_actions> sc_report_handler::suppress_mask =
+    { &suppress_mask_of_thread };
+sc_report_state_ref<sc_actions> sc_report_handler::force_mask =
+    { &force_mask_of_thread };
+sc_report_state_array_ref<sc_actions> sc_report_handler::sev_actions =
+    { &sev_actions_of_thread };
+sc_report_state_array_ref<unsigned> sc_report_handler::sev_limit =
+    { &sev_limit_of_thread };
+sc_report_state_array_ref<unsigned> sc_report_handler::sev_call_count =
+    { &sev_call_count_of_thread };
+sc_report_state_ref<sc_report*> sc_report_handler::last_global_report =
+    { &last_global_report_of_thread };
+sc_report_state_ref<sc_actions> sc_report_handler::catch_actions =
+    { &catch_actions_of_thread };
+sc_report_state_ref<char*> sc_report_handler::log_file_name =
+    { &log_file_name_of_thread };
+sc_report_state_ref<int> sc_report_handler::verbosity_level =
+    { &verbosity_level_of_thread };
+sc_report_state_ref<sc_report_handler_proc> sc_report_handler::handler =
+    { &handler_of_thread };
 
 
 //
@@ -194,6 +369,7 @@ void sc_report_handler::default_handler(const sc_report& rep,
 
     if ( (actions & SC_LOG) && get_log_file_name() )
     {
+		sc_log_file_handle& log_stream = get_thread_state()->log_stream;
 		log_stream.update_file_name(get_log_file_name());
 
 	*log_stream << rep.get_time() << ": "
@@ -221,7 +397,7 @@ void sc_report_handler::default_handler(const sc_report& rep,
 // not documented, but available
 bool sc_report_close_default_log()
 {
-    bool ret = log_stream.release();
+    bool ret = sc_report_handler::get_thread_state()->log_stream.release();
     sc_report_handler::set_log_file_name(NULL);
 
     return ret;
@@ -229,7 +405,7 @@ bool sc_report_close_default_log()
 
 int sc_report_handler::get_count(sc_severity severity_) 
 { 
-   return sev_call_count[severity_]; 
+   return get_thread_state()->sev_call_count[severity_]; 
 } 
 
 int sc_report_handler::get_count(const char* msg_type_) 
@@ -239,7 +415,7 @@ int sc_report_handler::get_count(const char* msg_type_)
     if ( !md ) 
         md = add_msg_type(msg_type_); 
 
-    return md->call_count; 
+    return get_thread_state()->counts_of(md).call_count; 
 } 
 
 int sc_report_handler::get_count(const char* msg_type_, sc_severity severity_) 
@@ -249,7 +425,7 @@ int sc_report_handler::get_count(const char* msg_type_, sc_severity severity_)
     if ( !md ) 
         md = add_msg_type(msg_type_); 
 
-    return md->sev_call_count[severity_]; 
+    return get_thread_state()->counts_of(md).sev_call_count[severity_]; 
 } 
 
 
@@ -275,42 +451,44 @@ sc_msg_def * sc_report_handler::mdlookup(const char * msg_type_)
 // The calculation of actions to be executed
 sc_actions sc_report_handler::execute(sc_msg_def* md, sc_severity severity_)
 {
+    thread_state& state = *get_thread_state();
+    thread_state::msg_counts& counts = state.counts_of(md);
     sc_actions actions = md->sev_actions[severity_]; // high prio
 
     if ( SC_UNSPECIFIED == actions ) // middle prio
 	actions = md->actions;
 
     if ( SC_UNSPECIFIED == actions ) // the lowest prio
-	actions = sev_actions[severity_];
+	actions = state.sev_actions[severity_];
 
-    actions &= ~suppress_mask; // higher than the high prio
-    actions |= force_mask; // higher than above, and the limit is the highest
+    actions &= ~state.suppress_mask; // higher than the high prio
+    actions |= state.force_mask; // higher than above, and the limit is the highest
 
     unsigned * limit = 0;
     unsigned * call_count = 0;
 
     // just increment counters and check for overflow
-    if ( md->sev_call_count[severity_] < UINT_MAX )
-	md->sev_call_count[severity_]++;
-    if ( md->call_count < UINT_MAX )
-	md->call_count++;
-    if ( sev_call_count[severity_] < UINT_MAX )
-	sev_call_count[severity_]++;
+    if ( counts.sev_call_count[severity_] < UINT_MAX )
+	counts.sev_call_count[severity_]++;
+    if ( counts.call_count < UINT_MAX )
+	counts.call_count++;
+    if ( state.sev_call_count[severity_] < UINT_MAX )
+	state.sev_call_count[severity_]++;
 
     if ( md->limit_mask & (1 << (severity_ + 1)) )
     {
 	limit = md->sev_limit + severity_;
-	call_count = md->sev_call_count + severity_;
+	call_count = counts.sev_call_count + severity_;
     }
     if ( !limit && (md->limit_mask & 1) )
     {
 	limit = &md->limit;
-	call_count = &md->call_count;
+	call_count = &counts.call_count;
     }
     if ( !limit )
     {
-	limit = sev_limit + severity_;
-	call_count = sev_call_count + severity_;
+	limit = state.sev_limit + severity_;
+	call_count = state.sev_call_count + severity_;
     }
     if ( *limit == 0 )
     {
@@ -331,13 +509,15 @@ void sc_report_handler::report( sc_severity severity_,
 				const char* file_, 
 				int line_ )
 {
+    thread_state& state = *get_thread_state();
+    sc_parallel_report_guard guard; // serialize parallel method reports
     sc_msg_def * md = mdlookup(msg_type_);
 
     // If the severity of the report is SC_INFO and the specified verbosity 
     // level is greater than the maximum verbosity level of the simulator then 
     // return without any action.
 
-    if ( (severity_ == SC_INFO) && (verbosity_ > verbosity_level) ) return;
+    if ( (severity_ == SC_INFO) && (verbosity_ > state.verbosity_level) ) return;
 
     // Process the report:
 
@@ -350,7 +530,7 @@ void sc_report_handler::report( sc_severity severity_,
     if ( actions & SC_CACHE_REPORT )
 	cache_report(rep);
 
-    handler(rep, actions);
+    state.handler(rep, actions);
 }
 
 void sc_report_handler::report(sc_severity severity_,
@@ -359,12 +539,14 @@ void sc_report_handler::report(sc_severity severity_,
 			       const char * file_,
 			       int line_)
 {
+    thread_state& state = *get_thread_state();
+    sc_parallel_report_guard guard; // serialize parallel method reports
     sc_msg_def * md = mdlookup(msg_type_);
 
     // If the severity of the report is SC_INFO and the maximum verbosity
     // level is less than SC_MEDIUM return without any action.
 
-    if ( (severity_ == SC_INFO) && (SC_MEDIUM > verbosity_level) ) return;
+    if ( (severity_ == SC_INFO) && (SC_MEDIUM > state.verbosity_level) ) return;
 
     // Process the report:
 
@@ -378,13 +560,14 @@ void sc_report_handler::report(sc_severity severity_,
     if ( actions & SC_CACHE_REPORT )
 	cache_report(rep);
 
-    handler(rep, actions);
+    state.handler(rep, actions);
 }
 
 // The following method is never called by the simulator.
 
 void sc_report_handler::initialize()
 {
+    thread_state& state = *get_thread_state();
 #if 0 // actually, i do not know whether we have to reset these.
     suppress();
     force();
@@ -394,25 +577,11 @@ void sc_report_handler::initialize()
     set_actions(SC_FATAL,   SC_DEFAULT_FATAL_ACTIONS);
 #endif
 
-    sev_call_count[SC_INFO]    = 0;
-    sev_call_count[SC_WARNING] = 0;
-    sev_call_count[SC_ERROR]   = 0;
-    sev_call_count[SC_FATAL]   = 0;
-
-    msg_def_items * items = messages;
-
-    while ( items != &msg_terminator )
-    {
-	for ( int i = 0; i < items->count; ++i )
-	{
-	    items->md[i].call_count = 0;
-	    items->md[i].sev_call_count[SC_INFO]    = 0;
-	    items->md[i].sev_call_count[SC_WARNING] = 0;
-	    items->md[i].sev_call_count[SC_ERROR]   = 0;
-	    items->md[i].sev_call_count[SC_FATAL]   = 0;
-	}
-	items = items->next;
-    }
+    state.sev_call_count[SC_INFO]    = 0;
+    state.sev_call_count[SC_WARNING] = 0;
+    state.sev_call_count[SC_ERROR]   = 0;
+    state.sev_call_count[SC_FATAL]   = 0;
+    state.msg_call_counts.clear();
 
     // PROCESS ANY ENVIRONMENTAL OVERRIDES:
 
@@ -428,10 +597,14 @@ void sc_report_handler::initialize()
 // clear last_global_report.
 void sc_report_handler::release()
 {
-    delete last_global_report;
-    last_global_report = 0;
+    thread_state& state = *get_thread_state();
+    delete state.last_global_report;
+    state.last_global_report = 0;
+    state.msg_call_counts.clear();
     sc_report_close_default_log();
 
+    sc_scoped_lock lock( messages_mutex() );
+
     msg_def_items * items = messages, * newitems = &msg_terminator;
     messages = &msg_terminator;
 
@@ -460,6 +633,7 @@ void sc_report_handler::release()
 
 sc_msg_def * sc_report_handler::add_msg_type(const char * msg_type_)
 {
+    sc_scoped_lock lock( messages_mutex() );
     sc_msg_def * md = mdlookup(msg_type_);
     int          msg_type_len;
 
@@ -494,14 +668,16 @@ sc_msg_def * sc_report_handler::add_msg_type(const char * msg_type_)
 	return 0;
     }
     items->md->msg_type = items->md->msg_type_data;
-    add_static_msg_types(items);
+    items->next = messages;
     items->allocated = true;
+    messages = items;
 
     return items->md;
 }
 
 void sc_report_handler::add_static_msg_types(msg_def_items * items)
 {
+    sc_scoped_lock lock( messages_mutex() );
     items->allocated = false;
     items->next = messages;
     messages = items;
@@ -510,8 +686,9 @@ void sc_report_handler::add_static_msg_types(msg_def_items * items)
 sc_actions sc_report_handler::set_actions(sc_severity severity_,
 					  sc_actions actions_)
 {
-    sc_actions old = sev_actions[severity_];
-    sev_actions[severity_] = actions_;
+    thread_state& state = *get_thread_state();
+    sc_actions old = state.sev_actions[severity_];
+    state.sev_actions[severity_] = actions_;
     return old;
 }
 
@@ -546,9 +723,10 @@ sc_actions sc_report_handler::set_actions(const char * msg_type_,
 
 int sc_report_handler::stop_after(sc_severity severity_, int limit)
 {
-    int old = sev_limit[severity_];
+    thread_state& state = *get_thread_state();
+    int old = state.sev_limit[severity_];
 
-    sev_limit[severity_] = limit < 0 ? UINT_MAX: (unsigned) limit;
+    state.sev_limit[severity_] = limit < 0 ? UINT_MAX: (unsigned) limit;
 
     return old;
 }
@@ -596,8 +774,9 @@ int sc_report_handler::stop_after(const char * msg_type_,
 
 sc_actions sc_report_handler::suppress(sc_actions mask)
 {
-    sc_actions old = suppress_mask;
-    suppress_mask = mask;
+    thread_state& state = *get_thread_state();
+    sc_actions old = state.suppress_mask;
+    state.suppress_mask = mask;
     return old;
 }
 
@@ -608,8 +787,9 @@ sc_actions sc_report_handler::suppress()
 
 sc_actions sc_report_handler::force(sc_actions mask)
 {
-    sc_actions old = force_mask;
-    force_mask = mask;
+    thread_state& state = *get_thread_state();
+    sc_actions old = state.force_mask;
+    state.force_mask = mask;
     return old;
 }
 
@@ -621,42 +801,46 @@ sc_actions sc_report_handler::force()
 sc_report_handler_proc
 sc_report_handler::set_handler(sc_report_handler_proc handler_)
 {
-    sc_report_handler_proc old = handler;
-    handler = handler_ ? handler_: &sc_report_handler::default_handler;
+    thread_state& state = *get_thread_state();
+    sc_report_handler_proc old = state.handler;
+    state.handler = handler_ ? handler_: &sc_report_handler::default_handler;
     return old;
 }
 
 sc_report_handler_proc
 sc_report_handler::get_handler()
 {
-    return handler;
+    return get_thread_state()->handler;
 }
 
 sc_report* sc_report_handler::get_cached_report()
 {
+    thread_state& state = *get_thread_state();
     sc_process_b * proc = sc_get_current_process_b();
 
     if ( proc )
 	return proc->get_last_report();
 
-    return last_global_report;
+    return state.last_global_report;
 }
 
 void sc_report_handler::clear_cached_report()
 {
+    thread_state& state = *get_thread_state();
     sc_process_b * proc = sc_get_current_process_b();
 
     if ( proc )
 	proc->set_last_report(0);
     else
     {
-	delete last_global_report;
-	last_global_report = 0;
+	delete state.last_global_report;
+	state.last_global_report = 0;
     }
 }
 
 sc_actions sc_report_handler::get_new_action_id()
 {
+    sc_scoped_lock lock( messages_mutex() );
     for ( sc_actions p = 1; p; p <<= 1 )
     {
 	if ( !(p & available_actions) ) // free
@@ -670,34 +854,36 @@ sc_actions sc_report_handler::get_new_action_id()
 
 bool sc_report_handler::set_log_file_name(const char* name_)
 {
+    thread_state& state = *get_thread_state();
     if ( !name_ )
     {
-	free(log_file_name);
-	log_file_name = 0;
+	free(state.log_file_name);
+	state.log_file_name = 0;
 	return false;
     }
-    if ( log_file_name )
+    if ( state.log_file_name )
 	return false;
 
-    log_file_name = (char*)malloc(strlen(name_)+1);
-    strcpy(log_file_name, name_);
+    state.log_file_name = (char*)malloc(strlen(name_)+1);
+    strcpy(state.log_file_name, name_);
     return true;
 }
 
 const char * sc_report_handler::get_log_file_name()
 {
-    return log_file_name;
+    return get_thread_state()->log_file_name;
 }
 
 void sc_report_handler::cache_report(const sc_report& rep)
 {
+    thread_state& state = *get_thread_state();
     sc_process_b * proc = sc_get_current_process_b();
     if ( proc )
 	proc->set_last_report(new sc_report(rep));
     else
     {
-	delete last_global_report;
-	last_global_report = new sc_report(rep);
+	delete state.last_global_report;
+	state.last_global_report = new sc_report(rep);
     }
 }
 
@@ -716,12 +902,14 @@ sc_msg_def * sc_report_handler::mdlookup(int id)
     return 0;
 }
 
-int sc_report_handler::get_verbosity_level() { return verbosity_level; }
+int sc_report_handler::get_verbosity_level()
+    { return get_thread_state()->verbosity_level; }
 
 int sc_report_handler::set_verbosity_level( int level )
 {
-    int result = verbosity_level;
-    verbosity_level = level;
+    thread_state& state = *get_thread_state();
+    int result = state.verbosity_level;
+    state.verbosity_level = level;
     return result;
 }
 
@@ -730,26 +918,6 @@ int sc_report_handler::set_verbosity_level( int level )
 // static variables
 //
 
-sc_actions sc_report_handler::suppress_mask = 0;
-sc_actions sc_report_handler::force_mask = 0;
-
-sc_actions sc_report_handler::sev_actions[SC_MAX_SEVERITY] =
-{
-    /* info  */ SC_DEFAULT_INFO_ACTIONS,
-    /* warn  */ SC_DEFAULT_WARNING_ACTIONS,
-    /* error */ SC_DEFAULT_ERROR_ACTIONS,
-    /* fatal */ SC_DEFAULT_FATAL_ACTIONS
-};
-
-// Note that SC_FATAL has a limit of 1 by default
-
-sc_actions sc_report_handler::sev_limit[SC_MAX_SEVERITY] =
-{
-    UINT_MAX, UINT_MAX, UINT_MAX, UINT_MAX
-};
-sc_actions sc_report_handler::sev_call_count[SC_MAX_SEVERITY] = { 0, 0, 0, 0 };
-
-sc_report* sc_report_handler::last_global_report = NULL;
 sc_actions sc_report_handler::available_actions =
     SC_DO_NOTHING |
     SC_THROW |
@@ -760,28 +928,21 @@ sc_actions sc_report_handler::available_actions =
     SC_STOP |
     SC_ABORT;
 
-sc_report_handler_proc sc_report_handler::handler =
-    &sc_report_handler::default_handler;
-
-char * sc_report_handler::log_file_name = 0;
-
 sc_report_handler::msg_def_items * sc_report_handler::messages =
     &sc_report_handler::msg_terminator;
 
-
-sc_actions sc_report_handler::catch_actions = SC_DEFAULT_CATCH_ACTIONS;
-
 sc_actions sc_report_handler::set_catch_actions(sc_actions act)
 {
     //sc_assert( !(act | SC_THROW) ); // allow SC_THROW?
-    sc_actions old = catch_actions;
-    catch_actions = act;
+    thread_state& state = *get_thread_state();
+    sc_actions old = state.catch_actions;
+    state.catch_actions = act;
     return old;
 }
 
 sc_actions sc_report_handler::get_catch_actions()
 {
-    return catch_actions;
+    return get_thread_state()->catch_actions;
 }
 
 //
@@ -46,8 +46,8 @@ struct SC_API sc_msg_def
     unsigned     limit;
     unsigned     sev_limit[SC_MAX_SEVERITY];
     unsigned     limit_mask; // 0 - limit, 1..4 - sev_limit
-    unsigned     call_count;
-    unsigned     sev_call_count[SC_MAX_SEVERITY];
+    unsigned     call_count; // unused, counted per host thread
+    unsigned     sev_call_count[SC_MAX_SEVERITY]; // unused, as well
     char*        msg_type_data;
 
     int          id; // backward compatibility with 2.0+
@@ -56,6 +56,42 @@ struct SC_API sc_msg_def
 typedef void (* sc_report_handler_proc)(const sc_report&, const sc_actions &);
 class sc_report;
 extern SC_API bool sc_report_close_default_log();
+
+// ----------------------------------------------------------------------------
+//  STRUCT : sc_report_state_ref, sc_report_state_array_ref
+//
+//  Refer to a setting or counter of the report handler of the calling host
+//  thread, so that classes derived from sc_report_handler can still use
+//  the former static members like variables.
+// ----------------------------------------------------------------------------
+
+template< class T >
+struct sc_report_state_ref
+{
+    T& (*get)();
+
+    operator T&() const { return get(); }
+    T operator->() const { return get(); }
+
+    const sc_report_state_ref& operator=( const T& value ) const
+	{ get() = value; return *this; }
+    template< class U >
+    const sc_report_state_ref& operator|=( const U& value ) const
+	{ get() |= value; return *this; }
+    template< class U >
+    const sc_report_state_ref& operator&=( const U& value ) const
+	{ get() &= value; return *this; }
+};
+
+template< class T >
+struct sc_report_state_array_ref
+{
+    T* (*get)();
+
+    operator T*() const { return get(); }
+    T& operator[]( int i ) const { return get()[i]; }
+};
+
 class SC_API sc_report_handler
 {
 public:
@@ -135,26 +171,33 @@ public: // private, actually
     static void add_static_msg_types(msg_def_items *);
     static sc_msg_def* add_msg_type(const char * msg_type);
 
+    // settings and counters of the calling host thread, shared with the
+    // helper threads of a simulation (coroutines, parallel workers)
+    struct thread_state;
+    static thread_state* get_thread_state();
+    static void set_thread_state(thread_state*);
+
 protected:
 
     static void cache_report(const sc_report&);
     static sc_actions execute(sc_msg_def*, sc_severity);
 
-    static sc_actions   suppress_mask;
-    static sc_actions   force_mask;
-    static sc_actions   sev_actions[SC_MAX_SEVERITY];
-    static unsigned     sev_limit[SC_MAX_SEVERITY];
-    static unsigned     sev_call_count[SC_MAX_SEVERITY];
-    static sc_report*   last_global_report;
+    // the settings and counters of the calling host thread
+    static sc_report_state_ref<sc_actions>             suppress_mask;
+    static sc_report_state_ref<sc_actions>             force_mask;
+    static sc_report_state_array_ref<sc_actions>       sev_actions;
+    static sc_report_state_array_ref<unsigned>         sev_limit;
+    static sc_report_state_array_ref<unsigned>         sev_call_count;
+    static sc_report_state_ref<sc_report*>             last_global_report;
     static sc_actions   available_actions;
-    static sc_actions   catch_actions;
-    static char*        log_file_name;
-    static int          verbosity_level;
+    static sc_report_state_ref<sc_actions>             catch_actions;
+    static sc_report_state_ref<char*>                  log_file_name;
+    static sc_report_state_ref<int>                    verbosity_level;
 
     static msg_def_items*  messages;
     static msg_def_items   msg_terminator;
 
-    static sc_report_handler_proc  handler;
+    static sc_report_state_ref<sc_report_handler_proc>  handler;
 
     static sc_msg_def* mdlookup(const char* msg_type);
 
@@ -81,6 +81,13 @@ sc_vector_base::check_index( size_type i ) const
   }
 }
 
+void
+sc_vector_base::reserve( size_type n )
+{
+  vec_.reserve( n );
+  simcontext()->get_object_manager()->reserve( n );
+}
+
 bool
 sc_vector_base::check_init( size_type n ) const
 {
@@ -130,6 +137,33 @@ sc_vector_base::make_name( const char* prefix, size_type /* idx */ )
   return sc_gen_unique_name( prefix );
 }
 
+sc_vector_base::name_range::name_range( const char* prefix, size_type n )
+  : name_( prefix )
+  , prefix_n_()
+  , first_( sc_gen_unique_names( prefix, static_cast<int>(n) ) )
+{
+  name_ += '_';
+  prefix_n_ = name_.size();
+}
+
+const char*
+sc_vector_base::name_range::operator[]( size_type i )
+{
+  // same format as sc_gen_unique_name: "<prefix>_<index>"
+  char  digits[24];
+  char* p = digits + sizeof(digits);
+  *--p = '\0';
+  size_type index = first_ + i;
+  do {
+    *--p = static_cast<char>( '0' + index % 10 );
+    index /= 10;
+  } while ( index );
+
+  name_.resize( prefix_n_ );
+  name_ += p;
+  return name_.c_str();
+}
+
 sc_vector_base::context_scope::context_scope( sc_vector_base* owner )
   : owner_(NULL)
 {
@@ -176,8 +176,9 @@ protected:
   void const * at( size_type i ) const
     { return vec_[i]; }
 
-  void reserve( size_type n )
-    { vec_.reserve(n); }
+  // reserves the storage of n elements, and their entries in the object
+  // manager, before the elements are created
+  void reserve( size_type n );
 
   void clear()
     { vec_.clear(); }
@@ -209,6 +210,18 @@ protected:
     ~context_scope();
   };
 
+  // the names of n new elements, generated arithmetically: name i is the
+  // name the i-th of n calls to make_name would return
+  class SC_API name_range
+  {
+    std::string name_;
+    size_type   prefix_n_;
+    size_type   first_;
+  public:
+    name_range( const char* prefix, size_type n );
+    const char* operator[]( size_type i );
+  };
+
 public: 
   void report_empty_bind( const char* kind_, bool dst_range_ ) const;
 
@@ -677,13 +690,13 @@ sc_vector<T>::init( size_type n, Creator c )
     sc_vector_base::context_scope scope( this );
 
     base_type::reserve( n );
+    sc_vector_base::name_range names( basename(), n );
     try
     {
       for ( size_type i = 0; i<n; ++i )
       {
         // this workaround is needed for SystemC 2.2/2.3 sc_bind
-        std::string  name  = make_name( basename(), i );
-        const char*  cname = name.c_str();
+        const char*  cname = names[i];
 
         element_type* p = c( cname, i ) ; // call Creator
         base_type::push_back(p);